@@ -36,6 +36,7 @@
 #include <loki/Singleton.h>
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacKernels.h>
 
 using namespace std;
 
@@ -420,6 +421,11 @@ class BwdTrans_SumFac_Quad : public Operator
                             &input[0],  m_nmodes0, 0.0,
                             &output[0], m_nquad0);
             }
+            else if(m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         input.get(), output.get());
+            }
             else
             {
                 ASSERTL1(wsp.num_elements() == m_wspSize,
@@ -460,6 +466,7 @@ class BwdTrans_SumFac_Quad : public Operator
         const bool                      m_colldir1;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
+        QuadBwdTransKernel              m_kernel;
 
     private:
         BwdTrans_SumFac_Quad(
@@ -473,7 +480,9 @@ class BwdTrans_SumFac_Quad : public Operator
               m_colldir0(m_stdExp->GetBasis(0)->Collocation()),
               m_colldir1(m_stdExp->GetBasis(1)->Collocation()),
               m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
-              m_base1   (m_stdExp->GetBasis(1)->GetBdata())
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_kernel  (GetQuadBwdTransKernel(m_nmodes0, m_nmodes1,
+                                               m_nquad0,  m_nquad1))
         {
             m_wspSize = m_nquad0*m_nmodes1*m_numElmt;
         }
@@ -616,6 +625,11 @@ class BwdTrans_SumFac_Hex : public Operator
                              input.get(),  1,
                              output.get(), 1);
             }
+            else if(m_kernel && !m_colldir0 && !m_colldir1 && !m_colldir2)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_base2.get(), input.get(), output.get());
+            }
             else
             {
                 ASSERTL1(wsp.num_elements() == m_wspSize,
@@ -672,6 +686,7 @@ class BwdTrans_SumFac_Hex : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         const bool                      m_colldir2;
+        HexBwdTransKernel               m_kernel;
 
     private:
         BwdTrans_SumFac_Hex(
@@ -689,7 +704,9 @@ class BwdTrans_SumFac_Hex : public Operator
               m_base2   (pCollExp[0]->GetBasis(2)->GetBdata()),
               m_colldir0(pCollExp[0]->GetBasis(0)->Collocation()),
               m_colldir1(pCollExp[0]->GetBasis(1)->Collocation()),
-              m_colldir2(pCollExp[0]->GetBasis(2)->Collocation())
+              m_colldir2(pCollExp[0]->GetBasis(2)->Collocation()),
+              m_kernel  (GetHexBwdTransKernel(m_nmodes0, m_nmodes1, m_nmodes2,
+                                              m_nquad0,  m_nquad1,  m_nquad2))
         {
             m_wspSize =  m_numElmt*m_nmodes0*(m_nmodes1*m_nquad2 +
                                               m_nquad1*m_nquad2);
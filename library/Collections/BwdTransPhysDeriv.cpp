@@ -0,0 +1,423 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: BwdTransPhysDeriv.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Fused BwdTrans and PhysDeriv operator implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <loki/Singleton.h>
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eHexahedron;
+
+/**
+ * @brief Base class of the fused backward transform and derivative
+ * operators.
+ *
+ * The derivative of the expansion in a direction of the standard region is
+ * obtained by replacing the basis matrix \f$B\f$ of that direction with the
+ * matrix \f$DB\f$ of the basis derivatives at the quadrature points, which
+ * is equal to the differentiation matrix applied to \f$B\f$. All the
+ * partial sums of the sum-factorisation are therefore shared between the
+ * physical values and the derivatives of an element, and the coefficients
+ * of each element are read once. The derivatives are combined with the
+ * geometric factors while they are still in cache.
+ *
+ * The input holds the coefficients of the collection; output0 receives the
+ * physical values and output1 to output3 the derivatives in each coordinate
+ * direction, following the conventions of the PhysDeriv operators. Empty
+ * derivative outputs are skipped.
+ */
+class BwdTransPhysDeriv_SumFac : public Operator
+{
+    public:
+        virtual ~BwdTransPhysDeriv_SumFac()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            Array<OneD, NekDouble> output3;
+            (*this)(input, output0, output1, output2, output3, wsp);
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &output3,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            NekDouble *deriv[3] = {
+                output1.num_elements() > 0 ? output1.get() : NULL,
+                output2.num_elements() > 0 ? output2.get() : NULL,
+                output3.num_elements() > 0 ? output3.get() : NULL
+            };
+
+            for (int e = 0; e < m_numElmt; ++e)
+            {
+                // Derivatives in the directions of the standard region.
+                NekDouble *diff = wsp.get() + m_wspSize - m_dim*m_nPhys;
+
+                Element(input.get() + e*m_nCoeffs, output0.get() + e*m_nPhys,
+                        diff, wsp.get());
+
+                const int offset = e*m_nPhys;
+                for (int i = 0; i < m_coordim; ++i)
+                {
+                    if (!deriv[i])
+                    {
+                        continue;
+                    }
+
+                    Vmath::Vmul(m_nPhys, &m_derivFac[i*m_dim][offset], 1,
+                                diff, 1, deriv[i] + offset, 1);
+                    for (int j = 1; j < m_dim; ++j)
+                    {
+                        Vmath::Vvtvp(m_nPhys, &m_derivFac[i*m_dim+j][offset],
+                                     1, diff + j*m_nPhys, 1,
+                                     deriv[i] + offset, 1,
+                                     deriv[i] + offset, 1);
+                    }
+                }
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL0(false, "Not valid for this operator.");
+        }
+
+    protected:
+        const int                       m_dim;
+        const int                       m_coordim;
+        const int                       m_nCoeffs;
+        const int                       m_nPhys;
+        Array<TwoD, const NekDouble>    m_derivFac;
+
+        BwdTransPhysDeriv_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_dim     (m_stdExp->GetShapeDimension()),
+              m_coordim (pCollExp[0]->GetCoordim()),
+              m_nCoeffs (m_stdExp->GetNcoeffs()),
+              m_nPhys   (m_stdExp->GetTotPoints()),
+              m_derivFac(pGeomData->GetDerivFactors(pCollExp))
+        {
+        }
+
+        /**
+         * @brief Evaluates the physical values @p phys of one element and
+         * its derivatives @p diff in each direction of the standard region,
+         * stored one after the other, from its coefficients @p coeffs.
+         *
+         * @p wsp holds the partial sums and is at least of the size given
+         * by the derived class minus that of @p diff.
+         */
+        virtual void Element(
+                const NekDouble *coeffs,
+                      NekDouble *phys,
+                      NekDouble *diff,
+                      NekDouble *wsp) = 0;
+};
+
+/**
+ * @brief Fused backward transform and derivative using sum-factorisation
+ * (Segment)
+ */
+class BwdTransPhysDeriv_SumFac_Seg : public BwdTransPhysDeriv_SumFac
+{
+    public:
+        OPERATOR_CREATE(BwdTransPhysDeriv_SumFac_Seg)
+
+        virtual ~BwdTransPhysDeriv_SumFac_Seg()
+        {
+        }
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nmodes0;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_dbase0;
+
+        virtual void Element(
+                const NekDouble *coeffs,
+                      NekDouble *phys,
+                      NekDouble *diff,
+                      NekDouble *wsp)
+        {
+            Blas::Dgemv('N', m_nquad0, m_nmodes0, 1.0, m_base0.get(),
+                        m_nquad0, coeffs, 1, 0.0, phys, 1);
+            Blas::Dgemv('N', m_nquad0, m_nmodes0, 1.0, m_dbase0.get(),
+                        m_nquad0, coeffs, 1, 0.0, diff, 1);
+        }
+
+    private:
+        BwdTransPhysDeriv_SumFac_Seg(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : BwdTransPhysDeriv_SumFac(pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
+              m_dbase0  (m_stdExp->GetBasis(0)->GetDbdata())
+        {
+            m_wspSize = m_nquad0;
+        }
+};
+
+/// Factory initialisation for the BwdTransPhysDeriv_SumFac_Seg operator
+OperatorKey BwdTransPhysDeriv_SumFac_Seg::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(eSegment, eBwdTransPhysDeriv, eSumFac, false),
+        BwdTransPhysDeriv_SumFac_Seg::create, "BwdTransPhysDeriv_SumFac_Seg");
+
+
+/**
+ * @brief Fused backward transform and derivative using sum-factorisation
+ * (Quad)
+ *
+ * With \f$W = B_0 C\f$ and \f$W' = DB_0 C\f$, the physical values are
+ * \f$W B_1^T\f$ and the derivatives \f$W' B_1^T\f$ and \f$W DB_1^T\f$.
+ */
+class BwdTransPhysDeriv_SumFac_Quad : public BwdTransPhysDeriv_SumFac
+{
+    public:
+        OPERATOR_CREATE(BwdTransPhysDeriv_SumFac_Quad)
+
+        virtual ~BwdTransPhysDeriv_SumFac_Quad()
+        {
+        }
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nmodes0;
+        const int                       m_nmodes1;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_base1;
+        Array<OneD, const NekDouble>    m_dbase0;
+        Array<OneD, const NekDouble>    m_dbase1;
+
+        virtual void Element(
+                const NekDouble *coeffs,
+                      NekDouble *phys,
+                      NekDouble *diff,
+                      NekDouble *wsp)
+        {
+            NekDouble *w  = wsp;
+            NekDouble *wd = wsp + m_nquad0*m_nmodes1;
+
+            Blas::Dgemm('N', 'N', m_nquad0, m_nmodes1, m_nmodes0,
+                        1.0, m_base0.get(),  m_nquad0, coeffs, m_nmodes0,
+                        0.0, w,  m_nquad0);
+            Blas::Dgemm('N', 'N', m_nquad0, m_nmodes1, m_nmodes0,
+                        1.0, m_dbase0.get(), m_nquad0, coeffs, m_nmodes0,
+                        0.0, wd, m_nquad0);
+
+            Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                        1.0, w,  m_nquad0, m_base1.get(),  m_nquad1,
+                        0.0, phys, m_nquad0);
+            Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                        1.0, wd, m_nquad0, m_base1.get(),  m_nquad1,
+                        0.0, diff, m_nquad0);
+            Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                        1.0, w,  m_nquad0, m_dbase1.get(), m_nquad1,
+                        0.0, diff + m_nPhys, m_nquad0);
+        }
+
+    private:
+        BwdTransPhysDeriv_SumFac_Quad(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : BwdTransPhysDeriv_SumFac(pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_nmodes1 (m_stdExp->GetBasisNumModes(1)),
+              m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_dbase0  (m_stdExp->GetBasis(0)->GetDbdata()),
+              m_dbase1  (m_stdExp->GetBasis(1)->GetDbdata())
+        {
+            m_wspSize = 2*m_nquad0*m_nmodes1 + 2*m_nPhys;
+        }
+};
+
+/// Factory initialisation for the BwdTransPhysDeriv_SumFac_Quad operator
+OperatorKey BwdTransPhysDeriv_SumFac_Quad::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eBwdTransPhysDeriv, eSumFac, false),
+        BwdTransPhysDeriv_SumFac_Quad::create,
+        "BwdTransPhysDeriv_SumFac_Quad");
+
+
+/**
+ * @brief Fused backward transform and derivative using sum-factorisation
+ * (Hex)
+ *
+ * The first direction is applied with \f$B_0\f$ and \f$DB_0\f$, the second
+ * gives the three partial sums needed by the values and derivatives and the
+ * third evaluates the values and the three derivatives from them.
+ */
+class BwdTransPhysDeriv_SumFac_Hex : public BwdTransPhysDeriv_SumFac
+{
+    public:
+        OPERATOR_CREATE(BwdTransPhysDeriv_SumFac_Hex)
+
+        virtual ~BwdTransPhysDeriv_SumFac_Hex()
+        {
+        }
+
+    protected:
+        const int                       m_nquad0;
+        const int                       m_nquad1;
+        const int                       m_nquad2;
+        const int                       m_nmodes0;
+        const int                       m_nmodes1;
+        const int                       m_nmodes2;
+        Array<OneD, const NekDouble>    m_base0;
+        Array<OneD, const NekDouble>    m_base1;
+        Array<OneD, const NekDouble>    m_base2;
+        Array<OneD, const NekDouble>    m_dbase0;
+        Array<OneD, const NekDouble>    m_dbase1;
+        Array<OneD, const NekDouble>    m_dbase2;
+
+        virtual void Element(
+                const NekDouble *coeffs,
+                      NekDouble *phys,
+                      NekDouble *diff,
+                      NekDouble *wsp)
+        {
+            const int na  = m_nquad0*m_nmodes1*m_nmodes2;
+            const int nb  = m_nquad0*m_nquad1*m_nmodes2;
+            const int nq01 = m_nquad0*m_nquad1;
+
+            // Sums over the first direction with B0 and DB0.
+            NekDouble *a   = wsp;
+            NekDouble *ad  = a  + na;
+            // Sums over the first two directions with (B0,B1), (DB0,B1)
+            // and (B0,DB1).
+            NekDouble *b   = ad + na;
+            NekDouble *bd0 = b  + nb;
+            NekDouble *bd1 = bd0 + nb;
+
+            Blas::Dgemm('N', 'N', m_nquad0, m_nmodes1*m_nmodes2, m_nmodes0,
+                        1.0, m_base0.get(),  m_nquad0, coeffs, m_nmodes0,
+                        0.0, a,  m_nquad0);
+            Blas::Dgemm('N', 'N', m_nquad0, m_nmodes1*m_nmodes2, m_nmodes0,
+                        1.0, m_dbase0.get(), m_nquad0, coeffs, m_nmodes0,
+                        0.0, ad, m_nquad0);
+
+            for (int r = 0; r < m_nmodes2; ++r)
+            {
+                const int ia = r*m_nquad0*m_nmodes1;
+                const int ib = r*nq01;
+
+                Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                            1.0, a  + ia, m_nquad0, m_base1.get(),  m_nquad1,
+                            0.0, b   + ib, m_nquad0);
+                Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                            1.0, ad + ia, m_nquad0, m_base1.get(),  m_nquad1,
+                            0.0, bd0 + ib, m_nquad0);
+                Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nmodes1,
+                            1.0, a  + ia, m_nquad0, m_dbase1.get(), m_nquad1,
+                            0.0, bd1 + ib, m_nquad0);
+            }
+
+            Blas::Dgemm('N', 'T', nq01, m_nquad2, m_nmodes2,
+                        1.0, b,   nq01, m_base2.get(),  m_nquad2,
+                        0.0, phys, nq01);
+            Blas::Dgemm('N', 'T', nq01, m_nquad2, m_nmodes2,
+                        1.0, bd0, nq01, m_base2.get(),  m_nquad2,
+                        0.0, diff, nq01);
+            Blas::Dgemm('N', 'T', nq01, m_nquad2, m_nmodes2,
+                        1.0, bd1, nq01, m_base2.get(),  m_nquad2,
+                        0.0, diff + m_nPhys, nq01);
+            Blas::Dgemm('N', 'T', nq01, m_nquad2, m_nmodes2,
+                        1.0, b,   nq01, m_dbase2.get(), m_nquad2,
+                        0.0, diff + 2*m_nPhys, nq01);
+        }
+
+    private:
+        BwdTransPhysDeriv_SumFac_Hex(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : BwdTransPhysDeriv_SumFac(pCollExp, pGeomData),
+              m_nquad0  (m_stdExp->GetNumPoints(0)),
+              m_nquad1  (m_stdExp->GetNumPoints(1)),
+              m_nquad2  (m_stdExp->GetNumPoints(2)),
+              m_nmodes0 (m_stdExp->GetBasisNumModes(0)),
+              m_nmodes1 (m_stdExp->GetBasisNumModes(1)),
+              m_nmodes2 (m_stdExp->GetBasisNumModes(2)),
+              m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_base2   (m_stdExp->GetBasis(2)->GetBdata()),
+              m_dbase0  (m_stdExp->GetBasis(0)->GetDbdata()),
+              m_dbase1  (m_stdExp->GetBasis(1)->GetDbdata()),
+              m_dbase2  (m_stdExp->GetBasis(2)->GetDbdata())
+        {
+            m_wspSize = 2*m_nquad0*m_nmodes1*m_nmodes2 +
+                        3*m_nquad0*m_nquad1*m_nmodes2 + 3*m_nPhys;
+        }
+};
+
+/// Factory initialisation for the BwdTransPhysDeriv_SumFac_Hex operator
+OperatorKey BwdTransPhysDeriv_SumFac_Hex::m_type = GetOperatorFactory().
+    RegisterCreatorFunction(
+        OperatorKey(eHexahedron, eBwdTransPhysDeriv, eSumFac, false),
+        BwdTransPhysDeriv_SumFac_Hex::create,
+        "BwdTransPhysDeriv_SumFac_Hex");
+
+}
+}
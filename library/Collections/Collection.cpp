@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <Collections/Collection.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <sstream>
 
 using namespace std;
@@ -42,17 +43,107 @@ namespace Nektar {
 namespace Collections {
 
 /**
+ * @brief Job applying an operator to a single block of a collection.
  *
+ * The job selects the workspace of the worker thread it runs on, so that
+ * blocks executing concurrently never share temporary storage.
+ */
+class CollectionBlockJob : public Thread::ThreadJob
+{
+    public:
+        CollectionBlockJob(
+                OperatorSharedPtr                     op,
+                int                                   dir,
+                const Array<OneD, const NekDouble>   &input,
+                const Array<OneD,       NekDouble>   &output0,
+                const Array<OneD,       NekDouble>   &output1,
+                const Array<OneD,       NekDouble>   &output2,
+                const Array<OneD,       NekDouble>   &output3,
+                std::vector<Array<OneD, NekDouble> > &wsp)
+            : m_op(op), m_dir(dir), m_input(input), m_output0(output0),
+              m_output1(output1), m_output2(output2), m_output3(output3),
+              m_wsp(wsp)
+        {
+        }
+
+        virtual ~CollectionBlockJob()
+        {
+        }
+
+        virtual void Run()
+        {
+            Array<OneD, NekDouble> wsp(m_op->GetWspSize(),
+                                       m_wsp[GetWorkerNum()]);
+            if (m_dir < 0 && m_output3.num_elements() > 0)
+            {
+                (*m_op)(m_input, m_output0, m_output1, m_output2, m_output3,
+                        wsp);
+            }
+            else if (m_dir < 0)
+            {
+                (*m_op)(m_input, m_output0, m_output1, m_output2, wsp);
+            }
+            else
+            {
+                (*m_op)(m_dir, m_input, m_output0, wsp);
+            }
+        }
+
+    private:
+        OperatorSharedPtr                     m_op;
+        int                                   m_dir;
+        Array<OneD, const NekDouble>          m_input;
+        Array<OneD,       NekDouble>          m_output0;
+        Array<OneD,       NekDouble>          m_output1;
+        Array<OneD,       NekDouble>          m_output2;
+        Array<OneD,       NekDouble>          m_output3;
+        std::vector<Array<OneD, NekDouble> > &m_wsp;
+};
+
+/**
+ * @param pCollExp   Expansions making up the collection.
+ * @param impTypes   Implementation type of each operator.
+ * @param blockSize  If non-zero, operators which support it are instead
+ *                   set up on blocks of at most @p blockSize consecutive
+ *                   elements. The blocks are dispatched to the session thread
+ *                   pool, or run in turn if no pool has been started. Since
+ *                   the decomposition only depends on @p blockSize, results
+ *                   are bitwise identical for any number of threads.
+ *
+ * The fused eBwdTransPhysDeriv operator is only implemented for segments,
+ * quadrilaterals and hexahedra and is rarely used, so it is not created here
+ * but on the first call to HasOperator, and only if it exists for the
+ * requested implementation.
  */
 Collection::Collection(
         vector<StdRegions::StdExpansionSharedPtr>    pCollExp,
-        OperatorImpMap                              &impTypes)
+        const OperatorImpMap                        &impTypes,
+        unsigned int                                 blockSize)
+    : m_collExp(pCollExp)
 {
-    OperatorImpMap::iterator it;
+    OperatorImpMap::const_iterator it;
 
     // Initialise geometry data.
     m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
 
+    m_blockWspSize = 0;
+    m_nCoeffs      = pCollExp[0]->GetNcoeffs();
+    m_nPhys        = pCollExp[0]->GetTotPoints();
+    m_coordim      = pCollExp[0]->GetCoordim();
+
+    // Split the collection into blocks of consecutive elements, each with
+    // its own geometric data.
+    if (blockSize > 0 && blockSize < pCollExp.size())
+    {
+        for (unsigned int i = 0; i < pCollExp.size(); i += blockSize)
+        {
+            m_blockElmt.push_back(i);
+            m_blockGeom.push_back(
+                MemoryManager<CoalescedGeomData>::AllocateSharedPtr());
+        }
+        m_blockElmt.push_back(pCollExp.size());
+    }
+
     // Loop over all operator types.
     for (int i = 0; i < SIZE_OperatorType; ++i)
     {
@@ -65,17 +156,166 @@ Collection::Collection(
             OperatorKey opKey(pCollExp[0]->DetShapeType(), opType, impType,
                               pCollExp[0]->IsNodalNonTensorialExp());
 
+            // The interleaved layout is only implemented for some element
+            // types, so fall back to the standard sum-factorisation
+            // operators for the remaining ones.
+            if (impType == eSumFacInterleaved &&
+                !GetOperatorFactory().ModuleExists(opKey))
+            {
+                impType = eSumFac;
+                boost::get<2>(opKey) = impType;
+            }
+
+            if (opType == eBwdTransPhysDeriv)
+            {
+                if (GetOperatorFactory().ModuleExists(opKey))
+                {
+                    m_deferredOps[opType] = opKey;
+                }
+                continue;
+            }
+
             stringstream ss;
             ss << opKey;
             ASSERTL0(GetOperatorFactory().ModuleExists(opKey),
                  "Requested unknown operator "+ss.str());
 
-            m_ops[opType] = GetOperatorFactory().CreateInstance(
-                                                opKey, pCollExp, m_geomData);
+            CreateOperator(opKey);
         }
     }
 }
 
+/**
+ * Creates the operator @p opKey on each block if the collection is blocked
+ * and the implementation sets up all of its data on construction, and so is
+ * safe to run concurrently, and otherwise on the whole collection. Blocked
+ * operators are only ever evaluated block by block, whether by one thread or
+ * several, so that the sizes of the underlying BLAS calls, and with them the
+ * order of summation, never depend on the number of threads.
+ */
+void Collection::CreateOperator(const OperatorKey &opKey)
+{
+    OperatorType       opType  = boost::get<1>(opKey);
+    ImplementationType impType = boost::get<2>(opKey);
+
+    if (m_blockGeom.empty() || (impType != eStdMat && impType != eSumFac &&
+                                impType != eSumFacInterleaved))
+    {
+        m_ops[opType] = GetOperatorFactory().CreateInstance(
+                                            opKey, m_collExp, m_geomData);
+        return;
+    }
+
+    OperatorVector &ops = m_blockOps[opType];
+    for (int b = 0; b < m_blockGeom.size(); ++b)
+    {
+        vector<StdRegions::StdExpansionSharedPtr> blockExp(
+            m_collExp.begin() + m_blockElmt[b],
+            m_collExp.begin() + m_blockElmt[b+1]);
+
+        ops.push_back(GetOperatorFactory().CreateInstance(
+                          opKey, blockExp, m_blockGeom[b]));
+        m_blockWspSize = max(m_blockWspSize,
+                             (unsigned int)ops.back()->GetWspSize());
+    }
+}
+
+/**
+ * Returns true if the operator @p op is available for this collection,
+ * creating it first if its creation has been deferred.
+ */
+bool Collection::HasOperator(const OperatorType &op)
+{
+    map<OperatorType, OperatorKey>::iterator it = m_deferredOps.find(op);
+    if (it != m_deferredOps.end())
+    {
+        OperatorKey opKey = it->second;
+        m_deferredOps.erase(it);
+        CreateOperator(opKey);
+    }
+
+    return m_ops.find(op) != m_ops.end() || m_blockOps.count(op);
+}
+
+/**
+ * @brief Returns true if argument @p entry of operator @p op is stored in
+ * coefficient space, and false if it is stored at the quadrature points.
+ */
+bool Collection::IsCoeffEntry(const OperatorType &op, int entry)
+{
+    switch (op)
+    {
+        case eBwdTrans:
+        case eBwdTransPhysDeriv:
+            return entry == 0;
+        case eIProductWRTBase:
+            return entry == 1;
+        case eIProductWRTDerivBase:
+            return entry == m_coordim;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Applies the blocked operators of type @p op, one job per block of elements,
+ * using Thread::RunSessionJobs. The block views of the input and output arrays
+ * are created here in the calling thread, and each worker is given its own
+ * operator workspace, so that the blocks only write to disjoint storage.
+ *
+ * @param dir  Direction for operators taking a direction argument, or -1.
+ */
+void Collection::ApplyBlocks(
+        const OperatorType                 &op,
+              int                           dir,
+        const Array<OneD, const NekDouble> &inarray,
+              Array<OneD,       NekDouble> &output0,
+              Array<OneD,       NekDouble> &output1,
+              Array<OneD,       NekDouble> &output2,
+              Array<OneD,       NekDouble> &output3)
+{
+    unsigned int nWorkers = Thread::GetNumSessionJobWorkers();
+
+    // Deferred operators may need a larger workspace than those created
+    // with the collection.
+    if (m_blockWsp.size() != nWorkers ||
+        m_blockWsp[0].num_elements() < m_blockWspSize)
+    {
+        m_blockWsp.resize(nWorkers);
+        for (int i = 0; i < nWorkers; ++i)
+        {
+            m_blockWsp[i] = Array<OneD, NekDouble>(m_blockWspSize);
+        }
+    }
+
+    OperatorVector &ops = m_blockOps[op];
+    vector<Thread::ThreadJob*> jobs(ops.size());
+    Array<OneD, NekDouble> out[4] = {output0, output1, output2, output3};
+
+    for (int b = 0; b < ops.size(); ++b)
+    {
+        unsigned int elmt = m_blockElmt[b];
+        Array<OneD, const NekDouble> in = inarray +
+            elmt * (IsCoeffEntry(op, 0) ? m_nCoeffs : m_nPhys);
+        Array<OneD, NekDouble> blockOut[4];
+
+        for (int i = 0; i < 4; ++i)
+        {
+            if (out[i].num_elements() > 0)
+            {
+                blockOut[i] = out[i] +
+                    elmt * (IsCoeffEntry(op, i+1) ? m_nCoeffs : m_nPhys);
+            }
+        }
+
+        jobs[b] = new CollectionBlockJob(ops[b], dir, in, blockOut[0],
+                                         blockOut[1], blockOut[2],
+                                         blockOut[3], m_blockWsp);
+    }
+
+    Thread::RunSessionJobs(jobs);
+}
+
 }
 }
 
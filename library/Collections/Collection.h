@@ -36,6 +36,7 @@
 #ifndef NEKTAR_LIBRARY_COLLECTIONS_COLLECTION_H
 #define NEKTAR_LIBRARY_COLLECTIONS_COLLECTION_H
 
+#include <map>
 #include <vector>
 
 #include <StdRegions/StdExpansion.h>
@@ -43,6 +44,7 @@
 #include <Collections/CollectionsDeclspec.h>
 #include <Collections/Operator.h>
 #include <Collections/CoalescedGeomData.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 #include <boost/unordered_map.hpp>
 
@@ -59,7 +61,8 @@ class Collection
 
         COLLECTIONS_EXPORT Collection(
                 std::vector<StdRegions::StdExpansionSharedPtr>  pCollExp,
-                OperatorImpMap                                 &impTypes);
+                const OperatorImpMap                           &impTypes,
+                unsigned int                                    blockSize = 0);
 
         inline void ApplyOperator(
                 const OperatorType                           &op,
@@ -79,20 +82,65 @@ class Collection
                       Array<OneD,       NekDouble>           &output1,
                       Array<OneD,       NekDouble>           &output2);
 
+        inline void ApplyOperator(
+                const OperatorType                           &op,
+                const Array<OneD, const NekDouble>           &inarray,
+                      Array<OneD,       NekDouble>           &output0,
+                      Array<OneD,       NekDouble>           &output1,
+                      Array<OneD,       NekDouble>           &output2,
+                      Array<OneD,       NekDouble>           &output3);
+
         inline void ApplyOperator(
                 const OperatorType                           &op,
                       int                                     dir,
                 const Array<OneD, const NekDouble>           &inarray,
                       Array<OneD,       NekDouble>           &output);
 
-        inline bool HasOperator(const OperatorType &op);
+        COLLECTIONS_EXPORT bool HasOperator(const OperatorType &op);
 
     protected:
+        typedef std::vector<OperatorSharedPtr> OperatorVector;
+
         StdRegions::StdExpansionSharedPtr                     m_stdExp;
         std::vector<SpatialDomains::GeometrySharedPtr>        m_geom;
         boost::unordered_map<OperatorType, OperatorSharedPtr> m_ops;
         CoalescedGeomDataSharedPtr                            m_geomData;
 
+        /// Expansions of the collection, kept for deferred operators
+        std::vector<StdRegions::StdExpansionSharedPtr>        m_collExp;
+        /// Keys of the operators only created on first use
+        std::map<OperatorType, OperatorKey>                   m_deferredOps;
+
+        /// Operators acting on consecutive blocks of elements
+        boost::unordered_map<OperatorType, OperatorVector>    m_blockOps;
+        /// Index of the first element of each block (plus end marker)
+        std::vector<unsigned int>                             m_blockElmt;
+        /// Geometric data of each block
+        std::vector<CoalescedGeomDataSharedPtr>               m_blockGeom;
+        /// Workspace of each worker thread for the blocked operators
+        std::vector<Array<OneD, NekDouble> >                  m_blockWsp;
+        /// Largest workspace needed by any blocked operator
+        unsigned int                                          m_blockWspSize;
+        /// Number of coefficients per element
+        unsigned int                                          m_nCoeffs;
+        /// Number of quadrature points per element
+        unsigned int                                          m_nPhys;
+        /// Coordinate dimension of the elements
+        int                                                   m_coordim;
+
+        COLLECTIONS_EXPORT void ApplyBlocks(
+                const OperatorType                           &op,
+                      int                                     dir,
+                const Array<OneD, const NekDouble>           &inarray,
+                      Array<OneD,       NekDouble>           &output0,
+                      Array<OneD,       NekDouble>           &output1,
+                      Array<OneD,       NekDouble>           &output2,
+                      Array<OneD,       NekDouble>           &output3
+                                                    = NullNekDouble1DArray);
+
+        bool IsCoeffEntry(const OperatorType &op, int entry);
+
+        void CreateOperator(const OperatorKey &opKey);
 };
 
 typedef std::vector<Collection> CollectionVector;
@@ -107,6 +155,15 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
+    LibUtilities::ProfileRegion region(OperatorTypeMap[op]);
+
+    if (m_blockOps.count(op))
+    {
+        ApplyBlocks(op, -1, inarray, output, NullNekDouble1DArray,
+                    NullNekDouble1DArray);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output, NullNekDouble1DArray,
                  NullNekDouble1DArray, wsp);
@@ -122,6 +179,14 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output0,
               Array<OneD,       NekDouble> &output1)
 {
+    LibUtilities::ProfileRegion region(OperatorTypeMap[op]);
+
+    if (m_blockOps.count(op))
+    {
+        ApplyBlocks(op, -1, inarray, output0, output1, NullNekDouble1DArray);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, NullNekDouble1DArray, wsp);
 }
@@ -137,6 +202,14 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output1,
               Array<OneD,       NekDouble> &output2)
 {
+    LibUtilities::ProfileRegion region(OperatorTypeMap[op]);
+
+    if (m_blockOps.count(op))
+    {
+        ApplyBlocks(op, -1, inarray, output0, output1, output2);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, output2, wsp);
 }
@@ -146,17 +219,44 @@ inline void Collection::ApplyOperator(
  */
 inline void Collection::ApplyOperator(
         const OperatorType                 &op,
-              int                           dir,
         const Array<OneD, const NekDouble> &inarray,
-              Array<OneD,       NekDouble> &output)
+              Array<OneD,       NekDouble> &output0,
+              Array<OneD,       NekDouble> &output1,
+              Array<OneD,       NekDouble> &output2,
+              Array<OneD,       NekDouble> &output3)
 {
+    LibUtilities::ProfileRegion region(OperatorTypeMap[op]);
+
+    if (m_blockOps.count(op))
+    {
+        ApplyBlocks(op, -1, inarray, output0, output1, output2, output3);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
-    (*m_ops[op])(dir, inarray, output, wsp);
+    (*m_ops[op])(inarray, output0, output1, output2, output3, wsp);
 }
 
-inline bool Collection::HasOperator(const OperatorType &op)
+/**
+ *
+ */
+inline void Collection::ApplyOperator(
+        const OperatorType                 &op,
+              int                           dir,
+        const Array<OneD, const NekDouble> &inarray,
+              Array<OneD,       NekDouble> &output)
 {
-    return (m_ops.find(op) != m_ops.end());
+    LibUtilities::ProfileRegion region(OperatorTypeMap[op]);
+
+    if (m_blockOps.count(op))
+    {
+        ApplyBlocks(op, dir, inarray, output, NullNekDouble1DArray,
+                    NullNekDouble1DArray);
+        return;
+    }
+
+    Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
+    (*m_ops[op])(dir, inarray, output, wsp);
 }
 
 }
@@ -33,6 +33,15 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <fstream>
+#include <numeric>
+#include <set>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
 #include <Collections/CollectionOptimisation.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 
@@ -45,6 +54,98 @@ namespace Collections
 
 // static manager for Operator ImplementationMap
 map<OpImpTimingKey,OperatorImpMap> CollectionOptimisation::m_opImpMap;
+map<string, OperatorImpMap>         CollectionOptimisation::m_agreedImpMap;
+map<vector<int>, vector<NekDouble> > CollectionOptimisation::m_localTimings;
+bool                                CollectionOptimisation::m_cacheRead = false;
+
+// Default amount of element data in a block of a collection, chosen
+// to fit comfortably within a per-core L2 cache.
+static const unsigned int kBlockBytes = 256*1024;
+
+/**
+ * @brief Returns a string identifying the processor of this machine, used to
+ * select the autotuning results in the cache file which apply to it.
+ */
+static string GetMachineFingerprint()
+{
+    string   model = "Unknown";
+    string   line;
+    ifstream cpuinfo("/proc/cpuinfo");
+
+    while (getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0)
+        {
+            model = line.substr(line.find(':') + 1);
+            boost::trim(model);
+            break;
+        }
+    }
+
+    return model + " x " + boost::lexical_cast<string>(
+                                boost::thread::hardware_concurrency());
+}
+
+// Length of the numeric form of a timing key: the shape and number of bases,
+// the basis type, number of modes, points type and number of points of up to
+// three bases, and the number of elements.
+static const int kTimingKeyLen = 15;
+
+/**
+ * @brief Returns the numeric form of @p key, which is equal for two keys
+ * exactly when neither compares less than the other, so that processes can
+ * exchange keys with integer reductions.
+ */
+static vector<int> GetTimingKeyIds(const OpImpTimingKey &key)
+{
+    vector<int> ids(kTimingKeyLen, 0);
+    ids[0] = key.m_exp->DetShapeType();
+    ids[1] = key.m_nbasis;
+
+    for (int i = 0; i < key.m_nbasis; ++i)
+    {
+        const LibUtilities::BasisKey &bkey =
+                                    key.m_exp->GetBasis(i)->GetBasisKey();
+        ids[2 + 4*i] = bkey.GetBasisType();
+        ids[3 + 4*i] = bkey.GetNumModes();
+        ids[4 + 4*i] = bkey.GetPointsType();
+        ids[5 + 4*i] = bkey.GetNumPoints();
+    }
+
+    // Collections of 100 or more elements share the same timings.
+    ids[kTimingKeyLen - 1] = min(key.m_ngeoms, 100);
+
+    return ids;
+}
+
+/**
+ * @brief Returns the string form of the timing key @p ids, used in the cache
+ * file.
+ */
+static string GetTimingKeyString(const vector<int> &ids)
+{
+    stringstream ss;
+    ss << LibUtilities::ShapeTypeMap[ids[0]];
+
+    for (int i = 0; i < ids[1]; ++i)
+    {
+        ss << " " << LibUtilities::BasisTypeMap[ids[2 + 4*i]]
+           << "," << ids[3 + 4*i]
+           << "," << LibUtilities::kPointsTypeStr[ids[4 + 4*i]]
+           << "," << ids[5 + 4*i];
+    }
+
+    if (ids[kTimingKeyLen - 1] < 100)
+    {
+        ss << " " << ids[kTimingKeyLen - 1];
+    }
+    else
+    {
+        ss << " 100+";
+    }
+
+    return ss.str();
+}
 
 CollectionOptimisation::CollectionOptimisation(
         LibUtilities::SessionReaderSharedPtr pSession,
@@ -61,8 +162,14 @@ CollectionOptimisation::CollectionOptimisation(
     m_setByXml    = false;
     m_autotune    = false;
     m_maxCollSize = 0;
+    m_blockSize   = 0;
     m_defaultType = defaultType == eNoImpType ? eIterPerExp : defaultType;
 
+    if (pSession.get())
+    {
+        m_comm = pSession->GetComm();
+    }
+
     map<string, LibUtilities::ShapeType> elTypes;
     map<string, LibUtilities::ShapeType>::iterator it2;
     elTypes["S"] = LibUtilities::eSegment;
@@ -96,6 +203,17 @@ CollectionOptimisation::CollectionOptimisation(
         }
     }
 
+    // The fused operator is only implemented using sum-factorisation; where
+    // it does not exist the transform and derivative are applied in turn.
+    map<ElmtOrder, ImplementationType> defaultsFused = defaultsPhysDeriv;
+    if (defaultType == eNoImpType)
+    {
+        for (it2 = elTypes.begin(); it2 != elTypes.end(); ++it2)
+        {
+            defaultsFused[ElmtOrder(it2->second, -1)] = eSumFac;
+        }
+    }
+
     map<string, OperatorType> opTypes;
     for (i = 0; i < SIZE_OperatorType; ++i)
     {
@@ -105,6 +223,9 @@ CollectionOptimisation::CollectionOptimisation(
             case ePhysDeriv:
                 m_global[(OperatorType)i] = defaultsPhysDeriv;
                 break;
+            case eBwdTransPhysDeriv:
+                m_global[(OperatorType)i] = defaultsFused;
+                break;
             default:
                 m_global[(OperatorType)i] = defaults;
         }
@@ -132,6 +253,14 @@ CollectionOptimisation::CollectionOptimisation(
             const char *maxSize = xmlCol->Attribute("MAXSIZE");
             m_maxCollSize = (maxSize ? atoi(maxSize) : 0);
 
+            // Set the number of elements per block for threaded execution
+            const char *blockSize = xmlCol->Attribute("BLOCKSIZE");
+            m_blockSize = (blockSize ? atoi(blockSize) : 0);
+
+            // Set the file in which autotuning results are kept
+            const char *cacheFile = xmlCol->Attribute("CACHE");
+            m_cacheFile = (cacheFile ? string(cacheFile) : "");
+
             const char *defaultImpl = xmlCol->Attribute("DEFAULT");
             m_defaultType = defaultType;
 
@@ -142,6 +271,11 @@ CollectionOptimisation::CollectionOptimisation(
                 const std::string collinfo = string(defaultImpl);
                 m_autotune = boost::iequals(collinfo, "auto");
 
+                if (m_autotune && !m_cacheFile.empty())
+                {
+                    ReadCache();
+                }
+
                 if (!m_autotune)
                 {
                     for(i = 1; i < Collections::SIZE_ImplementationType; ++i)
@@ -318,6 +452,28 @@ OperatorImpMap  CollectionOptimisation::GetOperatorImpMap(
     return ret;
 }
 
+/**
+ * Returns the number of elements of the blocks in which collections are
+ * processed. The blocks are the same whether or not NUMTHREADS has been set,
+ * so that threaded and serial runs give bitwise identical results. The size
+ * is taken from the BLOCKSIZE attribute of the COLLECTIONS tag if given, and
+ * otherwise chosen so that the coefficients, physical values and derivatives
+ * of one block occupy roughly kBlockBytes.
+ */
+unsigned int CollectionOptimisation::GetBlockSize(
+        StdRegions::StdExpansionSharedPtr pExp)
+{
+    if (m_blockSize > 0)
+    {
+        return m_blockSize;
+    }
+
+    unsigned int elmtBytes = sizeof(NekDouble) * (pExp->GetNcoeffs() +
+        (pExp->GetShapeDimension() + 1) * pExp->GetTotPoints());
+
+    return max(1u, kBlockBytes / elmtBytes);
+}
+
 OperatorImpMap CollectionOptimisation::SetWithTimings(
         vector<StdRegions::StdExpansionSharedPtr> pCollExp,
         OperatorImpMap &impTypes,
@@ -327,8 +483,19 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
 
     StdRegions::StdExpansionSharedPtr pExp = pCollExp[0];
 
-    // check to see if already defined for this expansion
+    // check to see if already defined for this expansion, either across all
+    // processes or by the cache file, or else locally
     OpImpTimingKey OpKey(pExp,pCollExp.size(),pExp->GetNumBases());
+    vector<int>    keyIds = GetTimingKeyIds(OpKey);
+    string         keyStr = GetTimingKeyString(keyIds);
+
+    map<string, OperatorImpMap>::iterator agreedIt =
+                                            m_agreedImpMap.find(keyStr);
+    if (agreedIt != m_agreedImpMap.end())
+    {
+        return agreedIt->second;
+    }
+
     if(m_opImpMap.count(OpKey) != 0)
     {
         ret = m_opImpMap[OpKey];
@@ -340,6 +507,7 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
     Array<OneD, NekDouble> outarray1(maxsize);
     Array<OneD, NekDouble> outarray2(maxsize);
     Array<OneD, NekDouble> outarray3(maxsize);
+    Array<OneD, NekDouble> outarray4(maxsize);
 
     Timer t;
 
@@ -385,12 +553,38 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
     {
         OperatorType OpType = (OperatorType)i;
 
+        // Not every implementation provides every operator, so time the
+        // first one which does.
+        int first = 0;
+        while (first < coll.size() && !coll[first].HasOperator(OpType))
+        {
+            ++first;
+        }
+        if (first == coll.size())
+        {
+            Ntest[i] = 1;
+            continue;
+        }
+
         t.Start();
-        coll[0].ApplyOperator(OpType,
-                           inarray,
-                           outarray1,
-                           outarray2,
-                           outarray3);
+        if (OpType == eBwdTransPhysDeriv)
+        {
+            // Fused operator needs a fourth output for 3D derivatives
+            coll[first].ApplyOperator(OpType,
+                               inarray,
+                               outarray1,
+                               outarray2,
+                               outarray3,
+                               outarray4);
+        }
+        else
+        {
+            coll[first].ApplyOperator(OpType,
+                               inarray,
+                               outarray1,
+                               outarray2,
+                               outarray3);
+        }
         t.Stop();
 
         NekDouble oneTest = t.TimePerTest(1);
@@ -399,6 +593,7 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
     }
 
     Array<OneD, NekDouble> timing(SIZE_ImplementationType);
+    vector<NekDouble>      allTimings(SIZE_OperatorType*coll.size());
     // loop over all operators and determine fastest implementation
     for(int i = 0; i < SIZE_OperatorType; ++i)
     {
@@ -412,11 +607,23 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
                 t.Start();
                 for(int n = 0; n < Ntest[i]; ++n)
                 {
-                    coll[imp].ApplyOperator(OpType,
-                                      inarray,
-                                      outarray1,
-                                      outarray2,
-                                      outarray3);
+                    if (OpType == eBwdTransPhysDeriv)
+                    {
+                        coll[imp].ApplyOperator(OpType,
+                                          inarray,
+                                          outarray1,
+                                          outarray2,
+                                          outarray3,
+                                          outarray4);
+                    }
+                    else
+                    {
+                        coll[imp].ApplyOperator(OpType,
+                                          inarray,
+                                          outarray1,
+                                          outarray2,
+                                          outarray3);
+                    }
                 }
                 t.Stop();
                 timing[imp] = t.TimePerTest(Ntest[i]);
@@ -425,6 +632,7 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
             {
                 timing[imp] = 1000.0;
             }
+            allTimings[i*coll.size() + imp] = timing[imp];
         }
         // determine optimal implementation. Note +1 to
         // remove NoImplementationType flag
@@ -457,10 +665,267 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
         ret[OpType] = (ImplementationType)minImp;
     }
 
-    // store map for use by another expansion.
-    m_opImpMap[OpKey] = ret;
+    // store map for use by another expansion, and the timings for
+    // agreement with other processes.
+    m_opImpMap[OpKey]      = ret;
+    m_localTimings[keyIds] = allTimings;
     return ret;
 }
 
+/**
+ * Shares the autotuning timings gathered on each process since the last call
+ * and selects, for each expansion, the implementation of each operator with
+ * the smallest total time over the processes which timed it. All processes
+ * therefore use the same implementations, which are returned by subsequent
+ * calls to SetWithTimings. The selections are also written to the cache file
+ * if one was given with the CACHE attribute of the COLLECTIONS tag.
+ *
+ * This is a collective operation over the session communicator, and so must
+ * be called by all processes at the same point, once their fields have been
+ * set up. Only reductions of fixed size arrays of numeric keys and timings
+ * are used, so that processes which timed different expansions still make
+ * the same calls.
+ *
+ * @return true if any process performed new timings, in which case the
+ * collections set up with the local selections should be recreated.
+ */
+bool CollectionOptimisation::SynchroniseTimings()
+{
+    int i, j;
+    const int nProc = m_comm ? m_comm->GetSize() : 1;
+    const int rank  = m_comm ? m_comm->GetRank() : 0;
+    const int nImp  = SIZE_ImplementationType - 1;
+    const int nTime = SIZE_OperatorType * nImp;
+
+    // Count the expansions timed on each process.
+    Array<OneD, int> nLocal(nProc, 0);
+    nLocal[rank] = m_localTimings.size();
+    if (m_comm)
+    {
+        m_comm->AllReduce(nLocal, LibUtilities::ReduceSum);
+    }
+
+    const int nTotal = accumulate(nLocal.begin(), nLocal.end(), 0);
+    const int offset = accumulate(nLocal.begin(), nLocal.begin() + rank, 0);
+
+    if (nTotal == 0)
+    {
+        return false;
+    }
+
+    // Gather the keys of all processes, to give the same sorted set of
+    // expansions everywhere.
+    Array<OneD, int> keyBuf(nTotal * kTimingKeyLen, 0);
+    map<vector<int>, vector<NekDouble> >::iterator it;
+    for (i = offset, it = m_localTimings.begin();
+         it != m_localTimings.end(); ++it, ++i)
+    {
+        copy(it->first.begin(), it->first.end(),
+             keyBuf.begin() + i * kTimingKeyLen);
+    }
+    if (m_comm)
+    {
+        m_comm->AllReduce(keyBuf, LibUtilities::ReduceSum);
+    }
+
+    set<vector<int> > keySet;
+    for (i = 0; i < nTotal; ++i)
+    {
+        keySet.insert(vector<int>(keyBuf.begin() +  i    * kTimingKeyLen,
+                                  keyBuf.begin() + (i+1) * kTimingKeyLen));
+    }
+    vector<vector<int> > keys(keySet.begin(), keySet.end());
+
+    // Sum the timings of each expansion over all processes, stored by
+    // operator and then implementation.
+    Array<OneD, NekDouble> timings(keys.size() * nTime, 0.0);
+    for (i = 0; i < keys.size(); ++i)
+    {
+        it = m_localTimings.find(keys[i]);
+        if (it != m_localTimings.end())
+        {
+            ASSERTL1(it->second.size() == nTime,
+                     "Unexpected number of autotuning timings.");
+            Vmath::Vcopy(nTime, &it->second[0], 1, &timings[i * nTime], 1);
+        }
+    }
+    m_localTimings.clear();
+
+    if (m_comm)
+    {
+        m_comm->AllReduce(timings, LibUtilities::ReduceSum);
+    }
+
+    // Select the fastest implementation of each operator.
+    for (i = 0; i < keys.size(); ++i)
+    {
+        OperatorImpMap impMap;
+        for (j = 0; j < SIZE_OperatorType; ++j)
+        {
+            // Note +1 to remove NoImplementationType flag
+            int minImp = Vmath::Imin(nImp, &timings[i*nTime + j*nImp], 1);
+            impMap[(OperatorType)j] = (ImplementationType)(minImp + 1);
+        }
+        m_agreedImpMap[GetTimingKeyString(keys[i])] = impMap;
+    }
+
+    if (!m_cacheFile.empty() && rank == 0)
+    {
+        WriteCache();
+    }
+
+    return true;
+}
+
+/**
+ * Reads the implementations selected by previous runs on the same type of
+ * machine from the cache file. A missing file is not an error, since it is
+ * created once the first selections have been made.
+ */
+void CollectionOptimisation::ReadCache()
+{
+    if (m_cacheRead)
+    {
+        return;
+    }
+    m_cacheRead = true;
+
+    TiXmlDocument doc(m_cacheFile);
+    if (!doc.LoadFile())
+    {
+        return;
+    }
+
+    TiXmlHandle   docHandle(&doc);
+    TiXmlElement *cache = docHandle.FirstChildElement("NEKTAR")
+                                   .FirstChildElement("COLLECTIONCACHE")
+                                   .Element();
+    ASSERTL0(cache, "Unable to find COLLECTIONCACHE tag in file "
+                    + m_cacheFile + ".");
+
+    map<string, OperatorType>       opTypes;
+    map<string, ImplementationType> impTypes;
+    int i;
+    for (i = 0; i < SIZE_OperatorType; ++i)
+    {
+        opTypes[OperatorTypeMap[i]] = (OperatorType)i;
+    }
+    for (i = 1; i < SIZE_ImplementationType; ++i)
+    {
+        impTypes[ImplementationTypeMap[i]] = (ImplementationType)i;
+    }
+
+    const string machine = GetMachineFingerprint();
+
+    TiXmlElement *mach = cache->FirstChildElement("MACHINE");
+    for (; mach; mach = mach->NextSiblingElement("MACHINE"))
+    {
+        const char *id = mach->Attribute("ID");
+        if (!id || machine != id)
+        {
+            continue;
+        }
+
+        TiXmlElement *exp = mach->FirstChildElement("EXPANSION");
+        for (; exp; exp = exp->NextSiblingElement("EXPANSION"))
+        {
+            const char *key = exp->Attribute("KEY");
+            ASSERTL0(key, "Missing KEY in EXPANSION tag.");
+
+            OperatorImpMap impMap;
+            TiXmlElement *op = exp->FirstChildElement("OPERATOR");
+            for (; op; op = op->NextSiblingElement("OPERATOR"))
+            {
+                const char *type = op->Attribute("TYPE");
+                const char *imp  = op->Attribute("IMPTYPE");
+                ASSERTL0(type && imp,
+                         "Missing TYPE or IMPTYPE in OPERATOR tag.");
+
+                if (opTypes.count(type) && impTypes.count(imp))
+                {
+                    impMap[opTypes[type]] = impTypes[imp];
+                }
+            }
+
+            // Only use complete entries, so that expansions are tuned again
+            // when new operators or implementations are added.
+            if (impMap.size() == SIZE_OperatorType)
+            {
+                m_agreedImpMap[key] = impMap;
+            }
+        }
+    }
+}
+
+/**
+ * Writes the implementations selected on this type of machine to the cache
+ * file, keeping the entries of other machines. The file is written under a
+ * temporary name first, so that other jobs never read a partial file.
+ */
+void CollectionOptimisation::WriteCache()
+{
+    const string machine = GetMachineFingerprint();
+
+    TiXmlDocument doc(m_cacheFile);
+    if (!doc.LoadFile())
+    {
+        doc.Clear();
+        doc.LinkEndChild(new TiXmlDeclaration("1.0", "utf-8", ""));
+    }
+
+    TiXmlElement *root = doc.FirstChildElement("NEKTAR");
+    if (!root)
+    {
+        root = new TiXmlElement("NEKTAR");
+        doc.LinkEndChild(root);
+    }
+
+    TiXmlElement *cache = root->FirstChildElement("COLLECTIONCACHE");
+    if (!cache)
+    {
+        cache = new TiXmlElement("COLLECTIONCACHE");
+        root->LinkEndChild(cache);
+    }
+
+    // Replace the entries of this machine.
+    TiXmlElement *mach = cache->FirstChildElement("MACHINE");
+    while (mach)
+    {
+        TiXmlElement *next = mach->NextSiblingElement("MACHINE");
+        const char   *id   = mach->Attribute("ID");
+        if (id && machine == id)
+        {
+            cache->RemoveChild(mach);
+        }
+        mach = next;
+    }
+
+    mach = new TiXmlElement("MACHINE");
+    mach->SetAttribute("ID", machine);
+    cache->LinkEndChild(mach);
+
+    map<string, OperatorImpMap>::iterator it;
+    for (it = m_agreedImpMap.begin(); it != m_agreedImpMap.end(); ++it)
+    {
+        TiXmlElement *exp = new TiXmlElement("EXPANSION");
+        exp->SetAttribute("KEY", it->first);
+        mach->LinkEndChild(exp);
+
+        OperatorImpMap::iterator opIt;
+        for (opIt = it->second.begin(); opIt != it->second.end(); ++opIt)
+        {
+            TiXmlElement *op = new TiXmlElement("OPERATOR");
+            op->SetAttribute("TYPE",    OperatorTypeMap[opIt->first]);
+            op->SetAttribute("IMPTYPE", ImplementationTypeMap[opIt->second]);
+            exp->LinkEndChild(op);
+        }
+    }
+
+    string tmpFile = m_cacheFile + ".tmp";
+    ASSERTL0(doc.SaveFile(tmpFile),
+             "Unable to write collection cache file " + m_cacheFile + ".");
+    boost::filesystem::rename(tmpFile, m_cacheFile);
+}
+
 }
 }
@@ -136,6 +136,10 @@ class CollectionOptimisation
             return m_autotune;
         }
 
+        /// Get the number of elements per block of a collection
+        COLLECTIONS_EXPORT unsigned int GetBlockSize(
+                StdRegions::StdExpansionSharedPtr pExp);
+
         /// Get Operator Implementation Map from XMl or using default;
         COLLECTIONS_EXPORT OperatorImpMap  GetOperatorImpMap(
                 StdRegions::StdExpansionSharedPtr pExp);
@@ -151,15 +155,30 @@ class CollectionOptimisation
             return m_setByXml;
         }
 
+        /// Agree on autotuned implementations across all processes
+        COLLECTIONS_EXPORT bool SynchroniseTimings();
+
     private:
         typedef std::pair<LibUtilities::ShapeType, int> ElmtOrder;
 
         static std::map<OpImpTimingKey,OperatorImpMap> m_opImpMap;
+        /// Implementations agreed across processes or read from the cache
+        static std::map<std::string, OperatorImpMap> m_agreedImpMap;
+        /// Local autotuning timings not yet shared with other processes
+        static std::map<std::vector<int>, std::vector<NekDouble> >
+                                                        m_localTimings;
+        static bool m_cacheRead;
         std::map<OperatorType, std::map<ElmtOrder, ImplementationType> > m_global;
         bool m_setByXml;
         bool m_autotune;
         ImplementationType m_defaultType;
         unsigned int m_maxCollSize;
+        unsigned int m_blockSize;
+        LibUtilities::CommSharedPtr m_comm;
+        std::string m_cacheFile;
+
+        void ReadCache();
+        void WriteCache();
 };
 
 }
@@ -37,6 +37,7 @@
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
 #include <Collections/IProduct.h>
+#include <Collections/SumFacKernels.h>
 
 using namespace std;
 
@@ -451,6 +452,13 @@ class IProductWRTBase_SumFac_Quad : public Operator
             ASSERTL1(wsp.num_elements() == m_wspSize,
                      "Incorrect workspace size");
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_jac.get(), input.get(), output.get());
+                return;
+            }
+
             QuadIProduct(m_colldir0,m_colldir1,m_numElmt,
                          m_nquad0,  m_nquad1,
                          m_nmodes0, m_nmodes1,
@@ -477,6 +485,7 @@ class IProductWRTBase_SumFac_Quad : public Operator
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
+        QuadIProductKernel              m_kernel;
 
     private:
         IProductWRTBase_SumFac_Quad(
@@ -495,6 +504,9 @@ class IProductWRTBase_SumFac_Quad : public Operator
             m_jac     = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize = 2 * m_numElmt
                           * (max(m_nquad0*m_nquad1,m_nmodes0*m_nmodes1));
+            m_kernel  = (m_colldir0 || m_colldir1) ? 0 :
+                GetQuadIProductKernel(m_nmodes0, m_nmodes1,
+                                      m_nquad0,  m_nquad1);
         }
 };
 
@@ -608,6 +620,14 @@ class IProductWRTBase_SumFac_Hex : public Operator
             ASSERTL1(wsp.num_elements() == m_wspSize,
                      "Incorrect workspace size");
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_base2.get(), m_jac.get(), input.get(),
+                         output.get());
+                return;
+            }
+
             HexIProduct(m_colldir0,m_colldir1,m_colldir2, m_numElmt,
                         m_nquad0,  m_nquad1,  m_nquad2,
                         m_nmodes0, m_nmodes1, m_nmodes2,
@@ -638,6 +658,7 @@ class IProductWRTBase_SumFac_Hex : public Operator
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
+        HexIProductKernel               m_kernel;
 
     private:
         IProductWRTBase_SumFac_Hex(
@@ -661,6 +682,9 @@ class IProductWRTBase_SumFac_Hex : public Operator
             m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize = 3 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                              m_nmodes0*m_nmodes1*m_nmodes2));
+            m_kernel  = (m_colldir0 || m_colldir1 || m_colldir2) ? 0 :
+                GetHexIProductKernel(m_nmodes0, m_nmodes1, m_nmodes2,
+                                     m_nquad0,  m_nquad1,  m_nquad2);
         }
 };
 
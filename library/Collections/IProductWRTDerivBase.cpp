@@ -37,6 +37,7 @@
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
 #include <Collections/IProduct.h>
+#include <Collections/SumFacKernels.h>
 
 using namespace std;
 
@@ -610,19 +611,29 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
                 }
             }
 
-            // Iproduct wrt derivative of base 0
-            QuadIProduct(false, m_colldir1,m_numElmt,
-                         m_nquad0,   m_nquad1,
-                         m_nmodes0,  m_nmodes1,
-                         m_derbase0, m_base1,
-                         m_jac, tmp[0], output, wsp1);
-
-            // Iproduct wrt derivative of base 1
-            QuadIProduct(m_colldir0, false, m_numElmt,
-                         m_nquad0,   m_nquad1,
-                         m_nmodes0,  m_nmodes1,
-                         m_base0, m_derbase1,
-                         m_jac, tmp[1],  tmp[0], wsp1);
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_derbase0.get(), m_base1.get(),
+                         m_jac.get(), tmp[0].get(), output.get());
+                m_kernel(m_numElmt, m_base0.get(), m_derbase1.get(),
+                         m_jac.get(), tmp[1].get(), tmp[0].get());
+            }
+            else
+            {
+                // Iproduct wrt derivative of base 0
+                QuadIProduct(false, m_colldir1,m_numElmt,
+                             m_nquad0,   m_nquad1,
+                             m_nmodes0,  m_nmodes1,
+                             m_derbase0, m_base1,
+                             m_jac, tmp[0], output, wsp1);
+
+                // Iproduct wrt derivative of base 1
+                QuadIProduct(m_colldir0, false, m_numElmt,
+                             m_nquad0,   m_nquad1,
+                             m_nmodes0,  m_nmodes1,
+                             m_base0, m_derbase1,
+                             m_jac, tmp[1],  tmp[0], wsp1);
+            }
 
             Vmath::Vadd(m_numElmt*nmodes,tmp[0],1,output,1,output,1);
         }
@@ -650,6 +661,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<OneD, const NekDouble>    m_derbase1;
+        QuadIProductKernel              m_kernel;
 
     private:
         IProductWRTDerivBase_SumFac_Quad(
@@ -674,6 +686,9 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
+            m_kernel   = (m_colldir0 || m_colldir1) ? 0 :
+                GetQuadIProductKernel(m_nmodes0, m_nmodes1,
+                                      m_nquad0,  m_nquad1);
         }
 };
 
@@ -933,6 +948,22 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
 
             wsp1   = wsp + 3*nmax;
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_derbase0.get(), m_base1.get(),
+                         m_base2.get(), m_jac.get(), tmp[0].get(),
+                         output.get());
+                m_kernel(m_numElmt, m_base0.get(), m_derbase1.get(),
+                         m_base2.get(), m_jac.get(), tmp[1].get(),
+                         tmp[0].get());
+                Vmath::Vadd(m_numElmt*nmodes,tmp[0],1,output,1,output,1);
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_derbase2.get(), m_jac.get(), tmp[2].get(),
+                         tmp[0].get());
+                Vmath::Vadd(m_numElmt*nmodes,tmp[0],1,output,1,output,1);
+                return;
+            }
+
             // calculate Iproduct WRT Std Deriv
             HexIProduct(false,m_colldir1,m_colldir2, m_numElmt,
                         m_nquad0,   m_nquad1,  m_nquad2,
@@ -982,6 +1013,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
         Array<TwoD, const NekDouble>    m_derivFac;
+        HexIProductKernel               m_kernel;
 
     private:
         IProductWRTDerivBase_SumFac_Hex(
@@ -1009,6 +1041,9 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_kernel   = (m_colldir0 || m_colldir1 || m_colldir2) ? 0 :
+                GetHexIProductKernel(m_nmodes0, m_nmodes1, m_nmodes2,
+                                     m_nquad0,  m_nquad1,  m_nquad2);
         }
 };
 
@@ -96,6 +96,22 @@ std::ostream &operator<<(std::ostream &os, OperatorKey const &p)
 }
 
 
+/**
+ * Only operators producing more than three outputs, such as the fused
+ * backward transform and derivative, override this method.
+ */
+void Operator::operator()(
+        const Array<OneD, const NekDouble> &input,
+              Array<OneD,       NekDouble> &output0,
+              Array<OneD,       NekDouble> &output1,
+              Array<OneD,       NekDouble> &output2,
+              Array<OneD,       NekDouble> &output3,
+              Array<OneD,       NekDouble> &wsp)
+{
+    ASSERTL0(false, "Not valid for this operator.");
+}
+
+
 /**
  *
  */
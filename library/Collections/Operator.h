@@ -67,6 +67,7 @@ enum OperatorType
     eIProductWRTBase,
     eIProductWRTDerivBase,
     ePhysDeriv,
+    eBwdTransPhysDeriv,
     SIZE_OperatorType
 };
 
@@ -75,7 +76,8 @@ const char* const OperatorTypeMap[] =
     "BwdTrans",
     "IProductWRTBase",
     "IProductWRTDerivBase",
-    "PhysDeriv"
+    "PhysDeriv",
+    "BwdTransPhysDeriv"
 };
 
 enum ImplementationType
@@ -85,6 +87,7 @@ enum ImplementationType
     eIterPerExp,
     eStdMat,
     eSumFac,
+    eSumFacInterleaved,
     SIZE_ImplementationType
 };
 
@@ -94,7 +97,8 @@ const char* const ImplementationTypeMap[] =
     "NoCollection",
     "IterPerExp",
     "StdMat",
-    "SumFac"
+    "SumFac",
+    "SumFacInterleaved"
 };
 
 typedef bool ExpansionIsNodal;
@@ -134,6 +138,15 @@ class Operator
                       Array<OneD,       NekDouble> &wsp
                                                     = NullNekDouble1DArray) = 0;
 
+        /// Perform operation with four outputs
+        COLLECTIONS_EXPORT virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &output3,
+                      Array<OneD,       NekDouble> &wsp);
+
         COLLECTIONS_EXPORT virtual ~Operator();
 
         /// Get the size of the required workspace
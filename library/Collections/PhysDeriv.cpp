@@ -36,6 +36,7 @@
 #include <loki/Singleton.h>
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacKernels.h>
 
 using namespace std;
 
@@ -631,18 +632,26 @@ class PhysDeriv_SumFac_Quad : public Operator
             Array<OneD, NekDouble> diff0(nqcol, wsp             );
             Array<OneD, NekDouble> diff1(nqcol, wsp    +   nqcol);
 
-            Blas::Dgemm('N', 'N', m_nquad0, m_nquad1*m_numElmt,
-                        m_nquad0, 1.0, m_Deriv0, m_nquad0,
-                        input.get(), m_nquad0, 0.0,
-                        diff0.get(), m_nquad0);
-
-            int cnt = 0;
-            for (int i = 0; i < m_numElmt; ++i, cnt += nqtot)
+            if (m_kernel)
             {
-                Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1, 1.0,
-                            input.get() + cnt, m_nquad0,
-                            m_Deriv1, m_nquad1, 0.0,
-                            diff1.get() + cnt, m_nquad0);
+                m_kernel(m_numElmt, m_Deriv0, m_Deriv1, input.get(),
+                         diff0.get(), diff1.get());
+            }
+            else
+            {
+                Blas::Dgemm('N', 'N', m_nquad0, m_nquad1*m_numElmt,
+                            m_nquad0, 1.0, m_Deriv0, m_nquad0,
+                            input.get(), m_nquad0, 0.0,
+                            diff0.get(), m_nquad0);
+
+                int cnt = 0;
+                for (int i = 0; i < m_numElmt; ++i, cnt += nqtot)
+                {
+                    Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1, 1.0,
+                                input.get() + cnt, m_nquad0,
+                                m_Deriv1, m_nquad1, 0.0,
+                                diff1.get() + cnt, m_nquad0);
+                }
             }
 
             Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
@@ -677,18 +686,26 @@ class PhysDeriv_SumFac_Quad : public Operator
             Array<OneD, NekDouble> diff0(nqcol, wsp             );
             Array<OneD, NekDouble> diff1(nqcol, wsp    +   nqcol);
 
-            Blas::Dgemm('N', 'N', m_nquad0, m_nquad1*m_numElmt,
-                        m_nquad0, 1.0, m_Deriv0, m_nquad0,
-                        input.get(), m_nquad0, 0.0,
-                        diff0.get(), m_nquad0);
-
-            int cnt = 0;
-            for (int i = 0; i < m_numElmt; ++i, cnt += nqtot)
+            if (m_kernel)
             {
-                Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1, 1.0,
-                            input.get() + cnt, m_nquad0,
-                            m_Deriv1, m_nquad1, 0.0,
-                            diff1.get() + cnt, m_nquad0);
+                m_kernel(m_numElmt, m_Deriv0, m_Deriv1, input.get(),
+                         diff0.get(), diff1.get());
+            }
+            else
+            {
+                Blas::Dgemm('N', 'N', m_nquad0, m_nquad1*m_numElmt,
+                            m_nquad0, 1.0, m_Deriv0, m_nquad0,
+                            input.get(), m_nquad0, 0.0,
+                            diff0.get(), m_nquad0);
+
+                int cnt = 0;
+                for (int i = 0; i < m_numElmt; ++i, cnt += nqtot)
+                {
+                    Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1, 1.0,
+                                input.get() + cnt, m_nquad0,
+                                m_Deriv1, m_nquad1, 0.0,
+                                diff1.get() + cnt, m_nquad0);
+                }
             }
 
             Vmath::Vmul  (nqcol, m_derivFac[2*dir]  , 1, diff0, 1, output, 1);
@@ -703,6 +720,7 @@ class PhysDeriv_SumFac_Quad : public Operator
         Array<TwoD, const NekDouble>    m_derivFac;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
+        QuadPhysDerivKernel             m_kernel;
 
     private:
         PhysDeriv_SumFac_Quad(
@@ -720,6 +738,7 @@ class PhysDeriv_SumFac_Quad : public Operator
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
             m_wspSize = 2 * m_nquad0*m_nquad1*m_numElmt;
+            m_kernel  = GetQuadPhysDerivKernel(m_nquad0, m_nquad1);
         }
 };
 
@@ -943,25 +962,34 @@ class PhysDeriv_SumFac_Hex : public Operator
                 Diff[i] = wsp + i*ntot;
             }
 
-            Blas::Dgemm('N','N', m_nquad0,m_nquad1*m_nquad2*m_numElmt,
-                        m_nquad0,1.0, m_Deriv0,m_nquad0,&input[0],
-                        m_nquad0,0.0,&Diff[0][0],m_nquad0);
-
-            for(int  i = 0; i < m_numElmt; ++i)
+            if (m_kernel)
             {
-                for (int j = 0; j < m_nquad2; ++j)
+                m_kernel(m_numElmt, m_Deriv0, m_Deriv1, m_Deriv2,
+                         input.get(), Diff[0].get(), Diff[1].get(),
+                         Diff[2].get());
+            }
+            else
+            {
+                Blas::Dgemm('N','N', m_nquad0,m_nquad1*m_nquad2*m_numElmt,
+                            m_nquad0,1.0, m_Deriv0,m_nquad0,&input[0],
+                            m_nquad0,0.0,&Diff[0][0],m_nquad0);
+
+                for(int  i = 0; i < m_numElmt; ++i)
                 {
-                    Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1,
-                                1.0, &input[i*nPhys+j*m_nquad0*m_nquad1],
-                                m_nquad0, m_Deriv1, m_nquad1, 0.0,
-                                &Diff[1][i*nPhys+j*m_nquad0*m_nquad1],
-                                m_nquad0);
-                }
+                    for (int j = 0; j < m_nquad2; ++j)
+                    {
+                        Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1,
+                                    1.0, &input[i*nPhys+j*m_nquad0*m_nquad1],
+                                    m_nquad0, m_Deriv1, m_nquad1, 0.0,
+                                    &Diff[1][i*nPhys+j*m_nquad0*m_nquad1],
+                                    m_nquad0);
+                    }
 
-                Blas::Dgemm('N','T',m_nquad0*m_nquad1,m_nquad2,m_nquad2,
-                            1.0, &input[i*nPhys],m_nquad0*m_nquad1,
-                            m_Deriv2,m_nquad2, 0.0,&Diff[2][i*nPhys],
-                            m_nquad0*m_nquad1);
+                    Blas::Dgemm('N','T',m_nquad0*m_nquad1,m_nquad2,m_nquad2,
+                                1.0, &input[i*nPhys],m_nquad0*m_nquad1,
+                                m_Deriv2,m_nquad2, 0.0,&Diff[2][i*nPhys],
+                                m_nquad0*m_nquad1);
+                }
             }
 
             // calculate full derivative
@@ -994,25 +1022,34 @@ class PhysDeriv_SumFac_Hex : public Operator
                 Diff[i] = wsp + i*ntot;
             }
 
-            Blas::Dgemm('N','N', m_nquad0,m_nquad1*m_nquad2*m_numElmt,
-                        m_nquad0,1.0, m_Deriv0,m_nquad0,&input[0],
-                        m_nquad0,0.0,&Diff[0][0],m_nquad0);
-
-            for(int  i = 0; i < m_numElmt; ++i)
+            if (m_kernel)
             {
-                for (int j = 0; j < m_nquad2; ++j)
+                m_kernel(m_numElmt, m_Deriv0, m_Deriv1, m_Deriv2,
+                         input.get(), Diff[0].get(), Diff[1].get(),
+                         Diff[2].get());
+            }
+            else
+            {
+                Blas::Dgemm('N','N', m_nquad0,m_nquad1*m_nquad2*m_numElmt,
+                            m_nquad0,1.0, m_Deriv0,m_nquad0,&input[0],
+                            m_nquad0,0.0,&Diff[0][0],m_nquad0);
+
+                for(int  i = 0; i < m_numElmt; ++i)
                 {
-                    Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1,
-                                1.0, &input[i*nPhys+j*m_nquad0*m_nquad1],
-                                m_nquad0, m_Deriv1, m_nquad1, 0.0,
-                                &Diff[1][i*nPhys+j*m_nquad0*m_nquad1],
-                                m_nquad0);
-                }
+                    for (int j = 0; j < m_nquad2; ++j)
+                    {
+                        Blas::Dgemm('N', 'T', m_nquad0, m_nquad1, m_nquad1,
+                                    1.0, &input[i*nPhys+j*m_nquad0*m_nquad1],
+                                    m_nquad0, m_Deriv1, m_nquad1, 0.0,
+                                    &Diff[1][i*nPhys+j*m_nquad0*m_nquad1],
+                                    m_nquad0);
+                    }
 
-                Blas::Dgemm('N','T',m_nquad0*m_nquad1,m_nquad2,m_nquad2,
-                            1.0, &input[i*nPhys],m_nquad0*m_nquad1,
-                            m_Deriv2,m_nquad2, 0.0,&Diff[2][i*nPhys],
-                            m_nquad0*m_nquad1);
+                    Blas::Dgemm('N','T',m_nquad0*m_nquad1,m_nquad2,m_nquad2,
+                                1.0, &input[i*nPhys],m_nquad0*m_nquad1,
+                                m_Deriv2,m_nquad2, 0.0,&Diff[2][i*nPhys],
+                                m_nquad0*m_nquad1);
+                }
             }
 
             // calculate full derivative
@@ -1035,6 +1072,7 @@ class PhysDeriv_SumFac_Hex : public Operator
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
         NekDouble                      *m_Deriv2;
+        HexPhysDerivKernel              m_kernel;
 
     private:
         PhysDeriv_SumFac_Hex(
@@ -1056,6 +1094,7 @@ class PhysDeriv_SumFac_Hex : public Operator
             m_Deriv2 = &((m_stdExp->GetBasis(2)->GetD())->GetPtr())[0];
 
             m_wspSize = 3*m_nquad0*m_nquad1*m_nquad2*m_numElmt;
+            m_kernel  = GetHexPhysDerivKernel(m_nquad0, m_nquad1, m_nquad2);
         }
 };
 
@@ -0,0 +1,701 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacInterleaved.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sum-factorisation operators on element-interleaved data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <loki/Singleton.h>
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eHexahedron;
+
+// Number of elements processed together by the interleaved operators. This
+// matches the number of doubles held in the widest vector register the
+// compiler targets, as selected with the NEKTAR_ENABLE_AVX and
+// NEKTAR_ENABLE_AVX512 build options, so that the innermost loops below map
+// onto single vector instructions.
+#if defined(__AVX512F__)
+static const int kVecWidth = 8;
+#elif defined(__AVX__)
+static const int kVecWidth = 4;
+#else
+static const int kVecWidth = 2;
+#endif
+
+/**
+ * @brief Copies elements @p elmt to @p elmt + kVecWidth - 1 of @p in, each
+ * holding @p n values, into interleaved order so that out[i*kVecWidth + w]
+ * holds value i of element @p elmt + w. Lanes beyond the last element of the
+ * collection are filled with zeros.
+ */
+static void Interleave(
+    int n, int elmt, int numElmt, const NekDouble *in, NekDouble *out)
+{
+    const int nlane = min(kVecWidth, numElmt - elmt);
+
+    for (int w = 0; w < nlane; ++w)
+    {
+        const NekDouble *src = in + (elmt + w)*n;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i*kVecWidth + w] = src[i];
+        }
+    }
+
+    for (int w = nlane; w < kVecWidth; ++w)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            out[i*kVecWidth + w] = 0.0;
+        }
+    }
+}
+
+/**
+ * @brief Reverses Interleave, copying the valid lanes of @p in back to
+ * elements @p elmt onwards of @p out.
+ */
+static void Deinterleave(
+    int n, int elmt, int numElmt, const NekDouble *in, NekDouble *out)
+{
+    const int nlane = min(kVecWidth, numElmt - elmt);
+
+    for (int w = 0; w < nlane; ++w)
+    {
+        NekDouble *dst = out + (elmt + w)*n;
+        for (int i = 0; i < n; ++i)
+        {
+            dst[i] = in[i*kVecWidth + w];
+        }
+    }
+}
+
+/**
+ * @brief Applies a matrix along one direction of interleaved tensor-product
+ * data.
+ *
+ * The input is viewed as an n0 x ni x n2 array (n0 fastest) of kVecWidth
+ * lanes and the middle index is contracted to give the n0 x nj x n2 array
+ * out(a,j,c) = sum_i M(j,i) in(a,i,c). The matrix is stored column major with
+ * M(j,i) = mat[i*nj + j], or transposed with M(j,i) = mat[j*ni + i], which
+ * covers both the basis and derivative matrices of LibUtilities::Basis.
+ */
+static void Contract(
+    int n0, int ni, int nj, int n2, const NekDouble *mat, bool trans,
+    const NekDouble *in, NekDouble *out)
+{
+    for (int c = 0; c < n2; ++c)
+    {
+        for (int j = 0; j < nj; ++j)
+        {
+            NekDouble *o = out + (c*nj + j)*n0*kVecWidth;
+
+            for (int a = 0; a < n0*kVecWidth; ++a)
+            {
+                o[a] = 0.0;
+            }
+
+            for (int i = 0; i < ni; ++i)
+            {
+                const NekDouble  m = trans ? mat[j*ni + i] : mat[i*nj + j];
+                const NekDouble *s = in + (c*ni + i)*n0*kVecWidth;
+
+                for (int a = 0; a < n0; ++a)
+                {
+                    for (int w = 0; w < kVecWidth; ++w)
+                    {
+                        o[a*kVecWidth + w] += m * s[a*kVecWidth + w];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Base class for the sum-factorisation operators acting on
+ * element-interleaved data.
+ *
+ * Rather than processing one element at a time, these operators gather
+ * kVecWidth elements of the collection into an interleaved block, in which
+ * the element index runs fastest, and apply the tensor-product contractions
+ * to the whole block at once. Every arithmetic operation is then applied to
+ * kVecWidth independent elements and vectorises without any shuffling. The
+ * input is interleaved and the output de-interleaved on entry and exit of
+ * each operator, so the layout is not visible outside the operator.
+ * Geometric factors are stored in interleaved form on construction.
+ *
+ * This is aimed at large collections of identical tensor-product elements,
+ * where the per-element BLAS calls of the SumFac operators are too small to
+ * run efficiently.
+ */
+class SumFacInterleaved_Helper : public Operator
+{
+    public:
+        virtual ~SumFacInterleaved_Helper()
+        {
+        }
+
+    protected:
+        SumFacInterleaved_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator (pCollExp, pGeomData),
+              m_dim    (pCollExp[0]->GetShapeDimension()),
+              m_coordim(pCollExp[0]->GetCoordim()),
+              m_nCoeffs(pCollExp[0]->GetNcoeffs()),
+              m_nPhys  (pCollExp[0]->GetTotPoints()),
+              m_maxSize(1)
+        {
+            for (int d = 0; d < m_dim; ++d)
+            {
+                LibUtilities::BasisSharedPtr basis = pCollExp[0]->GetBasis(d);
+                m_nmodes[d] = basis->GetNumModes();
+                m_nquad [d] = basis->GetNumPoints();
+                m_base  [d] = basis->GetBdata();
+                m_dbase [d] = basis->GetDbdata();
+                m_deriv [d] = &(basis->GetD()->GetPtr())[0];
+                m_maxSize  *= max(m_nmodes[d], m_nquad[d]);
+            }
+
+            m_maxSize *= kVecWidth;
+        }
+
+        /// Interleaves @p n values per element of @p in into blocks.
+        Array<OneD, NekDouble> InterleaveAll(
+                int n, const NekDouble *in)
+        {
+            int nblock = (m_numElmt + kVecWidth - 1) / kVecWidth;
+            Array<OneD, NekDouble> out(nblock*kVecWidth*n);
+
+            for (int e = 0, b = 0; e < m_numElmt; e += kVecWidth, ++b)
+            {
+                Interleave(n, e, m_numElmt, in, out.get() + b*kVecWidth*n);
+            }
+
+            return out;
+        }
+
+        /**
+         * @brief Applies the matrices @p mat along each direction in turn,
+         * mapping a block of size @p nin to one of size @p nout.
+         *
+         * Intermediate results alternate between @p tmp0 and @p tmp1, which
+         * together with @p out must be distinct from @p in and hold
+         * m_maxSize values.
+         */
+        void TensorContract(
+                const int *nin, const int *nout, const NekDouble *const *mat,
+                bool trans, const NekDouble *in, NekDouble *out,
+                NekDouble *tmp0, NekDouble *tmp1)
+        {
+            int size[3] = { nin[0], m_dim > 1 ? nin[1] : 1,
+                                    m_dim > 2 ? nin[2] : 1 };
+            const NekDouble *src = in;
+
+            for (int d = 0; d < m_dim; ++d)
+            {
+                int n0 = 1, n2 = 1;
+                for (int i = 0;     i < d;     ++i) n0 *= size[i];
+                for (int i = d + 1; i < m_dim; ++i) n2 *= size[i];
+
+                NekDouble *dst = d == m_dim - 1 ? out : d % 2 ? tmp1 : tmp0;
+                Contract(n0, size[d], nout[d], n2, mat[d], trans, src, dst);
+
+                size[d] = nout[d];
+                src     = dst;
+            }
+        }
+
+        /// Derivative of a block in reference direction @p dir.
+        void ReferenceDeriv(int dir, const NekDouble *in, NekDouble *out)
+        {
+            int n0 = 1, n2 = 1;
+            for (int i = 0;       i < dir;   ++i) n0 *= m_nquad[i];
+            for (int i = dir + 1; i < m_dim; ++i) n2 *= m_nquad[i];
+
+            Contract(n0, m_nquad[dir], m_nquad[dir], n2, m_deriv[dir], false,
+                     in, out);
+        }
+
+        const int                    m_dim;
+        const int                    m_coordim;
+        const int                    m_nCoeffs;
+        const int                    m_nPhys;
+        int                          m_maxSize;
+        int                          m_nmodes[3];
+        int                          m_nquad[3];
+        Array<OneD, const NekDouble> m_base[3];
+        Array<OneD, const NekDouble> m_dbase[3];
+        const NekDouble             *m_deriv[3];
+};
+
+/**
+ * @brief Backward transform operator using sum-factorisation on
+ * element-interleaved data (Quad, Hex)
+ */
+class BwdTrans_SumFacInterleaved : public SumFacInterleaved_Helper
+{
+    public:
+        OPERATOR_CREATE(BwdTrans_SumFacInterleaved)
+
+        virtual ~BwdTrans_SumFacInterleaved()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            NekDouble *in   = wsp.get();
+            NekDouble *out  = in   + m_maxSize;
+            NekDouble *tmp0 = out  + m_maxSize;
+            NekDouble *tmp1 = tmp0 + m_maxSize;
+
+            const NekDouble *base[3] =
+                { m_base[0].get(), m_base[1].get(),
+                  m_dim > 2 ? m_base[2].get() : 0 };
+
+            for (int e = 0; e < m_numElmt; e += kVecWidth)
+            {
+                Interleave(m_nCoeffs, e, m_numElmt, input.get(), in);
+                TensorContract(m_nmodes, m_nquad, base, false,
+                               in, out, tmp0, tmp1);
+                Deinterleave(m_nPhys, e, m_numElmt, out, output.get());
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL0(false, "Not valid for this operator.");
+        }
+
+    private:
+        BwdTrans_SumFacInterleaved(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : SumFacInterleaved_Helper(pCollExp, pGeomData)
+        {
+            m_wspSize = 4*m_maxSize;
+        }
+};
+
+/// Factory initialisation for the BwdTrans_SumFacInterleaved operators
+OperatorKey BwdTrans_SumFacInterleaved::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eBwdTrans, eSumFacInterleaved, false),
+        BwdTrans_SumFacInterleaved::create,
+        "BwdTrans_SumFacInterleaved_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eBwdTrans, eSumFacInterleaved, false),
+        BwdTrans_SumFacInterleaved::create,
+        "BwdTrans_SumFacInterleaved_Hex")
+};
+
+
+/**
+ * @brief Inner product operator using sum-factorisation on
+ * element-interleaved data (Quad, Hex)
+ */
+class IProductWRTBase_SumFacInterleaved : public SumFacInterleaved_Helper
+{
+    public:
+        OPERATOR_CREATE(IProductWRTBase_SumFacInterleaved)
+
+        virtual ~IProductWRTBase_SumFacInterleaved()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            NekDouble *in   = wsp.get();
+            NekDouble *out  = in   + m_maxSize;
+            NekDouble *tmp0 = out  + m_maxSize;
+            NekDouble *tmp1 = tmp0 + m_maxSize;
+
+            const NekDouble *base[3] =
+                { m_base[0].get(), m_base[1].get(),
+                  m_dim > 2 ? m_base[2].get() : 0 };
+            const int blockSize = kVecWidth*m_nPhys;
+
+            for (int e = 0, b = 0; e < m_numElmt; e += kVecWidth, ++b)
+            {
+                Interleave(m_nPhys, e, m_numElmt, input.get(), in);
+                Vmath::Vmul(blockSize, m_jac.get() + b*blockSize, 1,
+                            in, 1, in, 1);
+                TensorContract(m_nquad, m_nmodes, base, true,
+                               in, out, tmp0, tmp1);
+                Deinterleave(m_nCoeffs, e, m_numElmt, out, output.get());
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL0(false, "Not valid for this operator.");
+        }
+
+    protected:
+        Array<OneD, const NekDouble> m_jac;
+
+    private:
+        IProductWRTBase_SumFacInterleaved(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : SumFacInterleaved_Helper(pCollExp, pGeomData)
+        {
+            m_jac     = InterleaveAll(
+                m_nPhys, pGeomData->GetJacWithStdWeights(pCollExp).get());
+            m_wspSize = 4*m_maxSize;
+        }
+};
+
+/// Factory initialisation for the IProductWRTBase_SumFacInterleaved operators
+OperatorKey IProductWRTBase_SumFacInterleaved::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eIProductWRTBase, eSumFacInterleaved,
+                    false),
+        IProductWRTBase_SumFacInterleaved::create,
+        "IProductWRTBase_SumFacInterleaved_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eIProductWRTBase, eSumFacInterleaved,
+                    false),
+        IProductWRTBase_SumFacInterleaved::create,
+        "IProductWRTBase_SumFacInterleaved_Hex")
+};
+
+
+/**
+ * @brief Physical derivative operator using sum-factorisation on
+ * element-interleaved data (Quad, Hex)
+ */
+class PhysDeriv_SumFacInterleaved : public SumFacInterleaved_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysDeriv_SumFacInterleaved)
+
+        virtual ~PhysDeriv_SumFacInterleaved()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            NekDouble *output[3] = { output0.get(), output1.get(),
+                                     output2.get() };
+            NekDouble *in        = wsp.get();
+            NekDouble *out       = in + m_maxSize;
+            NekDouble *diff[3];
+            for (int d = 0; d < m_dim; ++d)
+            {
+                diff[d] = out + (d+1)*m_maxSize;
+            }
+
+            const int blockSize = kVecWidth*m_nPhys;
+
+            for (int e = 0, b = 0; e < m_numElmt; e += kVecWidth, ++b)
+            {
+                Interleave(m_nPhys, e, m_numElmt, input.get(), in);
+
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    ReferenceDeriv(d, in, diff[d]);
+                }
+
+                for (int i = 0; i < m_coordim; ++i)
+                {
+                    Combine(i, b*blockSize, diff, out);
+                    Deinterleave(m_nPhys, e, m_numElmt, out, output[i]);
+                }
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            NekDouble *in   = wsp.get();
+            NekDouble *out  = in + m_maxSize;
+            NekDouble *diff[3];
+            for (int d = 0; d < m_dim; ++d)
+            {
+                diff[d] = out + (d+1)*m_maxSize;
+            }
+
+            const int blockSize = kVecWidth*m_nPhys;
+
+            for (int e = 0, b = 0; e < m_numElmt; e += kVecWidth, ++b)
+            {
+                Interleave(m_nPhys, e, m_numElmt, input.get(), in);
+
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    ReferenceDeriv(d, in, diff[d]);
+                }
+
+                Combine(dir, b*blockSize, diff, out);
+                Deinterleave(m_nPhys, e, m_numElmt, out, output.get());
+            }
+        }
+
+    protected:
+        Array<OneD, Array<OneD, NekDouble> > m_derivFac;
+
+        /// out = sum_d df[dir][d] * diff[d] for the block at @p offset.
+        void Combine(int dir, int offset, NekDouble *const *diff,
+                     NekDouble *out)
+        {
+            const int blockSize = kVecWidth*m_nPhys;
+
+            Vmath::Vmul(blockSize, m_derivFac[dir*m_dim].get() + offset, 1,
+                        diff[0], 1, out, 1);
+            for (int d = 1; d < m_dim; ++d)
+            {
+                Vmath::Vvtvp(blockSize,
+                             m_derivFac[dir*m_dim + d].get() + offset, 1,
+                             diff[d], 1, out, 1, out, 1);
+            }
+        }
+
+    private:
+        PhysDeriv_SumFacInterleaved(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : SumFacInterleaved_Helper(pCollExp, pGeomData)
+        {
+            const Array<TwoD, const NekDouble> &derivFac =
+                pGeomData->GetDerivFactors(pCollExp);
+
+            m_derivFac = Array<OneD, Array<OneD, NekDouble> >(
+                m_dim*m_coordim);
+            for (int i = 0; i < m_dim*m_coordim; ++i)
+            {
+                m_derivFac[i] = InterleaveAll(m_nPhys, &derivFac[i][0]);
+            }
+
+            m_wspSize = (2 + m_dim)*m_maxSize;
+        }
+};
+
+/// Factory initialisation for the PhysDeriv_SumFacInterleaved operators
+OperatorKey PhysDeriv_SumFacInterleaved::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDeriv, eSumFacInterleaved, false),
+        PhysDeriv_SumFacInterleaved::create,
+        "PhysDeriv_SumFacInterleaved_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDeriv, eSumFacInterleaved, false),
+        PhysDeriv_SumFacInterleaved::create,
+        "PhysDeriv_SumFacInterleaved_Hex")
+};
+
+
+/**
+ * @brief Inner product with respect to the derivative of the basis using
+ * sum-factorisation on element-interleaved data (Quad, Hex)
+ */
+class IProductWRTDerivBase_SumFacInterleaved : public SumFacInterleaved_Helper
+{
+    public:
+        OPERATOR_CREATE(IProductWRTDerivBase_SumFacInterleaved)
+
+        virtual ~IProductWRTDerivBase_SumFacInterleaved()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &entry0,
+                      Array<OneD,       NekDouble> &entry1,
+                      Array<OneD,       NekDouble> &entry2,
+                      Array<OneD,       NekDouble> &entry3,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.num_elements() == m_wspSize,
+                     "Incorrect workspace size");
+
+            const NekDouble *input[3] = { entry0.get(), entry1.get(),
+                                          entry2.get() };
+            NekDouble *output = m_coordim == 2 ? entry2.get() : entry3.get();
+
+            NekDouble *in[3];
+            for (int i = 0; i < m_coordim; ++i)
+            {
+                in[i] = wsp.get() + i*m_maxSize;
+            }
+            NekDouble *tmp  = wsp.get() + m_coordim*m_maxSize;
+            NekDouble *out  = tmp  + m_maxSize;
+            NekDouble *acc  = out  + m_maxSize;
+            NekDouble *tmp0 = acc  + m_maxSize;
+            NekDouble *tmp1 = tmp0 + m_maxSize;
+
+            const int blockSize = kVecWidth*m_nPhys;
+
+            for (int e = 0, b = 0; e < m_numElmt; e += kVecWidth, ++b)
+            {
+                const int offset = b*blockSize;
+
+                for (int i = 0; i < m_coordim; ++i)
+                {
+                    Interleave(m_nPhys, e, m_numElmt, input[i], in[i]);
+                }
+
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    // tmp = jac * (dx/dxi_d in[0] + dy/dxi_d in[1] + ...)
+                    Vmath::Vmul(blockSize, m_derivFac[d].get() + offset, 1,
+                                in[0], 1, tmp, 1);
+                    for (int i = 1; i < m_coordim; ++i)
+                    {
+                        Vmath::Vvtvp(blockSize,
+                                     m_derivFac[d + i*m_dim].get() + offset,
+                                     1, in[i], 1, tmp, 1, tmp, 1);
+                    }
+                    Vmath::Vmul(blockSize, m_jac.get() + offset, 1,
+                                tmp, 1, tmp, 1);
+
+                    // Inner product with the derivative of basis d
+                    const NekDouble *base[3];
+                    for (int j = 0; j < m_dim; ++j)
+                    {
+                        base[j] = j == d ? m_dbase[j].get() : m_base[j].get();
+                    }
+
+                    TensorContract(m_nquad, m_nmodes, base, true,
+                                   tmp, d == 0 ? acc : out, tmp0, tmp1);
+
+                    if (d > 0)
+                    {
+                        Vmath::Vadd(kVecWidth*m_nCoeffs, out, 1,
+                                    acc, 1, acc, 1);
+                    }
+                }
+
+                Deinterleave(m_nCoeffs, e, m_numElmt, acc, output);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL0(false, "Not valid for this operator.");
+        }
+
+    protected:
+        Array<OneD, const NekDouble>         m_jac;
+        Array<OneD, Array<OneD, NekDouble> > m_derivFac;
+
+    private:
+        IProductWRTDerivBase_SumFacInterleaved(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : SumFacInterleaved_Helper(pCollExp, pGeomData)
+        {
+            const Array<TwoD, const NekDouble> &derivFac =
+                pGeomData->GetDerivFactors(pCollExp);
+
+            m_derivFac = Array<OneD, Array<OneD, NekDouble> >(
+                m_dim*m_coordim);
+            for (int i = 0; i < m_dim*m_coordim; ++i)
+            {
+                m_derivFac[i] = InterleaveAll(m_nPhys, &derivFac[i][0]);
+            }
+
+            m_jac     = InterleaveAll(
+                m_nPhys, pGeomData->GetJacWithStdWeights(pCollExp).get());
+            m_wspSize = (m_coordim + 5)*m_maxSize;
+        }
+};
+
+/// Factory initialisation for the IProductWRTDerivBase_SumFacInterleaved
+/// operators
+OperatorKey IProductWRTDerivBase_SumFacInterleaved::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eIProductWRTDerivBase,
+                    eSumFacInterleaved, false),
+        IProductWRTDerivBase_SumFacInterleaved::create,
+        "IProductWRTDerivBase_SumFacInterleaved_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eIProductWRTDerivBase,
+                    eSumFacInterleaved, false),
+        IProductWRTDerivBase_SumFacInterleaved::create,
+        "IProductWRTDerivBase_SumFacInterleaved_Hex")
+};
+
+}
+}
@@ -0,0 +1,561 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacKernels.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sum-factorisation kernels specialised on polynomial order
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include <Collections/SumFacKernels.h>
+
+using namespace std;
+
+namespace Nektar
+{
+namespace Collections
+{
+
+// The kernels below perform the same contractions as the BLAS based
+// sum-factorisation operators, element by element. Since all loop bounds are
+// known at compile time the compiler can fully unroll and vectorise the
+// inner loops, which avoids the overhead of the many small Dgemm calls made
+// at low polynomial orders. Bases and derivative matrices are stored column
+// major as returned by LibUtilities::Basis, with the quadrature point index
+// running fastest.
+
+/**
+ * @brief out = B0 * in * B1^T for each element.
+ */
+template<int NM0, int NM1, int NQ0, int NQ1>
+void QuadBwdTransFixed(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1,
+    const NekDouble *input, NekDouble *output)
+{
+    NekDouble tmp[NQ0*NM1];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NM0*NM1;
+        NekDouble       *out = output + e*NQ0*NQ1;
+
+        for (int p1 = 0; p1 < NM1; ++p1)
+        {
+            NekDouble *t = tmp + p1*NQ0;
+            for (int q0 = 0; q0 < NQ0; ++q0)
+            {
+                t[q0] = 0.0;
+            }
+            for (int p0 = 0; p0 < NM0; ++p0)
+            {
+                const NekDouble  c = in[p1*NM0 + p0];
+                const NekDouble *b = base0 + p0*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    t[q0] += b[q0] * c;
+                }
+            }
+        }
+
+        for (int q1 = 0; q1 < NQ1; ++q1)
+        {
+            NekDouble *o = out + q1*NQ0;
+            for (int q0 = 0; q0 < NQ0; ++q0)
+            {
+                o[q0] = 0.0;
+            }
+            for (int p1 = 0; p1 < NM1; ++p1)
+            {
+                const NekDouble  b = base1[p1*NQ1 + q1];
+                const NekDouble *t = tmp + p1*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    o[q0] += b * t[q0];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief out = B0^T * (jac * in) * B1 for each element.
+ */
+template<int NM0, int NM1, int NQ0, int NQ1>
+void QuadIProductFixed(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output)
+{
+    NekDouble w  [NQ0*NQ1];
+    NekDouble tmp[NM0*NQ1];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NQ0*NQ1;
+        const NekDouble *j   = jac    + e*NQ0*NQ1;
+        NekDouble       *out = output + e*NM0*NM1;
+
+        for (int i = 0; i < NQ0*NQ1; ++i)
+        {
+            w[i] = j[i] * in[i];
+        }
+
+        for (int q1 = 0; q1 < NQ1; ++q1)
+        {
+            const NekDouble *ww = w + q1*NQ0;
+            for (int p0 = 0; p0 < NM0; ++p0)
+            {
+                const NekDouble *b   = base0 + p0*NQ0;
+                NekDouble        sum = 0.0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    sum += b[q0] * ww[q0];
+                }
+                tmp[q1*NM0 + p0] = sum;
+            }
+        }
+
+        for (int p1 = 0; p1 < NM1; ++p1)
+        {
+            NekDouble *o = out + p1*NM0;
+            for (int p0 = 0; p0 < NM0; ++p0)
+            {
+                o[p0] = 0.0;
+            }
+            for (int q1 = 0; q1 < NQ1; ++q1)
+            {
+                const NekDouble  b = base1[p1*NQ1 + q1];
+                const NekDouble *t = tmp + q1*NM0;
+                for (int p0 = 0; p0 < NM0; ++p0)
+                {
+                    o[p0] += b * t[p0];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief diff0 = D0 * in and diff1 = in * D1^T for each element.
+ */
+template<int NQ0, int NQ1>
+void QuadPhysDerivFixed(
+    int numElmt,
+    const NekDouble *deriv0, const NekDouble *deriv1,
+    const NekDouble *input,  NekDouble *diff0, NekDouble *diff1)
+{
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in = input + e*NQ0*NQ1;
+        NekDouble       *d0 = diff0 + e*NQ0*NQ1;
+        NekDouble       *d1 = diff1 + e*NQ0*NQ1;
+
+        for (int q1 = 0; q1 < NQ1; ++q1)
+        {
+            NekDouble *o0 = d0 + q1*NQ0;
+            NekDouble *o1 = d1 + q1*NQ0;
+            for (int q0 = 0; q0 < NQ0; ++q0)
+            {
+                o0[q0] = 0.0;
+                o1[q0] = 0.0;
+            }
+            for (int k = 0; k < NQ0; ++k)
+            {
+                const NekDouble  c = in[q1*NQ0 + k];
+                const NekDouble *d = deriv0 + k*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    o0[q0] += d[q0] * c;
+                }
+            }
+            for (int k = 0; k < NQ1; ++k)
+            {
+                const NekDouble  d = deriv1[k*NQ1 + q1];
+                const NekDouble *c = in + k*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    o1[q0] += d * c[q0];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Backward transform of each hexahedron, contracting one direction
+ * at a time.
+ */
+template<int NM0, int NM1, int NM2, int NQ0, int NQ1, int NQ2>
+void HexBwdTransFixed(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *input, NekDouble *output)
+{
+    NekDouble tmp1[NQ0*NM1*NM2];
+    NekDouble tmp2[NQ0*NQ1*NM2];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NM0*NM1*NM2;
+        NekDouble       *out = output + e*NQ0*NQ1*NQ2;
+
+        // Contract over the first direction.
+        for (int c = 0; c < NM1*NM2; ++c)
+        {
+            NekDouble *t = tmp1 + c*NQ0;
+            for (int q0 = 0; q0 < NQ0; ++q0)
+            {
+                t[q0] = 0.0;
+            }
+            for (int p0 = 0; p0 < NM0; ++p0)
+            {
+                const NekDouble  v = in[c*NM0 + p0];
+                const NekDouble *b = base0 + p0*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    t[q0] += b[q0] * v;
+                }
+            }
+        }
+
+        // Contract over the second direction.
+        for (int p2 = 0; p2 < NM2; ++p2)
+        {
+            for (int q1 = 0; q1 < NQ1; ++q1)
+            {
+                NekDouble *t = tmp2 + (p2*NQ1 + q1)*NQ0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    t[q0] = 0.0;
+                }
+                for (int p1 = 0; p1 < NM1; ++p1)
+                {
+                    const NekDouble  b = base1[p1*NQ1 + q1];
+                    const NekDouble *s = tmp1 + (p2*NM1 + p1)*NQ0;
+                    for (int q0 = 0; q0 < NQ0; ++q0)
+                    {
+                        t[q0] += b * s[q0];
+                    }
+                }
+            }
+        }
+
+        // Contract over the third direction.
+        for (int q2 = 0; q2 < NQ2; ++q2)
+        {
+            NekDouble *o = out + q2*NQ0*NQ1;
+            for (int i = 0; i < NQ0*NQ1; ++i)
+            {
+                o[i] = 0.0;
+            }
+            for (int p2 = 0; p2 < NM2; ++p2)
+            {
+                const NekDouble  b = base2[p2*NQ2 + q2];
+                const NekDouble *s = tmp2 + p2*NQ0*NQ1;
+                for (int i = 0; i < NQ0*NQ1; ++i)
+                {
+                    o[i] += b * s[i];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inner product of each hexahedron, contracting one direction at a
+ * time.
+ */
+template<int NM0, int NM1, int NM2, int NQ0, int NQ1, int NQ2>
+void HexIProductFixed(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output)
+{
+    NekDouble w   [NQ0*NQ1*NQ2];
+    NekDouble tmp1[NM0*NQ1*NQ2];
+    NekDouble tmp2[NM0*NM1*NQ2];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NQ0*NQ1*NQ2;
+        const NekDouble *j   = jac    + e*NQ0*NQ1*NQ2;
+        NekDouble       *out = output + e*NM0*NM1*NM2;
+
+        for (int i = 0; i < NQ0*NQ1*NQ2; ++i)
+        {
+            w[i] = j[i] * in[i];
+        }
+
+        // Contract over the first direction.
+        for (int c = 0; c < NQ1*NQ2; ++c)
+        {
+            const NekDouble *ww = w + c*NQ0;
+            for (int p0 = 0; p0 < NM0; ++p0)
+            {
+                const NekDouble *b   = base0 + p0*NQ0;
+                NekDouble        sum = 0.0;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    sum += b[q0] * ww[q0];
+                }
+                tmp1[c*NM0 + p0] = sum;
+            }
+        }
+
+        // Contract over the second direction.
+        for (int q2 = 0; q2 < NQ2; ++q2)
+        {
+            for (int p1 = 0; p1 < NM1; ++p1)
+            {
+                NekDouble *t = tmp2 + (q2*NM1 + p1)*NM0;
+                for (int p0 = 0; p0 < NM0; ++p0)
+                {
+                    t[p0] = 0.0;
+                }
+                for (int q1 = 0; q1 < NQ1; ++q1)
+                {
+                    const NekDouble  b = base1[p1*NQ1 + q1];
+                    const NekDouble *s = tmp1 + (q2*NQ1 + q1)*NM0;
+                    for (int p0 = 0; p0 < NM0; ++p0)
+                    {
+                        t[p0] += b * s[p0];
+                    }
+                }
+            }
+        }
+
+        // Contract over the third direction.
+        for (int p2 = 0; p2 < NM2; ++p2)
+        {
+            NekDouble *o = out + p2*NM0*NM1;
+            for (int i = 0; i < NM0*NM1; ++i)
+            {
+                o[i] = 0.0;
+            }
+            for (int q2 = 0; q2 < NQ2; ++q2)
+            {
+                const NekDouble  b = base2[p2*NQ2 + q2];
+                const NekDouble *s = tmp2 + q2*NM0*NM1;
+                for (int i = 0; i < NM0*NM1; ++i)
+                {
+                    o[i] += b * s[i];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Derivatives of each hexahedron in the three reference directions.
+ */
+template<int NQ0, int NQ1, int NQ2>
+void HexPhysDerivFixed(
+    int numElmt,
+    const NekDouble *deriv0, const NekDouble *deriv1, const NekDouble *deriv2,
+    const NekDouble *input,
+    NekDouble *diff0, NekDouble *diff1, NekDouble *diff2)
+{
+    const int nqtot = NQ0*NQ1*NQ2;
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in = input + e*nqtot;
+        NekDouble       *d0 = diff0 + e*nqtot;
+        NekDouble       *d1 = diff1 + e*nqtot;
+        NekDouble       *d2 = diff2 + e*nqtot;
+
+        for (int q2 = 0; q2 < NQ2; ++q2)
+        {
+            for (int q1 = 0; q1 < NQ1; ++q1)
+            {
+                const int  off = (q2*NQ1 + q1)*NQ0;
+                NekDouble *o0  = d0 + off;
+                NekDouble *o1  = d1 + off;
+                for (int q0 = 0; q0 < NQ0; ++q0)
+                {
+                    o0[q0] = 0.0;
+                    o1[q0] = 0.0;
+                }
+                for (int k = 0; k < NQ0; ++k)
+                {
+                    const NekDouble  c = in[off + k];
+                    const NekDouble *d = deriv0 + k*NQ0;
+                    for (int q0 = 0; q0 < NQ0; ++q0)
+                    {
+                        o0[q0] += d[q0] * c;
+                    }
+                }
+                for (int k = 0; k < NQ1; ++k)
+                {
+                    const NekDouble  d = deriv1[k*NQ1 + q1];
+                    const NekDouble *c = in + (q2*NQ1 + k)*NQ0;
+                    for (int q0 = 0; q0 < NQ0; ++q0)
+                    {
+                        o1[q0] += d * c[q0];
+                    }
+                }
+            }
+
+            NekDouble *o2 = d2 + q2*NQ0*NQ1;
+            for (int i = 0; i < NQ0*NQ1; ++i)
+            {
+                o2[i] = 0.0;
+            }
+            for (int k = 0; k < NQ2; ++k)
+            {
+                const NekDouble  d = deriv2[k*NQ2 + q2];
+                const NekDouble *c = in + k*NQ0*NQ1;
+                for (int i = 0; i < NQ0*NQ1; ++i)
+                {
+                    o2[i] += d * c[i];
+                }
+            }
+        }
+    }
+}
+
+typedef vector<int> KernelKey;
+
+/**
+ * @brief Tables of the instantiated kernels, indexed by the numbers of modes
+ * and quadrature points in each direction.
+ */
+struct KernelTables
+{
+    map<KernelKey, QuadBwdTransKernel>  quadBwdTrans;
+    map<KernelKey, QuadIProductKernel>  quadIProduct;
+    map<KernelKey, QuadPhysDerivKernel> quadPhysDeriv;
+    map<KernelKey, HexBwdTransKernel>   hexBwdTrans;
+    map<KernelKey, HexIProductKernel>   hexIProduct;
+    map<KernelKey, HexPhysDerivKernel>  hexPhysDeriv;
+
+    KernelTables();
+
+    /// Registers the kernels for @p NM modes and @p NQ points in every
+    /// direction.
+    template<int NM, int NQ>
+    void Register()
+    {
+        KernelKey k2(4), k3(6), d2(2, NQ), d3(3, NQ);
+        k2[0] = k2[1] = k3[0] = k3[1] = k3[2] = NM;
+        k2[2] = k2[3] = k3[3] = k3[4] = k3[5] = NQ;
+
+        quadBwdTrans [k2] = &QuadBwdTransFixed <NM, NM, NQ, NQ>;
+        quadIProduct [k2] = &QuadIProductFixed <NM, NM, NQ, NQ>;
+        quadPhysDeriv[d2] = &QuadPhysDerivFixed<NQ, NQ>;
+        hexBwdTrans  [k3] = &HexBwdTransFixed  <NM, NM, NM, NQ, NQ, NQ>;
+        hexIProduct  [k3] = &HexIProductFixed  <NM, NM, NM, NQ, NQ, NQ>;
+        hexPhysDeriv [d3] = &HexPhysDerivFixed <NQ, NQ, NQ>;
+    }
+};
+
+/**
+ * Kernels are instantiated for 2 to 9 modes with one or two more quadrature
+ * points than modes, which covers the default quadrature of the modified
+ * basis at the orders commonly used in practice.
+ */
+KernelTables::KernelTables()
+{
+    Register<2, 3>();  Register<2, 4>();
+    Register<3, 4>();  Register<3, 5>();
+    Register<4, 5>();  Register<4, 6>();
+    Register<5, 6>();  Register<5, 7>();
+    Register<6, 7>();  Register<6, 8>();
+    Register<7, 8>();  Register<7, 9>();
+    Register<8, 9>();  Register<8, 10>();
+    Register<9, 10>(); Register<9, 11>();
+}
+
+static KernelTables &GetKernelTables()
+{
+    static KernelTables tables;
+    return tables;
+}
+
+template<typename T>
+static T FindKernel(const map<KernelKey, T> &table, const KernelKey &key)
+{
+    typename map<KernelKey, T>::const_iterator it = table.find(key);
+    return it == table.end() ? 0 : it->second;
+}
+
+QuadBwdTransKernel GetQuadBwdTransKernel(
+    int nmodes0, int nmodes1, int nquad0, int nquad1)
+{
+    KernelKey key(4);
+    key[0] = nmodes0; key[1] = nmodes1; key[2] = nquad0; key[3] = nquad1;
+    return FindKernel(GetKernelTables().quadBwdTrans, key);
+}
+
+QuadIProductKernel GetQuadIProductKernel(
+    int nmodes0, int nmodes1, int nquad0, int nquad1)
+{
+    KernelKey key(4);
+    key[0] = nmodes0; key[1] = nmodes1; key[2] = nquad0; key[3] = nquad1;
+    return FindKernel(GetKernelTables().quadIProduct, key);
+}
+
+QuadPhysDerivKernel GetQuadPhysDerivKernel(int nquad0, int nquad1)
+{
+    KernelKey key(2);
+    key[0] = nquad0; key[1] = nquad1;
+    return FindKernel(GetKernelTables().quadPhysDeriv, key);
+}
+
+HexBwdTransKernel GetHexBwdTransKernel(
+    int nmodes0, int nmodes1, int nmodes2, int nquad0, int nquad1, int nquad2)
+{
+    KernelKey key(6);
+    key[0] = nmodes0; key[1] = nmodes1; key[2] = nmodes2;
+    key[3] = nquad0;  key[4] = nquad1;  key[5] = nquad2;
+    return FindKernel(GetKernelTables().hexBwdTrans, key);
+}
+
+HexIProductKernel GetHexIProductKernel(
+    int nmodes0, int nmodes1, int nmodes2, int nquad0, int nquad1, int nquad2)
+{
+    KernelKey key(6);
+    key[0] = nmodes0; key[1] = nmodes1; key[2] = nmodes2;
+    key[3] = nquad0;  key[4] = nquad1;  key[5] = nquad2;
+    return FindKernel(GetKernelTables().hexIProduct, key);
+}
+
+HexPhysDerivKernel GetHexPhysDerivKernel(int nquad0, int nquad1, int nquad2)
+{
+    KernelKey key(3);
+    key[0] = nquad0; key[1] = nquad1; key[2] = nquad2;
+    return FindKernel(GetKernelTables().hexPhysDeriv, key);
+}
+
+}
+}
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacKernels.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sum-factorisation kernels specialised on polynomial order
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIBRARY_COLLECTIONS_SUMFACKERNELS_H
+#define NEKTAR_LIBRARY_COLLECTIONS_SUMFACKERNELS_H
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+
+namespace Nektar
+{
+namespace Collections
+{
+
+/// Backward transform of @p numElmt quadrilaterals
+typedef void (*QuadBwdTransKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1,
+    const NekDouble *input, NekDouble *output);
+
+/// Inner product of @p numElmt quadrilaterals, weighted by @p jac
+typedef void (*QuadIProductKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output);
+
+/// Derivatives in the reference directions of @p numElmt quadrilaterals
+typedef void (*QuadPhysDerivKernel)(
+    int numElmt,
+    const NekDouble *deriv0, const NekDouble *deriv1,
+    const NekDouble *input,  NekDouble *diff0, NekDouble *diff1);
+
+/// Backward transform of @p numElmt hexahedra
+typedef void (*HexBwdTransKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *input, NekDouble *output);
+
+/// Inner product of @p numElmt hexahedra, weighted by @p jac
+typedef void (*HexIProductKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output);
+
+/// Derivatives in the reference directions of @p numElmt hexahedra
+typedef void (*HexPhysDerivKernel)(
+    int numElmt,
+    const NekDouble *deriv0, const NekDouble *deriv1, const NekDouble *deriv2,
+    const NekDouble *input,
+    NekDouble *diff0, NekDouble *diff1, NekDouble *diff2);
+
+// The functions below return a kernel compiled for the given numbers of
+// modes and quadrature points, or a null pointer if no such kernel has been
+// instantiated, in which case the BLAS implementation should be used.
+
+QuadBwdTransKernel  GetQuadBwdTransKernel (int nmodes0, int nmodes1,
+                                           int nquad0,  int nquad1);
+QuadIProductKernel  GetQuadIProductKernel (int nmodes0, int nmodes1,
+                                           int nquad0,  int nquad1);
+QuadPhysDerivKernel GetQuadPhysDerivKernel(int nquad0,  int nquad1);
+
+HexBwdTransKernel   GetHexBwdTransKernel  (int nmodes0, int nmodes1,
+                                           int nmodes2, int nquad0,
+                                           int nquad1,  int nquad2);
+HexIProductKernel   GetHexIProductKernel  (int nmodes0, int nmodes1,
+                                           int nmodes2, int nquad0,
+                                           int nquad1,  int nquad2);
+HexPhysDerivKernel  GetHexPhysDerivKernel (int nquad0,  int nquad1,
+                                           int nquad2);
+
+}
+}
+#endif
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: BwdTransPhysDeriv3D.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares the fused backward transform and derivative of a 3D
+// expansion list with BwdTrans followed by PhysDeriv, with and without the
+// derivative in the third direction.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/Communication/Comm.h>
+#include <MultiRegions/ExpList3D.h>
+#include <SpatialDomains/MeshGraph3D.h>
+
+using namespace std;
+using namespace Nektar;
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    if (argc != 2)
+    {
+        fprintf(stderr,"Usage: BwdTransPhysDeriv3D meshfile\n");
+        exit(1);
+    }
+
+    //----------------------------------------------
+    // Read in mesh from input file
+    SpatialDomains::MeshGraphSharedPtr graph3D =
+        MemoryManager<SpatialDomains::MeshGraph3D>::AllocateSharedPtr(vSession);
+    //----------------------------------------------
+
+    //----------------------------------------------
+    // Define Expansion
+    MultiRegions::ExpList3DSharedPtr Exp =
+        MemoryManager<MultiRegions::ExpList3D>::AllocateSharedPtr(
+            vSession, graph3D, vSession->GetVariable(0));
+    //----------------------------------------------
+
+    //----------------------------------------------
+    // Set up coordinates of mesh and project the initial condition
+    int nq = Exp->GetTotPoints();
+
+    Array<OneD,NekDouble> xc0(nq,0.0);
+    Array<OneD,NekDouble> xc1(nq,0.0);
+    Array<OneD,NekDouble> xc2(nq,0.0);
+
+    Exp->GetCoords(xc0,xc1,xc2);
+
+    LibUtilities::EquationSharedPtr ffunc
+            = vSession->GetFunction("InitialCondition", 0);
+    ffunc->Evaluate(xc0,xc1,xc2,Exp->UpdatePhys());
+
+    Exp->FwdTrans_IterPerExp(Exp->GetPhys(), Exp->UpdateCoeffs());
+    //----------------------------------------------
+
+    //----------------------------------------------
+    // Reference: backward transform followed by derivative
+    Array<OneD,NekDouble> u   (nq,0.0);
+    Array<OneD,NekDouble> dudx(nq,0.0);
+    Array<OneD,NekDouble> dudy(nq,0.0);
+    Array<OneD,NekDouble> dudz(nq,0.0);
+
+    Exp->BwdTrans_IterPerExp(Exp->GetCoeffs(), u);
+    Exp->PhysDeriv(u, dudx, dudy, dudz);
+    //----------------------------------------------
+
+    //----------------------------------------------
+    // Fused operator, all derivatives
+    Array<OneD,NekDouble> fu  (nq,0.0);
+    Array<OneD,NekDouble> fdx (nq,0.0);
+    Array<OneD,NekDouble> fdy (nq,0.0);
+    Array<OneD,NekDouble> fdz (nq,0.0);
+
+    Exp->BwdTransPhysDeriv_IterPerExp(Exp->GetCoeffs(), fu, fdx, fdy, fdz);
+
+    cout << "L infinity error (variable u): "
+         << Exp->Linf(fu, u) << endl;
+    cout << "L infinity error (variable dudx): "
+         << Exp->Linf(fdx, dudx) << endl;
+    cout << "L infinity error (variable dudy): "
+         << Exp->Linf(fdy, dudy) << endl;
+    cout << "L infinity error (variable dudz): "
+         << Exp->Linf(fdz, dudz) << endl;
+    //----------------------------------------------
+
+    //----------------------------------------------
+    // Fused operator without the derivative in z, which must be left
+    // untouched on every collection.
+    Vmath::Zero(nq, fu,  1);
+    Vmath::Zero(nq, fdx, 1);
+    Vmath::Zero(nq, fdy, 1);
+
+    Exp->BwdTransPhysDeriv_IterPerExp(Exp->GetCoeffs(), fu, fdx, fdy);
+
+    cout << "L 2 error (variable u): "
+         << Exp->L2(fu, u) << endl;
+    cout << "L 2 error (variable dudx): "
+         << Exp->L2(fdx, dudx) << endl;
+    cout << "L 2 error (variable dudy): "
+         << Exp->L2(fdy, dudy) << endl;
+    //----------------------------------------------
+
+    vSession->Finalise();
+
+    return 0;
+}
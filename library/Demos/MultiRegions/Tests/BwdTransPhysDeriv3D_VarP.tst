@@ -0,0 +1,23 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Fused BwdTrans and PhysDeriv on hexahedra in two collections, with and without the z derivative</description>
+    <executable>BwdTransPhysDeriv3D</executable>
+    <parameters>BwdTransPhysDeriv3D_VarP.xml</parameters>
+    <files>
+        <file description="Session File">BwdTransPhysDeriv3D_VarP.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="Linf" id="1">
+            <value variable="u"    tolerance="1e-10">0</value>
+            <value variable="dudx" tolerance="1e-10">0</value>
+            <value variable="dudy" tolerance="1e-10">0</value>
+            <value variable="dudz" tolerance="1e-10">0</value>
+        </metric>
+        <metric type="L2" id="2">
+            <value variable="u"    tolerance="1e-10">0</value>
+            <value variable="dudx" tolerance="1e-10">0</value>
+            <value variable="dudy" tolerance="1e-10">0</value>
+        </metric>
+    </metrics>
+</test>
@@ -326,6 +326,14 @@ void Interpolator::Interpolate(
         m_expOutField[0]->GetCoords(coords[0], coords[1], coords[2]);
     }
 
+    int nFields = m_expInField.size();
+    Array<OneD, int> elmtIds(nOutPts);
+    Array<OneD, Array<OneD, NekDouble> > locCoords(nInDim);
+    for (int j = 0; j < nInDim; ++j)
+    {
+        locCoords[j] = Array<OneD, NekDouble>(nOutPts, 0.0);
+    }
+
     for (int i = 0; i < nOutPts; ++i)
     {
         for (int j = 0; j < nOutDim; ++j)
@@ -334,35 +342,12 @@ void Interpolator::Interpolate(
         }
 
         // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(Scoords, Lcoords,
+        elmtIds[i] = m_expInField[0]->GetExpIndex(Scoords, Lcoords,
                                                   NekConstants::kNekZeroTol);
 
-        if (elmtid >= 0)
-        {
-            int offset = m_expInField[0]->GetPhys_Offset(elmtid);
-
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                NekDouble value =
-                    m_expInField[f]->GetExp(elmtid)->StdPhysEvaluate(
-                        Lcoords, m_expInField[f]->GetPhys() + offset);
-
-                if ((boost::math::isnan)(value))
-                {
-                    ASSERTL0(false, "new value is not a number");
-                }
-                else
-                {
-                    m_expOutField[f]->UpdatePhys()[i] = value;
-                }
-            }
-        }
-        else
+        for (int j = 0; j < nInDim; ++j)
         {
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                m_expOutField[f]->UpdatePhys()[i] = def_value;
-            }
+            locCoords[j][i] = Lcoords[j];
         }
 
         int progress = int(100 * i / nOutPts);
@@ -372,6 +357,28 @@ void Interpolator::Interpolate(
             lastProg = progress;
         }
     }
+
+    // Evaluate all fields at the located points, element by element
+    Array<OneD, Array<OneD, NekDouble> > inPhys(nFields), outPhys(nFields);
+    for (int f = 0; f < nFields; ++f)
+    {
+        inPhys[f]  = m_expInField[f]->UpdatePhys();
+        outPhys[f] = m_expOutField[f]->UpdatePhys();
+        Vmath::Fill(nOutPts, def_value, outPhys[f], 1);
+    }
+
+    m_expInField[0]->PhysEvaluate(elmtIds, locCoords, inPhys, outPhys);
+
+    for (int f = 0; f < nFields; ++f)
+    {
+        for (int i = 0; i < nOutPts; ++i)
+        {
+            if ((boost::math::isnan)(outPhys[f][i]))
+            {
+                ASSERTL0(false, "new value is not a number");
+            }
+        }
+    }
 }
 
 /**
@@ -408,47 +415,31 @@ void Interpolator::Interpolate(
     m_weights   = Array<OneD, Array<OneD, float> >(nOutPts);
     m_neighInds = Array<OneD, Array<OneD, unsigned int> >(nOutPts);
 
+    int nFields = m_expInField.size();
+    Array<OneD, int> elmtIds(nOutPts);
+    Array<OneD, Array<OneD, NekDouble> > locCoords(nInDim);
+    for (int j = 0; j < nInDim; ++j)
+    {
+        locCoords[j] = Array<OneD, NekDouble>(nOutPts, 0.0);
+    }
+
+    Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
+    Array<OneD, NekDouble> coords(m_ptsOutField->GetDim(), 0.0);
+
     for (int i = 0; i < nOutPts; ++i)
     {
-        Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
-        Array<OneD, NekDouble> coords(m_ptsOutField->GetDim(), 0.0);
         for (int j = 0; j < m_ptsOutField->GetDim(); ++j)
         {
             coords[j] = m_ptsOutField->GetPointVal(j, i);
         }
 
         // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(coords, Lcoords,
+        elmtIds[i] = m_expInField[0]->GetExpIndex(coords, Lcoords,
                                                   NekConstants::kNekZeroTol);
 
-        if (elmtid >= 0)
-        {
-            int offset = m_expInField[0]->GetPhys_Offset(elmtid);
-
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                NekDouble value =
-                    m_expInField[f]->GetExp(elmtid)->StdPhysEvaluate(
-                        Lcoords, m_expInField[f]->GetPhys() + offset);
-
-                if ((boost::math::isnan)(value))
-                {
-                    ASSERTL0(false, "new value is not a number");
-                }
-                else
-                {
-                    m_ptsOutField->SetPointVal(m_ptsOutField->GetDim() + f, i,
-                                               value);
-                }
-            }
-        }
-        else
+        for (int j = 0; j < nInDim; ++j)
         {
-            for (int f = 0; f < m_expInField.size(); ++f)
-            {
-                m_ptsOutField->SetPointVal(m_ptsOutField->GetDim() + f, i,
-                                           def_value);
-            }
+            locCoords[j][i] = Lcoords[j];
         }
 
         int progress = int(100 * i / nOutPts);
@@ -458,6 +449,32 @@ void Interpolator::Interpolate(
             lastProg = progress;
         }
     }
+
+    // Evaluate all fields at the located points, element by element
+    Array<OneD, Array<OneD, NekDouble> > inPhys(nFields), outPhys(nFields);
+    for (int f = 0; f < nFields; ++f)
+    {
+        inPhys[f]  = m_expInField[f]->UpdatePhys();
+        outPhys[f] = Array<OneD, NekDouble>(nOutPts, def_value);
+    }
+
+    m_expInField[0]->PhysEvaluate(elmtIds, locCoords, inPhys, outPhys);
+
+    for (int f = 0; f < nFields; ++f)
+    {
+        for (int i = 0; i < nOutPts; ++i)
+        {
+            if ((boost::math::isnan)(outPhys[f][i]))
+            {
+                ASSERTL0(false, "new value is not a number");
+            }
+            else
+            {
+                m_ptsOutField->SetPointVal(m_ptsOutField->GetDim() + f, i,
+                                           outPhys[f][i]);
+            }
+        }
+    }
 }
 
 /**
@@ -38,6 +38,10 @@
 #include <boost/date_time/posix_time/posix_time_io.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/format.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 #include <LibUtilities/BasicConst/GitRevision.h>
 #include <LibUtilities/BasicUtils/FieldIO.h>
@@ -307,14 +311,174 @@ LIB_UTILITIES_EXPORT void Import(
     f->Import(infilename, fielddefs, fielddata, fieldinfomap, ElementIDs);
 }
 
+/// Serialises the asynchronous output of all FieldIO objects. Each call to
+/// FieldIO::WriteAsync takes a ticket, and the output threads write one at a
+/// time in ticket order. Since all processes call FieldIO::WriteAsync in the
+/// same order, the collective operations of the writers match on all of them.
+static boost::mutex              asyncWriteMutex;
+static boost::condition_variable asyncWriteCond;
+static unsigned int              asyncWriteTicket  = 0;
+static unsigned int              asyncWriteServing = 0;
+
 /**
  * @brief Constructor for FieldIO base class.
  */
 FieldIO::FieldIO(LibUtilities::CommSharedPtr pComm, bool sharedFilesystem)
-    : m_comm(pComm), m_sharedFilesystem(sharedFilesystem)
+    : m_comm(pComm), m_sharedFilesystem(sharedFilesystem), m_stagedIndex(0)
 {
 }
 
+/**
+ * @brief Destructor for FieldIO base class, which completes any outstanding
+ * asynchronous output. Since an exception cannot be raised here, a failure of
+ * that output is reported as a warning.
+ */
+FieldIO::~FieldIO()
+{
+    if (m_asyncThread)
+    {
+        m_asyncThread->join();
+    }
+
+    if (!m_asyncError.empty())
+    {
+        NEKERROR(ErrorUtil::ewarning,
+                 "Asynchronous output failed: " + m_asyncError);
+    }
+}
+
+/**
+ * @brief Write out the field information to the file @p outFile without
+ * waiting for the output to complete.
+ *
+ * The field definitions and metadata are copied, and the field data @p
+ * fielddata swapped, into a staging buffer, so that @p fielddata is empty on
+ * return. The output, including the compression of the data, is performed by
+ * a background thread using a writer of the same type on its own
+ * communicator. Two staging buffers are used, so that the data can be staged
+ * while the previous output is still in progress; only then does this call
+ * wait for the previous output to complete. All processes must call this
+ * routine collectively, as for FieldIO::Write.
+ *
+ * The output threads of all FieldIO objects write one at a time, in the
+ * order of the calls to this routine. If the communicator does not support
+ * being used concurrently from several threads, or the file format cannot be
+ * written from a background thread (see FieldIO::v_SupportsAsyncWrite), the
+ * output is performed synchronously by FieldIO::Write.
+ *
+ * @param outFile       Output filename
+ * @param fielddefs     Field definitions that define the output
+ * @param fielddata     Binary field data that stores the output corresponding
+ *                      to @p fielddefs.
+ * @param fieldinfomap  Associated field metadata map.
+ * @param backup        Back up an existing file rather than overwriting it.
+ */
+void FieldIO::WriteAsync(
+    const std::string                            &outFile,
+    const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+    std::vector<std::vector<NekDouble> >         &fielddata,
+    const FieldMetaDataMap                       &fieldinfomap,
+    const bool                                    backup)
+{
+    StagedWrite &staged = m_staged[m_stagedIndex];
+
+    staged.m_outFile      = outFile;
+    staged.m_fieldinfomap = fieldinfomap;
+    staged.m_backup       = backup;
+
+    staged.m_fielddata.clear();
+    staged.m_fielddata.swap(fielddata);
+
+    staged.m_fielddefs.resize(fielddefs.size());
+    for (int i = 0; i < fielddefs.size(); ++i)
+    {
+        staged.m_fielddefs[i] = MemoryManager<FieldDefinitions>
+            ::AllocateSharedPtr(*fielddefs[i]);
+    }
+
+    if (!m_comm->IsThreadSafe() || !v_SupportsAsyncWrite())
+    {
+        Write(staged.m_outFile, staged.m_fielddefs, staged.m_fielddata,
+              staged.m_fieldinfomap, staged.m_backup);
+        return;
+    }
+
+    // The previous output uses the other staging buffer.
+    WaitForWrite();
+
+    if (!m_asyncWriter)
+    {
+        m_asyncWriter = GetFieldIOFactory().CreateInstance(
+            GetClassName(), m_comm->CommCreateIf(1), m_sharedFilesystem);
+    }
+
+    unsigned int ticket;
+    {
+        boost::lock_guard<boost::mutex> lock(asyncWriteMutex);
+        ticket = asyncWriteTicket++;
+    }
+
+    m_asyncThread = boost::shared_ptr<boost::thread>(
+        new boost::thread(
+            boost::bind(&FieldIO::AsyncWrite, this, m_stagedIndex, ticket)));
+
+    m_stagedIndex = 1 - m_stagedIndex;
+}
+
+/**
+ * @brief Wait for the completion of the asynchronous output started by the
+ * last call to FieldIO::WriteAsync, if any.
+ */
+void FieldIO::WaitForWrite()
+{
+    if (m_asyncThread)
+    {
+        m_asyncThread->join();
+        m_asyncThread.reset();
+    }
+
+    if (!m_asyncError.empty())
+    {
+        std::string error;
+        error.swap(m_asyncError);
+        NEKERROR(ErrorUtil::efatal, "Asynchronous output failed: " + error);
+    }
+}
+
+/**
+ * @brief Body of the output thread, writing the staging buffer @p index once
+ * the outputs with earlier tickets than @p ticket have completed.
+ */
+void FieldIO::AsyncWrite(const int index, const unsigned int ticket)
+{
+    StagedWrite &staged = m_staged[index];
+
+    {
+        boost::unique_lock<boost::mutex> lock(asyncWriteMutex);
+        while (asyncWriteServing != ticket)
+        {
+            asyncWriteCond.wait(lock);
+        }
+    }
+
+    try
+    {
+        m_asyncWriter->Write(staged.m_outFile, staged.m_fielddefs,
+                             staged.m_fielddata, staged.m_fieldinfomap,
+                             staged.m_backup);
+    }
+    catch (const std::exception &e)
+    {
+        m_asyncError = e.what();
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(asyncWriteMutex);
+        ++asyncWriteServing;
+    }
+    asyncWriteCond.notify_all();
+}
+
 /**
  * @brief Add provenance information to the field metadata map.
  *
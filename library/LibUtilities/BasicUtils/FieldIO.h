@@ -44,6 +44,11 @@
 #include <LibUtilities/Foundations/Points.h>
 #include <tinyxml.h>
 
+namespace boost
+{
+class thread;
+}
+
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 
 namespace Nektar
@@ -227,9 +232,7 @@ public:
     LIB_UTILITIES_EXPORT FieldIO(
         LibUtilities::CommSharedPtr pComm, bool sharedFilesystem);
 
-    LIB_UTILITIES_EXPORT virtual ~FieldIO()
-    {
-    }
+    LIB_UTILITIES_EXPORT virtual ~FieldIO();
 
     LIB_UTILITIES_EXPORT inline void Write(
         const std::string &outFile,
@@ -238,6 +241,15 @@ public:
         const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
         const bool backup = false);
 
+    LIB_UTILITIES_EXPORT void WriteAsync(
+        const std::string &outFile,
+        const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+        std::vector<std::vector<NekDouble> > &fielddata,
+        const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
+        const bool backup = false);
+
+    LIB_UTILITIES_EXPORT void WaitForWrite();
+
     LIB_UTILITIES_EXPORT inline void Import(
         const std::string &infilename,
         std::vector<FieldDefinitionsSharedPtr> &fielddefs,
@@ -304,6 +316,39 @@ protected:
     /// @copydoc FieldIO::ImportFieldMetaData
     LIB_UTILITIES_EXPORT virtual DataSourceSharedPtr v_ImportFieldMetaData(
         const std::string &filename, FieldMetaDataMap &fieldmetadatamap) = 0;
+
+    /**
+     * @brief Whether this format can be written by the output thread of
+     * FieldIO::WriteAsync while the main thread continues.
+     */
+    LIB_UTILITIES_EXPORT virtual bool v_SupportsAsyncWrite() const
+    {
+        return true;
+    }
+
+private:
+    /// Copy of the data of an asynchronous output.
+    struct StagedWrite
+    {
+        std::string                            m_outFile;
+        std::vector<FieldDefinitionsSharedPtr> m_fielddefs;
+        std::vector<std::vector<NekDouble> >   m_fielddata;
+        FieldMetaDataMap                       m_fieldinfomap;
+        bool                                   m_backup;
+    };
+
+    /// Writer, on its own communicator, used by the output thread.
+    boost::shared_ptr<FieldIO>       m_asyncWriter;
+    /// Thread performing the current asynchronous output.
+    boost::shared_ptr<boost::thread> m_asyncThread;
+    /// Staging buffers: one is written while the other is filled.
+    StagedWrite                      m_staged[2];
+    /// Index of the staging buffer to be filled next.
+    int                              m_stagedIndex;
+    /// Error raised by the output thread.
+    std::string                      m_asyncError;
+
+    void AsyncWrite(const int index, const unsigned int ticket);
 };
 
 typedef boost::shared_ptr<FieldIO> FieldIOSharedPtr;
@@ -840,6 +840,26 @@ void FieldIOHdf5::v_Write(const std::string &outFile,
     }
 }
 
+/**
+ * @brief Returns true if the HDF5 library has been built thread-safe.
+ *
+ * The output thread of FieldIO::WriteAsync calls the HDF5 library while the
+ * main thread may also do so, for instance to write a field of another
+ * writer synchronously. This is only allowed if the library serialises its
+ * own calls, which is an option of the HDF5 build that parallel builds do not
+ * usually enable; otherwise HDF5 files are written synchronously.
+ */
+bool FieldIOHdf5::v_SupportsAsyncWrite() const
+{
+#if H5_VERSION_GE(1, 8, 16)
+    hbool_t threadSafe = 0;
+    H5is_library_threadsafe(&threadSafe);
+    return threadSafe > 0;
+#else
+    return false;
+#endif
+}
+
 /**
  * @brief Import a HDF5 format file.
  *
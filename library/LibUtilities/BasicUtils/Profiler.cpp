@@ -0,0 +1,358 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Profiler.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Hierarchical profiler of named code regions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <LibUtilities/Communication/Comm.h>
+
+using namespace std;
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+namespace
+{
+
+/// Statistics of a region of the profile tree.
+struct ProfileNode
+{
+    ProfileNode(const char *name, ProfileNode *parent)
+        : m_name(name), m_parent(parent), m_calls(0), m_time(0.0),
+          m_bytes(0.0)
+    {
+    }
+
+    const char                                *m_name;
+    ProfileNode                               *m_parent;
+    std::vector<boost::shared_ptr<ProfileNode> > m_children;
+    NekDouble                                  m_calls;
+    NekDouble                                  m_time;
+    NekDouble                                  m_bytes;
+};
+
+ProfileNode       s_root("", NULL);
+ProfileNode      *s_current = &s_root;
+boost::thread::id s_owner;
+
+/// Collect the full names of the regions below @p node, with their
+/// statistics.
+void Flatten(const ProfileNode            &node,
+             const std::string            &prefix,
+             std::vector<std::string>     &names,
+             std::vector<const ProfileNode *> &nodes)
+{
+    for (int i = 0; i < node.m_children.size(); ++i)
+    {
+        const ProfileNode &child = *node.m_children[i];
+        std::string name = prefix + child.m_name;
+
+        names.push_back(name);
+        nodes.push_back(&child);
+        Flatten(child, name + "/", names, nodes);
+    }
+}
+
+/// Order full region names so that each region is directly followed by its
+/// children, by treating the separator as smaller than any other character.
+struct RegionLess
+{
+    bool operator()(const std::string &a, const std::string &b) const
+    {
+        std::string::size_type i, n = std::min(a.size(), b.size());
+        for (i = 0; i < n; ++i)
+        {
+            if (a[i] != b[i])
+            {
+                return a[i] == '/' || (b[i] != '/' && a[i] < b[i]);
+            }
+        }
+        return a.size() < b.size();
+    }
+};
+
+typedef std::set<std::string, RegionLess> RegionSet;
+
+/// Encode a list of names as integers, one name per line.
+std::vector<int> EncodeNames(const std::vector<std::string> &names)
+{
+    std::vector<int> code;
+    for (int i = 0; i < names.size(); ++i)
+    {
+        code.insert(code.end(), names[i].begin(), names[i].end());
+        code.push_back('\n');
+    }
+    return code;
+}
+
+/// Decode a list of names encoded by EncodeNames into @p names.
+void DecodeNames(const std::vector<int> &code, RegionSet &names)
+{
+    std::string name;
+    for (int i = 0; i < code.size(); ++i)
+    {
+        if (code[i] == '\n')
+        {
+            names.insert(name);
+            name.clear();
+        }
+        else
+        {
+            name += static_cast<char>(code[i]);
+        }
+    }
+}
+
+}
+
+bool Profiler::s_enabled = false;
+
+/**
+ * Regions are only recorded on the calling thread, so that regions opened by
+ * worker threads, e.g. in threaded collection operators or asynchronous
+ * output, do not corrupt the tree.
+ */
+void Profiler::Enable()
+{
+    s_owner   = boost::this_thread::get_id();
+    s_enabled = true;
+}
+
+/**
+ * Returns false, without opening a region, if called from a thread other than
+ * the one which enabled the profiler.
+ */
+bool Profiler::Start(const char *name)
+{
+    if (boost::this_thread::get_id() != s_owner)
+    {
+        return false;
+    }
+
+    std::vector<boost::shared_ptr<ProfileNode> > &children =
+        s_current->m_children;
+
+    for (int i = 0; i < children.size(); ++i)
+    {
+        if (children[i]->m_name == name ||
+            strcmp(children[i]->m_name, name) == 0)
+        {
+            s_current = children[i].get();
+            return true;
+        }
+    }
+
+    children.push_back(boost::shared_ptr<ProfileNode>(
+                           new ProfileNode(name, s_current)));
+    s_current = children.back().get();
+    return true;
+}
+
+void Profiler::Stop(NekDouble time, std::size_t bytes)
+{
+    s_current->m_calls += 1.0;
+    s_current->m_time  += time;
+    s_current->m_bytes += bytes;
+    s_current = s_current->m_parent;
+}
+
+/**
+ * The set of regions recorded on any process is first gathered on the root
+ * process and broadcast. The number of calls, time and bytes of each region
+ * are then gathered and their minimum, average and maximum across processes
+ * written on the root process. The ratio of the maximum to the average time
+ * indicates the load imbalance of a region.
+ *
+ * This is a collective operation, and the profiler is disabled once it has
+ * been called.
+ */
+void Profiler::Report(const CommSharedPtr &comm, std::ostream &out)
+{
+    if (!s_enabled)
+    {
+        return;
+    }
+
+    // Communication of the report is not profiled.
+    s_enabled = false;
+
+    int rank   = comm->GetRank();
+    int nProcs = comm->GetSize();
+    int i, n;
+
+    std::vector<std::string>         localNames;
+    std::vector<const ProfileNode *> localNodes;
+    Flatten(s_root, "", localNames, localNodes);
+
+    // Gather the union of the regions of all processes.
+    RegionSet allNames(localNames.begin(), localNames.end());
+    std::vector<int> code, size(1);
+
+    if (rank == 0)
+    {
+        for (n = 1; n < nProcs; ++n)
+        {
+            comm->Recv(n, size);
+            code.resize(size[0]);
+            if (size[0] > 0)
+            {
+                comm->Recv(n, code);
+            }
+            DecodeNames(code, allNames);
+        }
+
+        code = EncodeNames(std::vector<std::string>(
+                               allNames.begin(), allNames.end()));
+        size[0] = code.size();
+    }
+    else
+    {
+        code    = EncodeNames(localNames);
+        size[0] = code.size();
+        comm->Send(0, size);
+        if (size[0] > 0)
+        {
+            comm->Send(0, code);
+        }
+    }
+
+    comm->Bcast(size, 0);
+    code.resize(size[0]);
+    if (size[0] > 0)
+    {
+        comm->Bcast(code, 0);
+    }
+
+    allNames.clear();
+    DecodeNames(code, allNames);
+
+    std::vector<std::string> names(allNames.begin(), allNames.end());
+    int nRegions = names.size();
+
+    if (nRegions == 0)
+    {
+        return;
+    }
+
+    // Statistics of this process for each region.
+    std::vector<NekDouble> calls(nRegions, 0.0);
+    std::vector<NekDouble> times(nRegions, 0.0);
+    std::vector<NekDouble> bytes(nRegions, 0.0);
+
+    for (i = 0; i < localNames.size(); ++i)
+    {
+        n = std::lower_bound(names.begin(), names.end(), localNames[i],
+                             RegionLess()) - names.begin();
+        calls[n] = localNodes[i]->m_calls;
+        times[n] = localNodes[i]->m_time;
+        bytes[n] = localNodes[i]->m_bytes;
+    }
+
+    std::vector<NekDouble> allCalls = comm->Gather(0, calls);
+    std::vector<NekDouble> allTimes = comm->Gather(0, times);
+    std::vector<NekDouble> allBytes = comm->Gather(0, bytes);
+
+    if (rank > 0)
+    {
+        return;
+    }
+
+    std::ios::fmtflags flags = out.flags();
+
+    out << "Profile of " << nProcs << " process"
+        << (nProcs > 1 ? "es" : "") << " (times in seconds)" << endl;
+    out << setw(40) << left << "Region" << right
+        << setw(12) << "Calls"
+        << setw(12) << "Min"
+        << setw(12) << "Avg"
+        << setw(12) << "Max"
+        << setw(10) << "Max/Avg"
+        << setw(12) << "MB" << endl;
+
+    for (i = 0; i < nRegions; ++i)
+    {
+        NekDouble tMin = allTimes[i], tMax = allTimes[i], tAvg = 0.0;
+        NekDouble cAvg = 0.0, bAvg = 0.0;
+
+        for (n = 0; n < nProcs; ++n)
+        {
+            NekDouble t = allTimes[n * nRegions + i];
+            tMin  = std::min(tMin, t);
+            tMax  = std::max(tMax, t);
+            tAvg += t;
+            cAvg += allCalls[n * nRegions + i];
+            bAvg += allBytes[n * nRegions + i];
+        }
+
+        tAvg /= nProcs;
+        cAvg /= nProcs;
+        bAvg /= nProcs;
+
+        // Indent each region below its parent.
+        std::string::size_type pos = names[i].rfind('/');
+        int depth = std::count(names[i].begin(), names[i].end(), '/');
+        std::string label = std::string(2 * depth, ' ') +
+            (pos == std::string::npos ? names[i] : names[i].substr(pos + 1));
+
+        out << setw(40) << left << label << right
+            << setw(12) << fixed << setprecision(0) << cAvg
+            << scientific << setprecision(3)
+            << setw(12) << tMin
+            << setw(12) << tAvg
+            << setw(12) << tMax
+            << setw(10) << fixed << setprecision(2)
+            << (tAvg > 0.0 ? tMax / tAvg : 1.0);
+
+        if (bAvg > 0.0)
+        {
+            out << setw(12) << fixed << setprecision(3) << bAvg / 1048576.0;
+        }
+        out << endl;
+    }
+
+    out.flags(flags);
+}
+
+}
+}
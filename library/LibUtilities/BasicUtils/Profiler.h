@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Profiler.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Hierarchical profiler of named code regions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_PROFILER_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_PROFILER_H
+
+#include <cstddef>
+#include <ostream>
+
+#include <boost/shared_ptr.hpp>
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+class Comm;
+
+/**
+ * @brief Records the number of calls, time and bytes of nested named regions
+ * of the code.
+ *
+ * Regions are opened and closed by ProfileRegion objects. A region opened
+ * while another is open is recorded as its child, so that the same name may
+ * appear in several places of the tree, e.g. the conjugate gradient iterations
+ * of the pressure and of the velocity solves. Only regions of the thread which
+ * enabled the profiler are recorded.
+ *
+ * When the profiler is not enabled, the cost of a region is a single test of a
+ * static flag.
+ */
+class Profiler
+{
+public:
+    /// Start recording regions of the calling thread.
+    LIB_UTILITIES_EXPORT static void Enable();
+
+    /// Returns true if regions are being recorded.
+    static bool IsEnabled()
+    {
+        return s_enabled;
+    }
+
+    /// Open the region @p name as a child of the current region.
+    LIB_UTILITIES_EXPORT static bool Start(const char *name);
+
+    /// Close the current region.
+    LIB_UTILITIES_EXPORT static void Stop(NekDouble time, std::size_t bytes);
+
+    /// Write the statistics of the regions across all processes of @p comm.
+    LIB_UTILITIES_EXPORT static void Report(
+        const boost::shared_ptr<Comm> &comm, std::ostream &out);
+
+private:
+    LIB_UTILITIES_EXPORT static bool s_enabled;
+};
+
+/**
+ * @brief Scoped region of the Profiler, which is open for the lifetime of the
+ * object.
+ *
+ * @code
+ * {
+ *     LibUtilities::ProfileRegion region("PressureSolve");
+ *     ...
+ * }
+ * @endcode
+ *
+ * @p name must remain valid until the profile has been reported, which is the
+ * case for string literals.
+ */
+class ProfileRegion
+{
+public:
+    ProfileRegion(const char *name)
+        : m_active(Profiler::IsEnabled() && Profiler::Start(name)),
+          m_bytes(0)
+    {
+        if (m_active)
+        {
+            m_timer.Start();
+        }
+    }
+
+    ~ProfileRegion()
+    {
+        if (m_active)
+        {
+            m_timer.Stop();
+            Profiler::Stop(m_timer.TimePerTest(1), m_bytes);
+        }
+    }
+
+    /// Returns true if the region is being recorded.
+    bool IsActive() const
+    {
+        return m_active;
+    }
+
+    /// Add @p bytes to the data volume of the region.
+    void AddBytes(std::size_t bytes)
+    {
+        m_bytes += bytes;
+    }
+
+private:
+    ProfileRegion(const ProfileRegion &);
+    ProfileRegion &operator=(const ProfileRegion &);
+
+    bool        m_active;
+    std::size_t m_bytes;
+    Timer       m_timer;
+};
+
+}
+}
+
+#endif
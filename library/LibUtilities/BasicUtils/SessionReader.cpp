@@ -56,6 +56,8 @@ using namespace std;
 #include <LibUtilities/BasicUtils/MeshPartition.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 #include <boost/program_options.hpp>
 #include <boost/format.hpp>
@@ -184,7 +186,8 @@ namespace Nektar
          */
         SessionReader::SessionReader(int argc, char *argv[])
         {
-            m_xmlDoc    = 0;
+            m_xmlDoc     = 0;
+            m_numThreads = 0;
             m_filenames = ParseCommandLineArguments(argc, argv);
 
             ASSERTL0(m_filenames.size() > 0, "No session file(s) given.");
@@ -219,6 +222,7 @@ namespace Nektar
 
             ParseCommandLineArguments(argc, argv);
             m_xmlDoc      = 0;
+            m_numThreads  = 0;
             m_filenames   = pFilenames;
 
             m_sessionName = ParseSessionName(m_filenames);
@@ -286,6 +290,9 @@ namespace Nektar
             // Verify SOLVERINFO values
             VerifySolverInfo();
 
+            // Start the thread pool if requested
+            StartThreads();
+
             // In verbose mode, print out parameters and solver info sections
             if (m_verbose && m_comm)
             {
@@ -382,6 +389,8 @@ namespace Nektar
                 ("part-only-overlapping",    po::value<int>(),
                                  "only partition mesh into N overlapping partitions.")
                 ("part-info",    "Output partition information")
+                ("profile",      "profile regions of the code and write "
+                                 "their statistics on exit")
             ;
 
             CmdLineArgMap::const_iterator cmdIt;
@@ -481,6 +490,12 @@ namespace Nektar
                 m_verbose = false;
             }
 
+            // Enable profiling
+            if (m_cmdLineOptions.count("profile"))
+            {
+                Profiler::Enable();
+            }
+
             // Print a warning for unknown options
             std::vector< po::basic_option<char> >::iterator x;
             for (x = parsed.options.begin(); x != parsed.options.end(); ++x)
@@ -665,6 +680,15 @@ namespace Nektar
             return m_sharedFilesystem;
         }
 
+        /**
+         * Returns zero if NUMTHREADS is not defined, in which case all
+         * operations run in the master thread.
+         */
+        int SessionReader::GetNumThreads() const
+        {
+            return m_numThreads;
+        }
+
         /**
          * This routine finalises any parallel communication.
          *
@@ -673,6 +697,7 @@ namespace Nektar
          */
         void SessionReader::Finalise()
         {
+            Profiler::Report(m_comm, cout);
             m_comm->Finalise();
         }
 
@@ -2705,6 +2730,58 @@ namespace Nektar
         }
 
 
+        /**
+         * If the NUMTHREADS solver info property is set, the SessionJob
+         * ThreadManager is created with the requested number of worker
+         * threads per process. This pool is shared by all threaded parts of
+         * the library. Threads are only started when the library has been
+         * built with NEKTAR_USE_THREAD_SAFETY; otherwise the work is still
+         * decomposed in the same way but executed by the master thread.
+         */
+        void SessionReader::StartThreads()
+        {
+            if (!DefinesSolverInfo("NUMTHREADS"))
+            {
+                return;
+            }
+
+            try
+            {
+                m_numThreads = boost::lexical_cast<int>(
+                    GetSolverInfo("NUMTHREADS"));
+            }
+            catch (...)
+            {
+                ASSERTL0(false, "NUMTHREADS must be a positive integer.");
+            }
+            ASSERTL0(m_numThreads > 0, "NUMTHREADS must be a positive integer.");
+
+#ifdef NEKTAR_USE_THREAD_SAFETY
+            Thread::ThreadMaster &master = Thread::GetThreadMaster();
+            if (m_numThreads > 1 &&
+                !master.GetInstance(Thread::ThreadMaster::SessionJob)
+                                                        ->IsInitialised())
+            {
+                master.SetThreadingType("ThreadManagerBoost");
+                master.CreateInstance(Thread::ThreadMaster::SessionJob,
+                                      m_numThreads);
+            }
+#else
+            if (m_numThreads > 1 && m_comm->GetRank() == 0)
+            {
+                cout << "Warning: NUMTHREADS = " << m_numThreads << " ignored "
+                     << "since Nektar++ was built without "
+                     << "NEKTAR_USE_THREAD_SAFETY." << endl;
+            }
+#endif
+
+            if (m_verbose && m_comm->GetRank() == 0)
+            {
+                cout << "Threads per process: " << m_numThreads << endl;
+            }
+        }
+
+
         void SessionReader::SetUpXmlDoc(void)
         {
             m_xmlDoc = MergeDoc(m_filenames);
@@ -197,6 +197,8 @@ namespace Nektar
             LIB_UTILITIES_EXPORT CommSharedPtr &GetComm();
             /// Returns the communication object.
             LIB_UTILITIES_EXPORT bool GetSharedFilesystem();
+            /// Returns the number of threads requested by NUMTHREADS.
+            LIB_UTILITIES_EXPORT int GetNumThreads() const;
             /// Finalises the session.
             LIB_UTILITIES_EXPORT void Finalise();
 
@@ -461,6 +463,8 @@ namespace Nektar
             bool                                      m_verbose;
             /// Running on a shared filesystem
             bool                                      m_sharedFilesystem;
+            /// Number of threads per process (0 if NUMTHREADS is not set)
+            int                                       m_numThreads;
             /// Map of original composite ordering for parallel periodic bcs.
             CompositeOrdering                         m_compOrder;
             /// Map of original boundary region ordering for parallel periodic
@@ -533,6 +537,8 @@ namespace Nektar
             LIB_UTILITIES_EXPORT void CmdLineOverride();
             /// Check values of solver info options are valid.
             LIB_UTILITIES_EXPORT void VerifySolverInfo();
+            /// Starts the session thread pool if requested by NUMTHREADS.
+            LIB_UTILITIES_EXPORT void StartThreads();
 
             /// Parse a string in the form lhs = rhs.
             LIB_UTILITIES_EXPORT void ParseEquals(
@@ -51,6 +51,36 @@ namespace Nektar
 {
     class LinearSystem;
 
+    namespace detail
+    {
+        /// \internal
+        /// \brief Increments the reference count of an array's storage.
+        ///
+        /// When Nektar++ is built with NEKTAR_USE_THREAD_SAFETY the update is
+        /// atomic, so that arrays may be shared between worker threads.
+        inline void IncrementArrayCount(unsigned int* count)
+        {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+            __sync_add_and_fetch(count, 1u);
+#else
+            *count += 1;
+#endif
+        }
+
+        /// \internal
+        /// \brief Decrements the reference count of an array's storage and
+        /// returns the updated count.
+        inline unsigned int DecrementArrayCount(unsigned int* count)
+        {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+            return __sync_sub_and_fetch(count, 1u);
+#else
+            *count -= 1;
+            return *count;
+#endif
+        }
+    }
+
     // Forward declaration for a ConstArray constructor.
     template<typename Dim, typename DataType>
     class Array;
@@ -153,7 +183,7 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                detail::IncrementArrayCount(m_count);
                 ASSERTL0(m_size <= rhs.num_elements(), "Requested size is larger than input array size.");
             }
 
@@ -165,7 +195,7 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                detail::IncrementArrayCount(m_count);
             }
 
             ~Array()
@@ -175,8 +205,7 @@ namespace Nektar
                     return;
                 }
 
-                *m_count -= 1;
-                if( *m_count == 0 )
+                if( detail::DecrementArrayCount(m_count) == 0 )
                 {
                     ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
                     MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
@@ -186,8 +215,7 @@ namespace Nektar
             /// \brief Creates a reference to rhs.
             Array<OneD, const DataType>& operator=(const Array<OneD, const DataType>& rhs)
             {
-                *m_count -= 1;
-                if( *m_count == 0 )
+                if( detail::DecrementArrayCount(m_count) == 0 )
                 {
                     ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
                     MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
@@ -196,7 +224,7 @@ namespace Nektar
                 m_data = rhs.m_data;
                 m_capacity = rhs.m_capacity;
                 m_count = rhs.m_count;
-                *m_count += 1;
+                detail::IncrementArrayCount(m_count);
                 m_offset = rhs.m_offset;
                 m_size = rhs.m_size;
                 return *this;
@@ -207,6 +207,61 @@ ThreadManagerSharedPtr ThreadMaster::CreateInstance(const ThreadManagerName t,
 }
 
 
+/**
+ * @return The number of workers of the session thread pool if RunSessionJobs
+ * would queue jobs on it, or one if the jobs would be run by the calling
+ * thread. The result may be used to allocate per-worker storage, indexed by
+ * ThreadJob::GetWorkerNum.
+ */
+unsigned int GetNumSessionJobWorkers()
+{
+    ThreadManagerSharedPtr tm =
+        GetThreadMaster().GetInstance(ThreadMaster::SessionJob);
+
+    if (tm->IsInitialised() && tm->GetMaxNumWorkers() > 1 && !tm->InThread())
+    {
+        return tm->GetMaxNumWorkers();
+    }
+    return 1;
+}
+
+
+/**
+ * @param jobs      Jobs to run, which are deleted once run and removed.
+ * @param threaded  Whether the jobs may be run on the thread pool.
+ *
+ * If the session thread pool is running with several workers, there are
+ * several jobs, and the caller is not itself a job running on the pool, the
+ * jobs are queued on the pool and this call returns once all of them are
+ * complete. Otherwise the jobs are run in order by the calling thread, as
+ * worker zero.
+ */
+void RunSessionJobs(std::vector<ThreadJob*> &jobs, const bool threaded)
+{
+    if (threaded && jobs.size() > 1 && GetNumSessionJobWorkers() > 1)
+    {
+        ThreadManagerSharedPtr tm =
+            GetThreadMaster().GetInstance(ThreadMaster::SessionJob);
+
+        tm->SetNumWorkers(0);
+        tm->QueueJobs(jobs);
+        tm->SetNumWorkers();
+        tm->Wait();
+    }
+    else
+    {
+        for (int i = 0; i < jobs.size(); ++i)
+        {
+            jobs[i]->SetWorkerNum(0);
+            jobs[i]->Run();
+            delete jobs[i];
+        }
+    }
+
+    jobs.clear();
+}
+
+
 /**
  * @brief ThreadDefaultManager
  */
@@ -370,6 +370,13 @@ class ThreadMaster
 };
 LIB_UTILITIES_EXPORT ThreadMaster& GetThreadMaster();
 
+/// Number of workers that RunSessionJobs runs jobs on.
+LIB_UTILITIES_EXPORT unsigned int GetNumSessionJobWorkers();
+
+/// Runs and deletes jobs, on the session thread pool if it is running.
+LIB_UTILITIES_EXPORT void RunSessionJobs(
+    std::vector<ThreadJob*> &jobs, const bool threaded = true);
+
 
 /**
  * @brief A default ThreadManager.
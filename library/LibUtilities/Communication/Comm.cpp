@@ -40,11 +40,11 @@ namespace Nektar
 {
 namespace LibUtilities
 {
-Comm::Comm(int narg, char *arg[])
+Comm::Comm(int narg, char *arg[]) : m_threadSafe(true)
 {
 }
 
-Comm::Comm()
+Comm::Comm() : m_threadSafe(true)
 {
 }
 
@@ -46,6 +46,7 @@
 // namespace Nektar { template <typename Dim, typename DataType> class Array; }
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <LibUtilities/Communication/CommDataType.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 namespace Nektar
 {
@@ -71,6 +72,21 @@ enum ReduceOperator
     ReduceMin
 };
 
+/// Handle to a non-blocking communication, which is completed by Comm::Wait,
+/// Comm::WaitAll or a successful Comm::Test.
+class CommRequest
+{
+public:
+    virtual ~CommRequest()
+    {
+    }
+};
+
+/// Pointer to a CommRequest object.
+typedef boost::shared_ptr<CommRequest> CommRequestSharedPtr;
+/// Vector of CommRequest objects.
+typedef std::vector<CommRequestSharedPtr> CommRequestVector;
+
 /// Base communications class
 class Comm : public boost::enable_shared_from_this<Comm>
 {
@@ -97,8 +113,19 @@ public:
     void SendRecv(int pSendProc, T &pSendData, int pRecvProc, T &pRecvData);
     template <class T>
     void SendRecvReplace(int pSendProc, int pRecvProc, T &pData);
+    template <class T> CommRequestSharedPtr Isend(int pProc, T &pData);
+    template <class T> CommRequestSharedPtr Irecv(int pProc, T &pData);
 
     template <class T> void AllReduce(T &pData, enum ReduceOperator pOp);
+    template <class T>
+    CommRequestSharedPtr IAllReduce(T &pData, enum ReduceOperator pOp);
+
+    /// Block until a non-blocking communication has completed
+    LIB_UTILITIES_EXPORT inline void Wait(CommRequestSharedPtr pRequest);
+    /// Block until all of a set of non-blocking communications have completed
+    LIB_UTILITIES_EXPORT inline void WaitAll(CommRequestVector &pRequests);
+    /// Returns true if a non-blocking communication has completed
+    LIB_UTILITIES_EXPORT inline bool Test(CommRequestSharedPtr pRequest);
 
     template <class T> void AlltoAll(T &pSendData, T &pRecvData);
     template <class T>
@@ -108,6 +135,13 @@ public:
                    Array<OneD, T> &pRecvData,
                    Array<OneD, int> &pRecvDataSizeMap,
                    Array<OneD, int> &pRecvDataOffsetMap);
+    template <class T>
+    CommRequestSharedPtr IAlltoAllv(Array<OneD, T> &pSendData,
+                                    Array<OneD, int> &pSendDataSizeMap,
+                                    Array<OneD, int> &pSendDataOffsetMap,
+                                    Array<OneD, T> &pRecvData,
+                                    Array<OneD, int> &pRecvDataSizeMap,
+                                    Array<OneD, int> &pRecvDataOffsetMap);
 
     template <class T> void Bcast(T &data, int rootProc);
 
@@ -115,6 +149,12 @@ public:
     void Exscan(T &pData, const enum ReduceOperator pOp, T &ans);
 
     template <class T> T Gather(const int rootProc, T &val);
+    template <class T>
+    void Gatherv(Array<OneD, T> &pSendData,
+                 Array<OneD, T> &pRecvData,
+                 Array<OneD, int> &pRecvDataSizeMap,
+                 Array<OneD, int> &pRecvDataOffsetMap,
+                 const int rootProc);
     template <class T> T Scatter(const int rootProc, T &pData);
 
     LIB_UTILITIES_EXPORT inline CommSharedPtr CommCreateIf(int flag);
@@ -126,9 +166,14 @@ public:
     LIB_UTILITIES_EXPORT inline bool TreatAsRankZero(void);
     LIB_UTILITIES_EXPORT inline bool RemoveExistingFiles(void);
 
+    /// Returns true if the communicator may be used from several threads
+    /// concurrently.
+    LIB_UTILITIES_EXPORT inline bool IsThreadSafe() const;
+
 protected:
     int m_size;                 ///< Number of processes
     std::string m_type;         ///< Type of communication
+    bool m_threadSafe;          ///< Concurrent use from threads is supported
     CommSharedPtr m_commRow;    ///< Row communicator
     CommSharedPtr m_commColumn; ///< Column communicator
 
@@ -145,8 +190,18 @@ protected:
                             CommDataType recvtype, int source) = 0;
     virtual void v_SendRecvReplace(void *buf, int count, CommDataType dt,
                                    int pSendProc, int pRecvProc) = 0;
+    virtual CommRequestSharedPtr v_Isend(void *buf, int count, CommDataType dt,
+                                         int dest) = 0;
+    virtual CommRequestSharedPtr v_Irecv(void *buf, int count, CommDataType dt,
+                                         int source) = 0;
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp) = 0;
+    virtual CommRequestSharedPtr v_IAllReduce(void *buf, int count,
+                                              CommDataType dt,
+                                              enum ReduceOperator pOp) = 0;
+    virtual void v_Wait(CommRequestSharedPtr pRequest) = 0;
+    virtual void v_WaitAll(CommRequestVector &pRequests) = 0;
+    virtual bool v_Test(CommRequestSharedPtr pRequest) = 0;
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount,
                             CommDataType recvtype) = 0;
@@ -154,6 +209,10 @@ protected:
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype) = 0;
+    virtual CommRequestSharedPtr v_IAlltoAllv(
+        void *sendbuf, int sendcounts[], int sensdispls[],
+        CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
+        CommDataType recvtype) = 0;
     virtual void v_Bcast(void *buffer, int count, CommDataType dt,
                          int root) = 0;
 
@@ -164,6 +223,9 @@ protected:
     virtual void v_Gather(void *sendbuf, int sendcount, CommDataType sendtype,
                           void *recvbuf, int recvcount, CommDataType recvtype,
                           int root) = 0;
+    virtual void v_Gatherv(void *sendbuf, int sendcount, CommDataType sendtype,
+                           void *recvbuf, int recvcounts[], int rdispls[],
+                           CommDataType recvtype, int root) = 0;
     virtual void v_Scatter(void *sendbuf, int sendcount, CommDataType sendtype,
                            void *recvbuf, int recvcount, CommDataType recvtype,
                            int root) = 0;
@@ -211,6 +273,8 @@ inline const std::string &Comm::GetType() const
  */
 inline void Comm::Block()
 {
+    ProfileRegion region("Comm::Block");
+
     v_Block();
 }
 
@@ -222,8 +286,24 @@ inline double Comm::Wtime()
     return v_Wtime();
 }
 
+/**
+ * Adds the size of @p pData to the data volume of the profiled region @p
+ * region.
+ */
+template <class T> inline void ProfileBytes(ProfileRegion &region, T &pData)
+{
+    if (region.IsActive())
+    {
+        region.AddBytes(CommDataTypeTraits<T>::GetCount(pData) *
+            CommDataTypeGetSize(CommDataTypeTraits<T>::GetDataType()));
+    }
+}
+
 template <class T> void Comm::Send(int pProc, T &pData)
 {
+    ProfileRegion region("Comm::Send");
+    ProfileBytes(region, pData);
+
     v_Send(CommDataTypeTraits<T>::GetPointer(pData),
            CommDataTypeTraits<T>::GetCount(pData),
            CommDataTypeTraits<T>::GetDataType(), pProc);
@@ -231,6 +311,9 @@ template <class T> void Comm::Send(int pProc, T &pData)
 
 template <class T> void Comm::Recv(int pProc, T &pData)
 {
+    ProfileRegion region("Comm::Recv");
+    ProfileBytes(region, pData);
+
     v_Recv(CommDataTypeTraits<T>::GetPointer(pData),
            CommDataTypeTraits<T>::GetCount(pData),
            CommDataTypeTraits<T>::GetDataType(), pProc);
@@ -242,6 +325,9 @@ template <class T> void Comm::Recv(int pProc, T &pData)
 template <class T>
 void Comm::SendRecv(int pSendProc, T &pSendData, int pRecvProc, T &pRecvData)
 {
+    ProfileRegion region("Comm::SendRecv");
+    ProfileBytes(region, pSendData);
+
     v_SendRecv(CommDataTypeTraits<T>::GetPointer(pSendData),
                CommDataTypeTraits<T>::GetCount(pSendData),
                CommDataTypeTraits<T>::GetDataType(), pSendProc,
@@ -256,24 +342,106 @@ void Comm::SendRecv(int pSendProc, T &pSendData, int pRecvProc, T &pRecvData)
 template <class T>
 void Comm::SendRecvReplace(int pSendProc, int pRecvProc, T &pData)
 {
+    ProfileRegion region("Comm::SendRecvReplace");
+    ProfileBytes(region, pData);
+
     v_SendRecvReplace(CommDataTypeTraits<T>::GetPointer(pData),
                       CommDataTypeTraits<T>::GetCount(pData),
                       CommDataTypeTraits<T>::GetDataType(), pSendProc,
                       pRecvProc);
 }
 
+/**
+ * Starts sending @p pData to process @p pProc. @p pData must not be modified
+ * until the returned request has completed.
+ */
+template <class T> CommRequestSharedPtr Comm::Isend(int pProc, T &pData)
+{
+    ProfileRegion region("Comm::Isend");
+    ProfileBytes(region, pData);
+
+    return v_Isend(CommDataTypeTraits<T>::GetPointer(pData),
+                   CommDataTypeTraits<T>::GetCount(pData),
+                   CommDataTypeTraits<T>::GetDataType(), pProc);
+}
+
+/**
+ * Starts receiving @p pData from process @p pProc. @p pData must not be
+ * accessed until the returned request has completed.
+ */
+template <class T> CommRequestSharedPtr Comm::Irecv(int pProc, T &pData)
+{
+    ProfileRegion region("Comm::Irecv");
+    ProfileBytes(region, pData);
+
+    return v_Irecv(CommDataTypeTraits<T>::GetPointer(pData),
+                   CommDataTypeTraits<T>::GetCount(pData),
+                   CommDataTypeTraits<T>::GetDataType(), pProc);
+}
+
 /**
  *
  */
 template <class T> void Comm::AllReduce(T &pData, enum ReduceOperator pOp)
 {
+    ProfileRegion region("Comm::AllReduce");
+    ProfileBytes(region, pData);
+
     v_AllReduce(CommDataTypeTraits<T>::GetPointer(pData),
                 CommDataTypeTraits<T>::GetCount(pData),
                 CommDataTypeTraits<T>::GetDataType(), pOp);
 }
 
+/**
+ * Starts a reduction of @p pData over all processes and returns without
+ * waiting for it to complete. @p pData must not be accessed until Wait has
+ * been called on the returned request.
+ */
+template <class T>
+CommRequestSharedPtr Comm::IAllReduce(T &pData, enum ReduceOperator pOp)
+{
+    ProfileRegion region("Comm::IAllReduce");
+    ProfileBytes(region, pData);
+
+    return v_IAllReduce(CommDataTypeTraits<T>::GetPointer(pData),
+                        CommDataTypeTraits<T>::GetCount(pData),
+                        CommDataTypeTraits<T>::GetDataType(), pOp);
+}
+
+/**
+ *
+ */
+inline void Comm::Wait(CommRequestSharedPtr pRequest)
+{
+    ProfileRegion region("Comm::Wait");
+
+    v_Wait(pRequest);
+}
+
+/**
+ *
+ */
+inline void Comm::WaitAll(CommRequestVector &pRequests)
+{
+    ProfileRegion region("Comm::WaitAll");
+
+    v_WaitAll(pRequests);
+}
+
+/**
+ * Does not block. Once this has returned true the request is complete and
+ * need not be waited on.
+ */
+inline bool Comm::Test(CommRequestSharedPtr pRequest)
+{
+    return v_Test(pRequest);
+}
+
 template <class T> void Comm::AlltoAll(T &pSendData, T &pRecvData)
 {
+    ProfileRegion region("Comm::AlltoAll");
+    ProfileBytes(region, pSendData);
+
     BOOST_STATIC_ASSERT_MSG(
         CommDataTypeTraits<T>::IsVector,
         "AlltoAll only valid with Array or vector arguments.");
@@ -303,17 +471,45 @@ void Comm::AlltoAllv(Array<OneD, T> &pSendData,
                      Array<OneD, int> &pRecvDataSizeMap,
                      Array<OneD, int> &pRecvDataOffsetMap)
 {
+    ProfileRegion region("Comm::AlltoAllv");
+    ProfileBytes(region, pSendData);
+
     v_AlltoAllv(pSendData.get(), pSendDataSizeMap.get(),
                 pSendDataOffsetMap.get(), CommDataTypeTraits<T>::GetDataType(),
                 pRecvData.get(), pRecvDataSizeMap.get(),
                 pRecvDataOffsetMap.get(), CommDataTypeTraits<T>::GetDataType());
 }
 
+/**
+ * Non-blocking version of AlltoAllv. None of the arrays may be accessed until
+ * the returned request has completed.
+ */
+template <class T>
+CommRequestSharedPtr Comm::IAlltoAllv(Array<OneD, T> &pSendData,
+                                      Array<OneD, int> &pSendDataSizeMap,
+                                      Array<OneD, int> &pSendDataOffsetMap,
+                                      Array<OneD, T> &pRecvData,
+                                      Array<OneD, int> &pRecvDataSizeMap,
+                                      Array<OneD, int> &pRecvDataOffsetMap)
+{
+    ProfileRegion region("Comm::IAlltoAllv");
+    ProfileBytes(region, pSendData);
+
+    return v_IAlltoAllv(
+        pSendData.get(), pSendDataSizeMap.get(), pSendDataOffsetMap.get(),
+        CommDataTypeTraits<T>::GetDataType(), pRecvData.get(),
+        pRecvDataSizeMap.get(), pRecvDataOffsetMap.get(),
+        CommDataTypeTraits<T>::GetDataType());
+}
+
 /**
  *
  */
 template <class T> void Comm::Bcast(T &pData, int pRoot)
 {
+    ProfileRegion region("Comm::Bcast");
+    ProfileBytes(region, pData);
+
     v_Bcast(CommDataTypeTraits<T>::GetPointer(pData),
             CommDataTypeTraits<T>::GetCount(pData),
             CommDataTypeTraits<T>::GetDataType(), pRoot);
@@ -352,6 +548,28 @@ template <class T> T Comm::Gather(const int rootProc, T &val)
              CommDataTypeTraits<T>::GetDataType(), rootProc);
     return ans;
 }
+/**
+ * Concatenate input arrays of different lengths, in rank order, onto the
+ * process with rank == rootProc. The data of rank i is placed at offset
+ * pRecvDataOffsetMap[i] of pRecvData and has length pRecvDataSizeMap[i].
+ * The receive arguments are only accessed on the root process.
+ */
+template <class T>
+void Comm::Gatherv(Array<OneD, T> &pSendData,
+                   Array<OneD, T> &pRecvData,
+                   Array<OneD, int> &pRecvDataSizeMap,
+                   Array<OneD, int> &pRecvDataOffsetMap,
+                   const int rootProc)
+{
+    ProfileRegion region("Comm::Gatherv");
+    ProfileBytes(region, pSendData);
+
+    v_Gatherv(pSendData.get(), pSendData.num_elements(),
+              CommDataTypeTraits<T>::GetDataType(), pRecvData.get(),
+              pRecvDataSizeMap.get(), pRecvDataOffsetMap.get(),
+              CommDataTypeTraits<T>::GetDataType(), rootProc);
+}
+
 /**
  * Scatter pData across ranks in chunks of len(pData)/num_ranks
  */
@@ -431,6 +649,11 @@ inline bool Comm::RemoveExistingFiles(void)
 {
     return v_RemoveExistingFiles();
 }
+
+inline bool Comm::IsThreadSafe() const
+{
+    return m_threadSafe;
+}
 }
 }
 
@@ -78,7 +78,7 @@ template <typename Dim, typename DataType> class Array;
 
 namespace LibUtilities
 {
-int CommDataTypeGetSize(CommDataType);
+LIB_UTILITIES_EXPORT int CommDataTypeGetSize(CommDataType);
 
 template <class T> class CommDataTypeTraits
 {
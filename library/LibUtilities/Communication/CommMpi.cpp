@@ -56,7 +56,13 @@ CommMpi::CommMpi(int narg, char *arg[]) : Comm(narg, arg)
     MPI_Initialized(&init);
     ASSERTL0(!init, "MPI has already been initialised.");
 
+#ifdef NEKTAR_USE_THREAD_SAFETY
+    // Threads may communicate, e.g. for asynchronous field output.
+    int provided = MPI_THREAD_SINGLE;
+    int retval = MPI_Init_thread(&narg, &arg, MPI_THREAD_MULTIPLE, &provided);
+#else
     int retval = MPI_Init(&narg, &arg);
+#endif
     if (retval != MPI_SUCCESS)
     {
         ASSERTL0(false, "Failed to initialise MPI");
@@ -66,6 +72,8 @@ CommMpi::CommMpi(int narg, char *arg[]) : Comm(narg, arg)
     MPI_Comm_size(m_comm, &m_size);
     MPI_Comm_rank(m_comm, &m_rank);
 
+    SetThreadSafe();
+
 #ifdef NEKTAR_USING_PETSC
     PetscInitializeNoArguments();
 #endif
@@ -82,9 +90,22 @@ CommMpi::CommMpi(MPI_Comm pComm) : Comm()
     MPI_Comm_size(m_comm, &m_size);
     MPI_Comm_rank(m_comm, &m_rank);
 
+    SetThreadSafe();
+
     m_type = "Parallel MPI";
 }
 
+/**
+ * Records whether MPI was initialised with support for concurrent calls from
+ * several threads.
+ */
+void CommMpi::SetThreadSafe()
+{
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    m_threadSafe = provided == MPI_THREAD_MULTIPLE;
+}
+
 /**
  *
  */
@@ -210,36 +231,166 @@ void CommMpi::v_SendRecvReplace(void *buf, int count, CommDataType dt,
              "MPI error performing Send-Receive-Replace of data.");
 }
 
+/**
+ * Starts a send of @p buf to @p dest, which is complete once the returned
+ * request has been waited on.
+ */
+CommRequestSharedPtr CommMpi::v_Isend(void *buf, int count, CommDataType dt,
+                                      int dest)
+{
+    CommRequestMpiSharedPtr req =
+        MemoryManager<CommRequestMpi>::AllocateSharedPtr();
+
+    int retval = MPI_Isend(buf, count, dt, dest, 0, m_comm, &req->m_request);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing non-blocking Send.");
+
+    return req;
+}
+
 /**
  *
  */
-void CommMpi::v_AllReduce(void *buf, int count, CommDataType dt,
-                          enum ReduceOperator pOp)
+CommRequestSharedPtr CommMpi::v_Irecv(void *buf, int count, CommDataType dt,
+                                      int source)
 {
-    if (GetSize() == 1)
-    {
-        return;
-    }
+    CommRequestMpiSharedPtr req =
+        MemoryManager<CommRequestMpi>::AllocateSharedPtr();
 
-    MPI_Op vOp;
+    int retval = MPI_Irecv(buf, count, dt, source, 0, m_comm, &req->m_request);
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking Receive.");
+
+    return req;
+}
+
+/**
+ * Converts a ReduceOperator to the equivalent MPI operation.
+ */
+static MPI_Op GetMpiOp(enum ReduceOperator pOp)
+{
     switch (pOp)
     {
         case ReduceMax:
-            vOp = MPI_MAX;
-            break;
+            return MPI_MAX;
         case ReduceMin:
-            vOp = MPI_MIN;
-            break;
+            return MPI_MIN;
         case ReduceSum:
         default:
-            vOp = MPI_SUM;
-            break;
+            return MPI_SUM;
+    }
+}
+
+/**
+ *
+ */
+void CommMpi::v_AllReduce(void *buf, int count, CommDataType dt,
+                          enum ReduceOperator pOp)
+{
+    if (GetSize() == 1)
+    {
+        return;
     }
-    int retval = MPI_Allreduce(MPI_IN_PLACE, buf, count, dt, vOp, m_comm);
+
+    int retval = MPI_Allreduce(MPI_IN_PLACE, buf, count, dt, GetMpiOp(pOp),
+                               m_comm);
 
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-reduce.");
 }
 
+/**
+ * Non-blocking reductions require MPI-3. With older MPI implementations the
+ * reduction is performed immediately and the returned request is complete.
+ */
+CommRequestSharedPtr CommMpi::v_IAllReduce(void *buf, int count,
+                                           CommDataType dt,
+                                           enum ReduceOperator pOp)
+{
+    CommRequestMpiSharedPtr req =
+        MemoryManager<CommRequestMpi>::AllocateSharedPtr();
+
+    if (GetSize() == 1)
+    {
+        return req;
+    }
+
+#if MPI_VERSION >= 3
+    int retval = MPI_Iallreduce(MPI_IN_PLACE, buf, count, dt, GetMpiOp(pOp),
+                                m_comm, &req->m_request);
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking All-reduce.");
+#else
+    v_AllReduce(buf, count, dt, pOp);
+#endif
+
+    return req;
+}
+
+/**
+ *
+ */
+void CommMpi::v_Wait(CommRequestSharedPtr pRequest)
+{
+    CommRequestMpiSharedPtr req =
+        boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+    ASSERTL0(req, "Request was not created by an MPI communicator.");
+
+    int retval = MPI_Wait(&req->m_request, MPI_STATUS_IGNORE);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error waiting for request.");
+}
+
+/**
+ *
+ */
+void CommMpi::v_WaitAll(CommRequestVector &pRequests)
+{
+    int n = pRequests.size();
+    if (n == 0)
+    {
+        return;
+    }
+
+    std::vector<MPI_Request> vRequests(n);
+    std::vector<CommRequestMpiSharedPtr> vMpiRequests(n);
+    for (int i = 0; i < n; ++i)
+    {
+        vMpiRequests[i] =
+            boost::dynamic_pointer_cast<CommRequestMpi>(pRequests[i]);
+        ASSERTL0(vMpiRequests[i],
+                 "Request was not created by an MPI communicator.");
+        vRequests[i] = vMpiRequests[i]->m_request;
+    }
+
+    int retval = MPI_Waitall(n, &vRequests[0], MPI_STATUSES_IGNORE);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error waiting for requests.");
+
+    for (int i = 0; i < n; ++i)
+    {
+        vMpiRequests[i]->m_request = vRequests[i];
+    }
+}
+
+/**
+ *
+ */
+bool CommMpi::v_Test(CommRequestSharedPtr pRequest)
+{
+    CommRequestMpiSharedPtr req =
+        boost::dynamic_pointer_cast<CommRequestMpi>(pRequest);
+    ASSERTL0(req, "Request was not created by an MPI communicator.");
+
+    int flag;
+    int retval = MPI_Test(&req->m_request, &flag, MPI_STATUS_IGNORE);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error testing request.");
+
+    return flag != 0;
+}
+
 /**
  *
  */
@@ -266,6 +417,35 @@ void CommMpi::v_AlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-to-All-v.");
 }
 
+/**
+ * As for v_IAllReduce, a blocking exchange is performed if MPI-3 is not
+ * available.
+ */
+CommRequestSharedPtr CommMpi::v_IAlltoAllv(void *sendbuf, int sendcounts[],
+                                           int sdispls[],
+                                           CommDataType sendtype,
+                                           void *recvbuf, int recvcounts[],
+                                           int rdispls[],
+                                           CommDataType recvtype)
+{
+    CommRequestMpiSharedPtr req =
+        MemoryManager<CommRequestMpi>::AllocateSharedPtr();
+
+#if MPI_VERSION >= 3
+    int retval = MPI_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf,
+                                recvcounts, rdispls, recvtype, m_comm,
+                                &req->m_request);
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking All-to-All-v.");
+#else
+    v_AlltoAllv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts,
+                rdispls, recvtype);
+#endif
+
+    return req;
+}
+
 void CommMpi::v_Bcast(void *buffer, int count, CommDataType dt, int root)
 {
     int retval = MPI_Bcast(buffer, count, dt, root, m_comm);
@@ -309,6 +489,16 @@ void CommMpi::v_Gather(void *sendbuf, int sendcount, CommDataType sendtype,
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing Gather.");
 }
 
+void CommMpi::v_Gatherv(void *sendbuf, int sendcount, CommDataType sendtype,
+                        void *recvbuf, int recvcounts[], int rdispls[],
+                        CommDataType recvtype, int root)
+{
+    int retval = MPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf,
+                             recvcounts, rdispls, recvtype, root, m_comm);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing Gatherv.");
+}
+
 void CommMpi::v_Scatter(void *sendbuf, int sendcount, CommDataType sendtype,
                         void *recvbuf, int recvcount, CommDataType recvtype,
                         int root)
@@ -57,6 +57,24 @@ class CommMpi;
 /// Pointer to a Communicator object.
 typedef boost::shared_ptr<CommMpi> CommMpiSharedPtr;
 
+/// Request for a non-blocking MPI communication.
+class CommRequestMpi : public CommRequest
+{
+public:
+    CommRequestMpi() : m_request(MPI_REQUEST_NULL)
+    {
+    }
+
+    virtual ~CommRequestMpi()
+    {
+    }
+
+    MPI_Request m_request;
+};
+
+/// Pointer to a CommRequestMpi object.
+typedef boost::shared_ptr<CommRequestMpi> CommRequestMpiSharedPtr;
+
 /// A global linear system.
 class CommMpi : public Comm
 {
@@ -88,8 +106,18 @@ protected:
                             CommDataType recvtype, int source);
     virtual void v_SendRecvReplace(void *buf, int count, CommDataType dt,
                                    int pSendProc, int pRecvProc);
+    virtual CommRequestSharedPtr v_Isend(void *buf, int count, CommDataType dt,
+                                         int dest);
+    virtual CommRequestSharedPtr v_Irecv(void *buf, int count, CommDataType dt,
+                                         int source);
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp);
+    virtual CommRequestSharedPtr v_IAllReduce(void *buf, int count,
+                                              CommDataType dt,
+                                              enum ReduceOperator pOp);
+    virtual void v_Wait(CommRequestSharedPtr pRequest);
+    virtual void v_WaitAll(CommRequestVector &pRequests);
+    virtual bool v_Test(CommRequestSharedPtr pRequest);
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount,
                             CommDataType recvtype);
@@ -97,6 +125,10 @@ protected:
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype);
+    virtual CommRequestSharedPtr v_IAlltoAllv(
+        void *sendbuf, int sendcounts[], int sensdispls[],
+        CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
+        CommDataType recvtype);
     virtual void v_Bcast(void *buffer, int count, CommDataType dt, int root);
     virtual void v_Exscan(Array<OneD, unsigned long long> &pData,
                           const enum ReduceOperator pOp,
@@ -105,6 +137,9 @@ protected:
     virtual void v_Gather(void *sendbuf, int sendcount, CommDataType sendtype,
                           void *recvbuf, int recvcount, CommDataType recvtype,
                           int root);
+    virtual void v_Gatherv(void *sendbuf, int sendcount, CommDataType sendtype,
+                           void *recvbuf, int recvcounts[], int rdispls[],
+                           CommDataType recvtype, int root);
     virtual void v_Scatter(void *sendbuf, int sendcount, CommDataType sendtype,
                            void *recvbuf, int recvcount, CommDataType recvtype,
                            int root);
@@ -117,6 +152,8 @@ private:
     int m_rank;
 
     CommMpi(MPI_Comm pComm);
+
+    void SetThreadSafe();
 };
 }
 }
@@ -131,6 +131,25 @@ void CommSerial::v_SendRecvReplace(void *buf, int count, CommDataType dt,
 {
 }
 
+/**
+ * As for v_Send, there is no other process to communicate with and the
+ * returned request is already complete.
+ */
+CommRequestSharedPtr CommSerial::v_Isend(void *buf, int count, CommDataType dt,
+                                         int dest)
+{
+    return MemoryManager<CommRequest>::AllocateSharedPtr();
+}
+
+/**
+ *
+ */
+CommRequestSharedPtr CommSerial::v_Irecv(void *buf, int count, CommDataType dt,
+                                         int source)
+{
+    return MemoryManager<CommRequest>::AllocateSharedPtr();
+}
+
 /**
  *
  */
@@ -139,6 +158,39 @@ void CommSerial::v_AllReduce(void *buf, int count, CommDataType dt,
 {
 }
 
+/**
+ * The reduction over a single process is the identity, so the request is
+ * already complete.
+ */
+CommRequestSharedPtr CommSerial::v_IAllReduce(void *buf, int count,
+                                              CommDataType dt,
+                                              enum ReduceOperator pOp)
+{
+    return MemoryManager<CommRequest>::AllocateSharedPtr();
+}
+
+/**
+ *
+ */
+void CommSerial::v_Wait(CommRequestSharedPtr pRequest)
+{
+}
+
+/**
+ *
+ */
+void CommSerial::v_WaitAll(CommRequestVector &pRequests)
+{
+}
+
+/**
+ *
+ */
+bool CommSerial::v_Test(CommRequestSharedPtr pRequest)
+{
+    return true;
+}
+
 /**
  *
  */
@@ -157,6 +209,19 @@ void CommSerial::v_AlltoAllv(void *sendbuf, int sendcounts[], int sensdispls[],
 {
 }
 
+/**
+ *
+ */
+CommRequestSharedPtr CommSerial::v_IAlltoAllv(void *sendbuf, int sendcounts[],
+                                              int sensdispls[],
+                                              CommDataType sendtype,
+                                              void *recvbuf, int recvcounts[],
+                                              int rdispls[],
+                                              CommDataType recvtype)
+{
+    return MemoryManager<CommRequest>::AllocateSharedPtr();
+}
+
 void CommSerial::v_Bcast(void *buffer, int count, CommDataType dt, int root)
 {
 }
@@ -174,6 +239,14 @@ void CommSerial::v_Gather(void *sendbuf, int sendcount, CommDataType sendtype,
     std::memcpy(recvbuf, sendbuf, sendcount * CommDataTypeGetSize(sendtype));
 }
 
+void CommSerial::v_Gatherv(void *sendbuf, int sendcount, CommDataType sendtype,
+                           void *recvbuf, int recvcounts[], int rdispls[],
+                           CommDataType recvtype, int root)
+{
+    std::memcpy((char *)recvbuf + rdispls[0] * CommDataTypeGetSize(recvtype),
+                sendbuf, sendcount * CommDataTypeGetSize(sendtype));
+}
+
 void CommSerial::v_Scatter(void *sendbuf, int sendcount, CommDataType sendtype,
                            void *recvbuf, int recvcount, CommDataType recvtype,
                            int root)
@@ -85,9 +85,22 @@ protected:
                                                         CommDataType dt,
                                                         int pSendProc,
                                                         int pRecvProc);
+    LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_Isend(void *buf,
+                                                              int count,
+                                                              CommDataType dt,
+                                                              int dest);
+    LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_Irecv(void *buf,
+                                                              int count,
+                                                              CommDataType dt,
+                                                              int source);
     LIB_UTILITIES_EXPORT virtual void v_AllReduce(void *buf, int count,
                                                   CommDataType dt,
                                                   enum ReduceOperator pOp);
+    LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_IAllReduce(
+        void *buf, int count, CommDataType dt, enum ReduceOperator pOp);
+    LIB_UTILITIES_EXPORT virtual void v_Wait(CommRequestSharedPtr pRequest);
+    LIB_UTILITIES_EXPORT virtual void v_WaitAll(CommRequestVector &pRequests);
+    LIB_UTILITIES_EXPORT virtual bool v_Test(CommRequestSharedPtr pRequest);
     LIB_UTILITIES_EXPORT virtual void v_AlltoAll(void *sendbuf, int sendcount,
                                                  CommDataType sendtype,
                                                  void *recvbuf, int recvcount,
@@ -96,6 +109,10 @@ protected:
         void *sendbuf, int sendcounts[], int sensdispls[],
         CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
         CommDataType recvtype);
+    LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_IAlltoAllv(
+        void *sendbuf, int sendcounts[], int sensdispls[],
+        CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
+        CommDataType recvtype);
     LIB_UTILITIES_EXPORT virtual void v_Bcast(void *buffer, int count,
                                               CommDataType dt, int root);
     LIB_UTILITIES_EXPORT virtual void v_Exscan(
@@ -105,6 +122,13 @@ protected:
                                                CommDataType sendtype,
                                                void *recvbuf, int recvcount,
                                                CommDataType recvtype, int root);
+    LIB_UTILITIES_EXPORT virtual void v_Gatherv(void *sendbuf, int sendcount,
+                                                CommDataType sendtype,
+                                                void *recvbuf,
+                                                int recvcounts[],
+                                                int rdispls[],
+                                                CommDataType recvtype,
+                                                int root);
     LIB_UTILITIES_EXPORT virtual void v_Scatter(void *sendbuf, int sendcount,
                                                 CommDataType sendtype,
                                                 void *recvbuf, int recvcount,
@@ -40,6 +40,7 @@
 #include <LibUtilities/BasicUtils/Vmath.hpp>       // for Vcopy
 #include <LibUtilities/Foundations/Basis.h>        // for BasisKey
 #include <LibUtilities/Foundations/Foundations.hpp>
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
 
 namespace Nektar
 {
@@ -54,6 +55,9 @@ Transposition::Transposition(const LibUtilities::BasisKey &HomoBasis0,
 {
     m_hcomm                      = hcomm1;
     m_num_homogeneous_directions = 1;
+    m_numPipelined               = 0;
+    m_overlapTime                = 0.0;
+    m_waitTime                   = 0.0;
 
     m_num_points_per_proc    = Array<OneD, int>(m_num_homogeneous_directions);
     m_num_homogeneous_points = Array<OneD, int>(m_num_homogeneous_directions);
@@ -118,6 +122,9 @@ Transposition::Transposition(const LibUtilities::BasisKey &HomoBasis0,
 {
     m_hcomm                      = hcomm;
     m_num_homogeneous_directions = 2;
+    m_numPipelined               = 0;
+    m_overlapTime                = 0.0;
+    m_waitTime                   = 0.0;
 
     m_num_points_per_proc    = Array<OneD, int>(m_num_homogeneous_directions);
     m_num_homogeneous_points = Array<OneD, int>(m_num_homogeneous_directions);
@@ -150,6 +157,9 @@ Transposition::Transposition(const LibUtilities::BasisKey &HomoBasis0,
 {
     m_hcomm                      = hcomm;
     m_num_homogeneous_directions = 3;
+    m_numPipelined               = 0;
+    m_overlapTime                = 0.0;
+    m_waitTime                   = 0.0;
 
     m_num_points_per_proc    = Array<OneD, int>(m_num_homogeneous_directions);
     m_num_homogeneous_points = Array<OneD, int>(m_num_homogeneous_directions);
@@ -259,48 +269,110 @@ void Transposition::Transpose(const Array<OneD, const NekDouble> &inarray,
 }
 
 /**
- * Homogeneous 1D transposition from SEM to Homogeneous ordering.
+ * Start a transposition, which is completed by a call to EndTranspose. The
+ * data exchange of a parallel Homogeneous 1D transposition proceeds while
+ * other work is performed between the two calls, so that the communication of
+ * one field may be overlapped with computation on another. @p outarray must
+ * not be accessed until EndTranspose has been called; @p inarray may be
+ * reused as soon as this method returns.
+ *
+ * Transpositions which do not require communication, which includes all
+ * Homogeneous 2D transpositions, are performed immediately and EndTranspose
+ * then has no effect.
  */
-void Transposition::TransposeXYtoZ(const Array<OneD, const NekDouble> &inarray,
-                                   Array<OneD, NekDouble> &outarray,
-                                   bool UseNumMode)
+TranspositionRequestSharedPtr Transposition::BeginTranspose(
+    const Array<OneD, const NekDouble> &inarray,
+    Array<OneD, NekDouble> &outarray, bool UseNumMode, TranspositionDir dir)
 {
-    if (m_num_processes[0] > 1)
+    TranspositionRequestSharedPtr request;
+
+    if (m_num_homogeneous_directions == 1 && m_num_processes[0] > 1 &&
+        (dir == eXYtoZ || dir == eZtoXY))
     {
-        // Paramerers set up
-        int i, packed_len;
-        int copy_len = 0;
-        int index    = 0;
-        int cnt      = 0;
-
-        int num_dofs             = inarray.num_elements();
-        int num_points_per_plane = num_dofs / m_num_points_per_proc[0];
-        int num_pencil_per_proc =
-            (num_points_per_plane / m_num_processes[0]) +
-            (num_points_per_plane % m_num_processes[0] > 0);
-
-        m_SizeMap   = Array<OneD, int>(m_num_processes[0], 0);
-        m_OffsetMap = Array<OneD, int>(m_num_processes[0], 0);
-
-        for (i = 0; i < m_num_processes[0]; i++)
-        {
-            m_SizeMap[i]   = num_pencil_per_proc * m_num_points_per_proc[0];
-            m_OffsetMap[i] = i * num_pencil_per_proc * m_num_points_per_proc[0];
-        }
+        request = StartExchange(inarray, outarray, UseNumMode, dir);
+        request->m_startTime = m_hcomm->Wtime();
+    }
+    else
+    {
+        Transpose(inarray, outarray, UseNumMode, dir);
 
-        Array<OneD, NekDouble> tmp_outarray(
-            num_pencil_per_proc * m_num_homogeneous_points[0], 0.0);
+        request = MemoryManager<TranspositionRequest>::AllocateSharedPtr();
+        request->m_dir        = dir;
+        request->m_useNumMode = UseNumMode;
+        request->m_outarray   = outarray;
+        request->m_startTime  = 0.0;
+    }
 
-        if (UseNumMode)
-        {
-            packed_len = m_num_homogeneous_coeffs[0];
-        }
-        else
-        {
-            packed_len = m_num_homogeneous_points[0];
-        }
+    return request;
+}
+
+/**
+ * Complete a transposition started by BeginTranspose, and record the time
+ * for which its communication was overlapped and the time spent waiting for
+ * it to complete.
+ */
+void Transposition::EndTranspose(TranspositionRequestSharedPtr &request)
+{
+    ASSERTL1(request, "Transposition request is not valid.");
+
+    if (!request->m_request)
+    {
+        return;
+    }
+
+    NekDouble start = m_hcomm->Wtime();
+    m_hcomm->Wait(request->m_request);
+    NekDouble end   = m_hcomm->Wtime();
+
+    UnpackExchange(request);
+
+    m_numPipelined++;
+    m_overlapTime += start - request->m_startTime;
+    m_waitTime    += end - start;
+}
 
-        // Start Transposition
+/**
+ * Pack @p inarray into the send buffer of a new request and start the
+ * exchange of a parallel Homogeneous 1D transposition.
+ */
+TranspositionRequestSharedPtr Transposition::StartExchange(
+    const Array<OneD, const NekDouble> &inarray,
+    Array<OneD, NekDouble> &outarray, bool UseNumMode, TranspositionDir dir)
+{
+    int i, copy_len;
+    int index = 0;
+    int cnt   = 0;
+
+    int num_dofs             = dir == eXYtoZ ? inarray.num_elements()
+                                             : outarray.num_elements();
+    int num_points_per_plane = num_dofs / m_num_points_per_proc[0];
+    int num_pencil_per_proc =
+        (num_points_per_plane / m_num_processes[0]) +
+        (num_points_per_plane % m_num_processes[0] > 0);
+    int buf_len = num_pencil_per_proc * m_num_homogeneous_points[0];
+
+    TranspositionRequestSharedPtr request =
+        MemoryManager<TranspositionRequest>::AllocateSharedPtr();
+
+    request->m_dir        = dir;
+    request->m_useNumMode = UseNumMode;
+    request->m_outarray   = outarray;
+    request->m_sendBuf    = Array<OneD, NekDouble>(buf_len, 0.0);
+    request->m_recvBuf    = Array<OneD, NekDouble>(buf_len, 0.0);
+    request->m_sizeMap    = Array<OneD, int>(m_num_processes[0], 0);
+    request->m_offsetMap  = Array<OneD, int>(m_num_processes[0], 0);
+    request->m_startTime  = 0.0;
+
+    for (i = 0; i < m_num_processes[0]; i++)
+    {
+        request->m_sizeMap[i] =
+            num_pencil_per_proc * m_num_points_per_proc[0];
+        request->m_offsetMap[i] =
+            i * num_pencil_per_proc * m_num_points_per_proc[0];
+    }
+
+    if (dir == eXYtoZ)
+    {
         while (index < num_points_per_plane)
         {
             copy_len = num_pencil_per_proc < (num_points_per_plane - index)
@@ -311,24 +383,100 @@ void Transposition::TransposeXYtoZ(const Array<OneD, const NekDouble> &inarray,
             {
                 Vmath::Vcopy(copy_len,
                              &(inarray[index + (i * num_points_per_plane)]), 1,
-                             &(outarray[cnt]), 1);
+                             &(request->m_sendBuf[cnt]), 1);
 
                 cnt += num_pencil_per_proc;
             }
 
             index += copy_len;
         }
+    }
+    else
+    {
+        int packed_len = UseNumMode ? m_num_homogeneous_coeffs[0]
+                                    : m_num_homogeneous_points[0];
+
+        for (i = 0; i < packed_len; ++i)
+        {
+            Vmath::Vcopy(num_pencil_per_proc, &(inarray[i]), packed_len,
+                         &(request->m_sendBuf[i * num_pencil_per_proc]), 1);
+        }
+    }
 
-        m_hcomm->AlltoAllv(outarray, m_SizeMap, m_OffsetMap, tmp_outarray,
-                           m_SizeMap, m_OffsetMap);
+    request->m_request = m_hcomm->IAlltoAllv(
+        request->m_sendBuf, request->m_sizeMap, request->m_offsetMap,
+        request->m_recvBuf, request->m_sizeMap, request->m_offsetMap);
+
+    return request;
+}
+
+/**
+ * Unpack the receive buffer of a completed exchange into the output array
+ * of the request.
+ */
+void Transposition::UnpackExchange(TranspositionRequestSharedPtr &request)
+{
+    int i, copy_len;
+    int index = 0;
+    int cnt   = 0;
+
+    Array<OneD, NekDouble> &outarray = request->m_outarray;
+    Array<OneD, NekDouble> &recvBuf  = request->m_recvBuf;
+
+    int num_pencil_per_proc = request->m_sizeMap[0] / m_num_points_per_proc[0];
+
+    if (request->m_dir == eXYtoZ)
+    {
+        int packed_len = request->m_useNumMode ? m_num_homogeneous_coeffs[0]
+                                               : m_num_homogeneous_points[0];
 
         for (i = 0; i < packed_len; ++i)
         {
             Vmath::Vcopy(num_pencil_per_proc,
-                         &(tmp_outarray[i * num_pencil_per_proc]), 1,
+                         &(recvBuf[i * num_pencil_per_proc]), 1,
                          &(outarray[i]), packed_len);
         }
-        // End Transposition
+    }
+    else
+    {
+        int num_points_per_plane =
+            outarray.num_elements() / m_num_points_per_proc[0];
+
+        while (index < num_points_per_plane)
+        {
+            copy_len = num_pencil_per_proc < (num_points_per_plane - index)
+                           ? num_pencil_per_proc
+                           : (num_points_per_plane - index);
+
+            for (i = 0; i < m_num_points_per_proc[0]; i++)
+            {
+                Vmath::Vcopy(copy_len, &(recvBuf[cnt]), 1,
+                             &(outarray[index + (i * num_points_per_plane)]),
+                             1);
+
+                cnt += num_pencil_per_proc;
+            }
+
+            index += copy_len;
+        }
+    }
+
+    request->m_request.reset();
+}
+
+/**
+ * Homogeneous 1D transposition from SEM to Homogeneous ordering.
+ */
+void Transposition::TransposeXYtoZ(const Array<OneD, const NekDouble> &inarray,
+                                   Array<OneD, NekDouble> &outarray,
+                                   bool UseNumMode)
+{
+    if (m_num_processes[0] > 1)
+    {
+        TranspositionRequestSharedPtr request =
+            StartExchange(inarray, outarray, UseNumMode, eXYtoZ);
+        m_hcomm->Wait(request->m_request);
+        UnpackExchange(request);
     }
 
     // Serial case implementation (more efficient then MPI 1 processor
@@ -370,69 +518,10 @@ void Transposition::TransposeZtoXY(const Array<OneD, const NekDouble> &inarray,
 {
     if (m_num_processes[0] > 1)
     {
-        // Paramerers set up
-        int i, packed_len;
-        int copy_len = 0;
-        int index    = 0;
-        int cnt      = 0;
-
-        int num_dofs             = outarray.num_elements();
-        int num_points_per_plane = num_dofs / m_num_points_per_proc[0];
-        int num_pencil_per_proc =
-            (num_points_per_plane / m_num_processes[0]) +
-            (num_points_per_plane % m_num_processes[0] > 0);
-
-        m_SizeMap   = Array<OneD, int>(m_num_processes[0], 0);
-        m_OffsetMap = Array<OneD, int>(m_num_processes[0], 0);
-
-        for (i = 0; i < m_num_processes[0]; i++)
-        {
-            m_SizeMap[i]   = num_pencil_per_proc * m_num_points_per_proc[0];
-            m_OffsetMap[i] = i * num_pencil_per_proc * m_num_points_per_proc[0];
-        }
-
-        Array<OneD, NekDouble> tmp_inarray(
-            num_pencil_per_proc * m_num_homogeneous_points[0], 0.0);
-        Array<OneD, NekDouble> tmp_outarray(
-            num_pencil_per_proc * m_num_homogeneous_points[0], 0.0);
-
-        if (UseNumMode)
-        {
-            packed_len = m_num_homogeneous_coeffs[0];
-        }
-        else
-        {
-            packed_len = m_num_homogeneous_points[0];
-        }
-
-        // Start Transposition
-        for (i = 0; i < packed_len; ++i)
-        {
-            Vmath::Vcopy(num_pencil_per_proc, &(inarray[i]), packed_len,
-                         &(tmp_inarray[i * num_pencil_per_proc]), 1);
-        }
-
-        m_hcomm->AlltoAllv(tmp_inarray, m_SizeMap, m_OffsetMap, tmp_outarray,
-                           m_SizeMap, m_OffsetMap);
-
-        while (index < num_points_per_plane)
-        {
-            copy_len = num_pencil_per_proc < (num_points_per_plane - index)
-                           ? num_pencil_per_proc
-                           : (num_points_per_plane - index);
-
-            for (i = 0; i < m_num_points_per_proc[0]; i++)
-            {
-                Vmath::Vcopy(copy_len, &(tmp_outarray[cnt]), 1,
-                             &(outarray[index + (i * num_points_per_plane)]),
-                             1);
-
-                cnt += num_pencil_per_proc;
-            }
-
-            index += copy_len;
-        }
-        // End Transposition
+        TranspositionRequestSharedPtr request =
+            StartExchange(inarray, outarray, UseNumMode, eZtoXY);
+        m_hcomm->Wait(request->m_request);
+        UnpackExchange(request);
     }
 
     // Serial case implementation (more efficient then MPI 1 processor
@@ -66,6 +66,30 @@ enum TranspositionDir
     eNoTrans
 };
 
+/**
+ * @brief State of a transposition started by Transposition::BeginTranspose.
+ *
+ * The send and receive buffers and the size and offset maps are owned by the
+ * request, since they must persist until the exchange has completed.
+ */
+struct TranspositionRequest
+{
+    TranspositionDir       m_dir;
+    bool                   m_useNumMode;
+    /// Array which receives the transposed data.
+    Array<OneD, NekDouble> m_outarray;
+    Array<OneD, NekDouble> m_sendBuf;
+    Array<OneD, NekDouble> m_recvBuf;
+    Array<OneD, int>       m_sizeMap;
+    Array<OneD, int>       m_offsetMap;
+    /// Outstanding exchange, or empty if the transposition has completed.
+    CommRequestSharedPtr   m_request;
+    /// Time at which the exchange was started.
+    NekDouble              m_startTime;
+};
+
+typedef boost::shared_ptr<TranspositionRequest> TranspositionRequestSharedPtr;
+
 class Transposition
 {
 public:
@@ -99,6 +123,34 @@ public:
         Array<OneD, NekDouble> &outarray, bool UseNumMode = false,
         TranspositionDir dir = eNoTrans);
 
+    LIB_UTILITIES_EXPORT TranspositionRequestSharedPtr BeginTranspose(
+        const Array<OneD, const NekDouble> &inarray,
+        Array<OneD, NekDouble> &outarray, bool UseNumMode = false,
+        TranspositionDir dir = eNoTrans);
+
+    LIB_UTILITIES_EXPORT void EndTranspose(
+        TranspositionRequestSharedPtr &request);
+
+    /// Number of transpositions completed through EndTranspose which
+    /// required communication.
+    LIB_UTILITIES_EXPORT int GetNumPipelined()
+    {
+        return m_numPipelined;
+    }
+
+    /// Time between starting and completing the pipelined transpositions,
+    /// during which other work was performed.
+    LIB_UTILITIES_EXPORT NekDouble GetOverlapTime()
+    {
+        return m_overlapTime;
+    }
+
+    /// Time spent waiting for pipelined transpositions to complete.
+    LIB_UTILITIES_EXPORT NekDouble GetWaitTime()
+    {
+        return m_waitTime;
+    }
+
     LIB_UTILITIES_EXPORT void SetSpecVanVisc(Array<OneD, NekDouble> visc);
 
     LIB_UTILITIES_EXPORT NekDouble GetSpecVanVisc(const int k);
@@ -131,6 +183,13 @@ private:
         const Array<OneD, const NekDouble> &inarray,
         Array<OneD, NekDouble> &outarray, bool UseNumMode = false);
 
+    TranspositionRequestSharedPtr StartExchange(
+        const Array<OneD, const NekDouble> &inarray,
+        Array<OneD, NekDouble> &outarray, bool UseNumMode,
+        TranspositionDir dir);
+
+    void UnpackExchange(TranspositionRequestSharedPtr &request);
+
     int m_num_homogeneous_directions;
 
     /// Number of homogeneous points on each processor per direction.
@@ -156,11 +215,15 @@ private:
     /// Fourier wave numbers associated with the planes.
     Array<OneD, unsigned int> m_K;
 
-    /// MPI_Alltoallv map containing size of send/recv buffer.
-    Array<OneD, int> m_SizeMap;
+    /// Number of pipelined transpositions which required communication.
+    int m_numPipelined;
+
+    /// Accumulated time between starting and completing pipelined
+    /// transpositions.
+    NekDouble m_overlapTime;
 
-    /// MPI_Alltoallv offset map of send/recv buffer in global vector.
-    Array<OneD, int> m_OffsetMap;
+    /// Accumulated time spent waiting for pipelined transpositions.
+    NekDouble m_waitTime;
 };
 
 typedef boost::shared_ptr<Transposition> TranspositionSharedPtr;
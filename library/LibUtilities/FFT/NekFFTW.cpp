@@ -71,12 +71,30 @@ namespace Nektar
                 m_FFTW_w[i]     = m_FFTW_w[0]*2;
                 m_FFTW_w_inv[i] = m_FFTW_w_inv[0]/2;
             }
+
+            // Entry i of a line in Nektar++ format is stored in entry
+            // m_perm[i] of the FFTW halfcomplex format, as in
+            // Reshuffle_FFTW2Nek and Reshuffle_Nek2FFTW.
+            int halfN = m_N/2;
+            m_perm = Array<OneD,int>(m_N);
+            m_perm[0] = 0;
+            m_perm[1] = halfN;
+            for(int i = 1; i < halfN; i++)
+            {
+                m_perm[2*i]   = i;
+                m_perm[2*i+1] = m_N - i;
+            }
         }
 
         // Distructor
         NekFFTW::~NekFFTW()
         {
-
+            std::map<ManyPlanKey, ManyPlan>::iterator it;
+            for (it = m_manyPlans.begin(); it != m_manyPlans.end(); ++it)
+            {
+                fftw_destroy_plan(it->second.first);
+                fftw_destroy_plan(it->second.second);
+            }
         }
 
         // Forward transformation
@@ -146,5 +164,105 @@ namespace Nektar
 
             return;
         }
+
+        /**
+         * Return the forward and backward plans for @p howmany lines with the
+         * given layout, creating them using fftw_plan_many_r2r if they do not
+         * exist. The plans are executed on arbitrary arrays via
+         * fftw_execute_r2r, and so are created with FFTW_UNALIGNED.
+         */
+        NekFFTW::ManyPlan &NekFFTW::GetManyPlan(
+            const int howmany, const int stride, const int dist)
+        {
+            ManyPlanKey key(howmany, std::make_pair(stride, dist));
+
+            std::map<ManyPlanKey, ManyPlan>::iterator it =
+                m_manyPlans.find(key);
+
+            if (it != m_manyPlans.end())
+            {
+                return it->second;
+            }
+
+            int size = (howmany-1)*dist + (m_N-1)*stride + 1;
+
+            if (m_manyWsp.num_elements() < size)
+            {
+                m_manyWsp = Array<OneD, NekDouble>(size);
+            }
+
+            Array<OneD, NekDouble> tmp(size);
+            int n = m_N;
+            fftw_r2r_kind fwdKind = FFTW_R2HC;
+            fftw_r2r_kind bwdKind = FFTW_HC2R;
+
+            ManyPlan plan;
+            plan.first  = fftw_plan_many_r2r(
+                1, &n, howmany,
+                &tmp[0],       NULL, stride, dist,
+                &m_manyWsp[0], NULL, stride, dist,
+                &fwdKind, FFTW_ESTIMATE | FFTW_UNALIGNED | FFTW_PRESERVE_INPUT);
+            plan.second = fftw_plan_many_r2r(
+                1, &n, howmany,
+                &m_manyWsp[0], NULL, stride, dist,
+                &tmp[0],       NULL, stride, dist,
+                &bwdKind, FFTW_ESTIMATE | FFTW_UNALIGNED);
+
+            ASSERTL0(plan.first && plan.second,
+                     "Failed to create FFTW plan for several lines.");
+
+            return m_manyPlans[key] = plan;
+        }
+
+        // Forward transformation of several lines
+        void NekFFTW::v_FFTFwdTransMany(
+            const int howmany, const int stride, const int dist,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            ManyPlan &plan = GetManyPlan(howmany, stride, dist);
+
+            fftw_execute_r2r(plan.first,
+                             const_cast<NekDouble *>(&inarray[0]),
+                             &m_manyWsp[0]);
+
+            // Reorder into Nektar++ format and scale, one line entry at a
+            // time for all lines.
+            for (int j = 0; j < m_N; ++j)
+            {
+                const NekDouble  w   = m_FFTW_w[j];
+                const NekDouble *src = &m_manyWsp[m_perm[j]*stride];
+                      NekDouble *dst = &outarray[j*stride];
+
+                for (int i = 0; i < howmany; ++i)
+                {
+                    dst[i*dist] = w * src[i*dist];
+                }
+            }
+        }
+
+        // Backward transformation of several lines
+        void NekFFTW::v_FFTBwdTransMany(
+            const int howmany, const int stride, const int dist,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            ManyPlan &plan = GetManyPlan(howmany, stride, dist);
+
+            // Reorder into FFTW format and scale.
+            for (int j = 0; j < m_N; ++j)
+            {
+                const NekDouble  w   = m_FFTW_w_inv[j] / m_N;
+                const NekDouble *src = &inarray[j*stride];
+                      NekDouble *dst = &m_manyWsp[m_perm[j]*stride];
+
+                for (int i = 0; i < howmany; ++i)
+                {
+                    dst[i*dist] = w * src[i*dist];
+                }
+            }
+
+            fftw_execute_r2r(plan.second, &m_manyWsp[0], &outarray[0]);
+        }
     }
 }
@@ -46,6 +46,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -83,9 +85,21 @@ namespace Nektar
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
+			virtual void v_FFTFwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &inarray,
+				      Array<OneD,       NekDouble> &outarray);
 			
+			virtual void v_FFTBwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &inarray,
+				      Array<OneD,       NekDouble> &outarray);
 			
 		protected:
+			/// Key of a plan for several lines: (howmany, (stride, dist)).
+			typedef std::pair<int, std::pair<int, int> > ManyPlanKey;
+			/// Forward and backward plans for several lines.
+			typedef std::pair<fftw_plan, fftw_plan>       ManyPlan;
 			
 			Array<OneD,NekDouble> m_FFTW_w;  // weights to convert arrays form Nektar++ to FFTW format
 			Array<OneD,NekDouble> m_FFTW_w_inv; // weights to convert arrays from FFTW to Nektar++ format
@@ -97,6 +111,13 @@ namespace Nektar
 
 			fftw_plan plan_backward;         // plan to execute a backward FFT in FFTW
 			fftw_plan plan_forward;          // plan to execute a forward FFT in FFTW
+
+			std::map<ManyPlanKey, ManyPlan> m_manyPlans; // plans for several lines
+			Array<OneD,int>       m_perm;    // position of Nektar++ coefficients in FFTW format
+			Array<OneD,NekDouble> m_manyWsp; // workspace for transforms of several lines
+			
+			ManyPlan &GetManyPlan(const int howmany, const int stride, const int dist);
+			
 			/**
 			 * Reshuffling routines to put the coefficients in Nektar++/FFTW format.
 			 * The routines take as an input the number of points N, the vector of coeffcients
@@ -34,6 +34,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
 #include <loki/Singleton.h>             // for CreateUsingNew, NoDestroy, etc
 
 namespace Nektar
@@ -92,6 +94,22 @@ namespace Nektar
 			v_FFTBwdTrans(coef,phys);
 		}
 		
+		void NektarFFT::FFTFwdTransMany(
+			const int howmany, const int stride, const int dist,
+			const Array<OneD, const NekDouble> &phys,
+			      Array<OneD,       NekDouble> &coef)
+		{
+			v_FFTFwdTransMany(howmany, stride, dist, phys, coef);
+		}
+		
+		void NektarFFT::FFTBwdTransMany(
+			const int howmany, const int stride, const int dist,
+			const Array<OneD, const NekDouble> &coef,
+			      Array<OneD,       NekDouble> &phys)
+		{
+			v_FFTBwdTransMany(howmany, stride, dist, coef, phys);
+		}
+		
 		void NektarFFT::v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
 		{
 			
@@ -102,5 +120,43 @@ namespace Nektar
 			
 		}
 		
+		/**
+		 * Default implementation which copies each line into contiguous
+		 * storage and calls #v_FFTFwdTrans.
+		 */
+		void NektarFFT::v_FFTFwdTransMany(
+			const int howmany, const int stride, const int dist,
+			const Array<OneD, const NekDouble> &phys,
+			      Array<OneD,       NekDouble> &coef)
+		{
+			Array<OneD, NekDouble> in(m_N), out(m_N);
+			
+			for (int i = 0; i < howmany; ++i)
+			{
+				Vmath::Vcopy(m_N, &phys[i*dist], stride, &in[0], 1);
+				v_FFTFwdTrans(in, out);
+				Vmath::Vcopy(m_N, &out[0], 1, &coef[i*dist], stride);
+			}
+		}
+		
+		/**
+		 * Default implementation which copies each line into contiguous
+		 * storage and calls #v_FFTBwdTrans.
+		 */
+		void NektarFFT::v_FFTBwdTransMany(
+			const int howmany, const int stride, const int dist,
+			const Array<OneD, const NekDouble> &coef,
+			      Array<OneD,       NekDouble> &phys)
+		{
+			Array<OneD, NekDouble> in(m_N), out(m_N);
+			
+			for (int i = 0; i < howmany; ++i)
+			{
+				Vmath::Vcopy(m_N, &coef[i*dist], stride, &in[0], 1);
+				v_FFTBwdTrans(in, out);
+				Vmath::Vcopy(m_N, &out[0], 1, &phys[i*dist], stride);
+			}
+		}
+		
 	}//end namespace LibUtilities
 }//end of namespace Nektar
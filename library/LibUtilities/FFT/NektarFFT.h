@@ -103,6 +103,30 @@ namespace Nektar
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			/**
+			 * Forward transformation of several lines of length m_N at once.
+			 * input:
+			 * howmany   = number of lines
+			 * stride    = distance between consecutive entries of a line
+			 * dist      = distance between the first entries of consecutive lines
+			 * phys      = lines in physical space
+			 * output:
+			 * coef      = lines in coefficient space, with the same layout as phys
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &phys,
+				      Array<OneD,       NekDouble> &coef);
+			
+			/**
+			 * Backward transformation of several lines of length m_N at once,
+			 * with the same layout arguments as FFTFwdTransMany.
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &coef,
+				      Array<OneD,       NekDouble> &phys);
+			
 		protected:
 			
 			
@@ -110,6 +134,16 @@ namespace Nektar
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			virtual void v_FFTFwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &phys,
+				      Array<OneD,       NekDouble> &coef);
+			
+			virtual void v_FFTBwdTransMany(
+				const int howmany, const int stride, const int dist,
+				const Array<OneD, const NekDouble> &coef,
+				      Array<OneD,       NekDouble> &phys);
+			
 		private:
 			
 		};
@@ -275,6 +275,11 @@ namespace Nektar
                 m_points->GetZW(z,w);
             }
 
+            inline const Array<OneD, const NekDouble>& GetBaryWeights() const
+            {
+                return m_points->GetBaryWeights();
+            }
+
             inline const  boost::shared_ptr<NekMatrix<NekDouble> > & GetD(
                               Direction dir = xDir) const
             {
@@ -36,6 +36,9 @@
 #ifndef NEKTAR_LIB_UTILITIES_FOUNDATIONS_POINTS_H
 #define NEKTAR_LIB_UTILITIES_FOUNDATIONS_POINTS_H
 
+#include <algorithm>
+#include <cmath>
+
 #include <LibUtilities/Foundations/FoundationsFwd.hpp>
 #include <LibUtilities/Foundations/Foundations.hpp>
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
@@ -257,6 +260,7 @@ namespace Nektar
             {
                 CalculatePoints();
                 CalculateWeights();
+                CalculateBaryWeights();
                 CalculateDerivMatrix();
             }
 
@@ -297,6 +301,13 @@ namespace Nektar
                 w = m_weights;
             }
 
+            /// Return the barycentric weights of the Lagrange interpolants
+            /// through one-dimensional points.
+            inline const Array<OneD, const DataType>& GetBaryWeights() const
+            {
+                return m_bcweights;
+            }
+
             inline void GetPoints(Array<OneD, const DataType> &x) const
             {
                 x = m_points[0];
@@ -370,6 +381,7 @@ namespace Nektar
             PointsKey             m_pointsKey;
             Array<OneD, DataType> m_points[3];
             Array<OneD, DataType> m_weights;
+            Array<OneD, DataType> m_bcweights;
             MatrixSharedPtrType   m_derivmatrix[3];
             NekManager<PointsKey, NekMatrix<DataType>, PointsKey::opLess> m_InterpManager;
             NekManager<PointsKey, NekMatrix<DataType>, PointsKey::opLess> m_GalerkinProjectionManager;
@@ -390,6 +402,47 @@ namespace Nektar
                 m_weights = Array<OneD, DataType>(GetTotNumPoints());
             }
 
+            /**
+             * Calculates the weights \f$ w_j = 1 / \prod_{k \neq j} (z_j -
+             * z_k) \f$ of the barycentric form of the Lagrange interpolants
+             * through one-dimensional points,
+             * \f[ h_j(x) = \frac{w_j / (x - z_j)}{\sum_k w_k / (x - z_k)},
+             * \f]
+             * which evaluates all interpolants at a point in
+             * \f$ O(Q) \f$ operations. The weights are scaled by their
+             * maximum, which cancels in the quotient.
+             */
+            virtual void CalculateBaryWeights()
+            {
+                if (GetPointsDim() != 1)
+                {
+                    return;
+                }
+
+                const unsigned int npts = GetNumPoints();
+                DataType scale = 0.0;
+
+                m_bcweights = Array<OneD, DataType>(npts, 1.0);
+
+                for (unsigned int i = 0; i < npts; ++i)
+                {
+                    for (unsigned int j = 0; j < npts; ++j)
+                    {
+                        if (i != j)
+                        {
+                            m_bcweights[i] *= m_points[0][i] - m_points[0][j];
+                        }
+                    }
+                    m_bcweights[i] = 1.0 / m_bcweights[i];
+                    scale = std::max(scale, std::abs(m_bcweights[i]));
+                }
+
+                for (unsigned int i = 0; i < npts; ++i)
+                {
+                    m_bcweights[i] /= scale;
+                }
+            }
+
             virtual void CalculateDerivMatrix()
             {
                 int totNumPoints = GetTotNumPoints();
@@ -206,6 +206,79 @@ namespace Nektar
             
         }
 
+        /// Solve in place for @p nRhs right-hand sides of length @p n,
+        /// stored consecutively in @p x, using a single call to the LAPACK
+        /// back-substitution routine for the factored matrix.
+        static void SolveMultiple(const int nRhs, Array<OneD, double>& x,
+                   MatrixStorage m_matrixType,
+                   const Array<OneD, const int>& m_ipivot, unsigned int n,
+                   const Array<OneD, const double>& A,
+                   char m_transposeFlag, unsigned int m_numberOfSubDiagonals,
+                   unsigned int m_numberOfSuperDiagonals)
+        {
+            ASSERTL1(x.num_elements() >= nRhs*n,
+                     "Right-hand side array is too small");
+
+            int info = 0;
+            std::string routine;
+
+            switch(m_matrixType)
+            {
+                case eFULL:
+                    routine = "dgetrs";
+                    Lapack::Dgetrs('N', n, nRhs, A.get(), n, (int *)m_ipivot.get(), x.get(), n, info);
+                    break;
+                case eDIAGONAL:
+                    for(int j = 0; j < nRhs; ++j)
+                    {
+                        for(unsigned int i = 0; i < n; ++i)
+                        {
+                            x[j*n+i] *= A[i];
+                        }
+                    }
+                    break;
+                case eUPPER_TRIANGULAR:
+                    routine = "dtptrs";
+                    Lapack::Dtptrs('U', m_transposeFlag, 'N', n, nRhs, A.get(), x.get(), n, info);
+                    break;
+                case eLOWER_TRIANGULAR:
+                    routine = "dtptrs";
+                    Lapack::Dtptrs('L', m_transposeFlag, 'N', n, nRhs, A.get(), x.get(), n, info);
+                    break;
+                case eSYMMETRIC:
+                    routine = "dsptrs";
+                    Lapack::Dsptrs('U', n, nRhs, A.get(), m_ipivot.get(), x.get(), n, info);
+                    break;
+                case ePOSITIVE_DEFINITE_SYMMETRIC:
+                    routine = "dpptrs";
+                    Lapack::Dpptrs('U', n, nRhs, A.get(), x.get(), n, info);
+                    break;
+                case eBANDED:
+                    {
+                        routine = "dgbtrs";
+                        int KL = m_numberOfSubDiagonals;
+                        int KU = m_numberOfSuperDiagonals;
+                        Lapack::Dgbtrs(m_transposeFlag, n, KL, KU, nRhs, A.get(), 2*KL+KU+1, m_ipivot.get(), x.get(), n, info);
+                    }
+                    break;
+                case ePOSITIVE_DEFINITE_SYMMETRIC_BANDED:
+                    {
+                        routine = "dpbtrs";
+                        int KU = m_numberOfSuperDiagonals;
+                        Lapack::Dpbtrs('U', n, KU, nRhs, A.get(), KU+1, x.get(), n, info);
+                    }
+                    break;
+                default:
+                    NEKERROR(ErrorUtil::efatal, "Unhandled matrix type");
+            }
+
+            if( info < 0 )
+            {
+                std::string message = "ERROR: The " + boost::lexical_cast<std::string>(-info) + "th parameter had an illegal parameter for " + routine;
+                ASSERTL0(false, message.c_str());
+            }
+        }
+
         template<typename BVectorType, typename XVectorType>
         static void SolveTranspose(const BVectorType& b, XVectorType& x, MatrixStorage m_matrixType,
                             const Array<OneD, const int>& m_ipivot, unsigned int n,
@@ -434,6 +507,14 @@ namespace Nektar
                                m_ipivot, n, A, m_transposeFlag, m_numberOfSubDiagonals, m_numberOfSuperDiagonals);
             }
         
+            /// Solve in place for @p nRhs right-hand sides stored
+            /// consecutively in @p x.
+            void SolveMultiple(const int nRhs, Array<OneD, double>& x) const
+            {
+                LinearSystemSolver::SolveMultiple(nRhs, x, m_matrixType,
+                      m_ipivot, n, A, m_transposeFlag, m_numberOfSubDiagonals, m_numberOfSuperDiagonals);
+            }
+
             unsigned int GetRows() const { return n; }
             unsigned int GetColumns() const { return n; }
             
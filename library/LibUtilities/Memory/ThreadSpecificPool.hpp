@@ -38,12 +38,14 @@
 #ifndef NEKATAR_LIB_UTILITES_THREAD_SPECIFIC_POOL_HPP
 #define NEKATAR_LIB_UTILITES_THREAD_SPECIFIC_POOL_HPP
 
+#include <boost/atomic.hpp>
 #include <boost/thread/tss.hpp>
 #include <boost/pool/pool.hpp>
 #include <boost/thread/mutex.hpp>
 
 #include <loki/Singleton.h>
 #include <map>
+#include <vector>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
@@ -51,6 +53,25 @@
 
 namespace Nektar
 {
+    /// \brief Usage counters of a memory pool for a single block size.
+    struct MemPoolStatistics
+    {
+        MemPoolStatistics() :
+            m_allocations(0),
+            m_bytesInUse(0),
+            m_highWaterMark(0)
+        {
+        }
+
+        /// Number of blocks allocated since the pool was created.
+        size_t m_allocations;
+        /// Number of bytes in blocks which have not been returned.
+        size_t m_bytesInUse;
+        /// Number of bytes in blocks held by the pool, which is the sum of
+        /// the peak usage of each thread.
+        size_t m_highWaterMark;
+    };
+
     namespace detail
     {
         /// \internal
@@ -61,6 +82,14 @@ namespace Nektar
         /// The pool allocates and deallocates raw memory - the user is responsible for
         /// calling appropriate constructors/destructors when allocating objects.
         ///
+        /// Each thread allocates from its own free list without any locking.
+        /// Every block is preceded by a header recording the thread pool it
+        /// was taken from, so that a block released by a different thread is
+        /// pushed onto a lock-free return queue of its owner, which reclaims
+        /// the queue once its own free list is empty. The per-thread pools of
+        /// exited threads are kept and handed to new threads, since blocks
+        /// taken from them may still be in use.
+        ///
         /// Example:
         ///
         /// \code
@@ -78,30 +107,102 @@ namespace Nektar
         /// \endcode
         class ThreadSpecificPool
         {
+            private:
+                struct LocalPool;
+
+                /// Header in front of each block. It records the owning
+                /// pool while the block is in use, and links free blocks.
+                union BlockHeader
+                {
+                    LocalPool*   m_owner;
+                    BlockHeader* m_next;
+                    double       m_align;
+                };
+
+                /// Pool of a single thread. The free list and counters are
+                /// only modified by the thread which owns the pool.
+                struct LocalPool
+                {
+                    LocalPool(ThreadSpecificPool* parent, size_t chunkSize) :
+                        m_parent(parent),
+                        m_pool(chunkSize),
+                        m_freeList(0),
+                        m_returned(0),
+                        m_allocated(0),
+                        m_freed(0),
+                        m_created(0)
+                    {
+                    }
+
+                    ThreadSpecificPool*        m_parent;
+                    boost::pool<>              m_pool;
+                    BlockHeader*               m_freeList;
+                    boost::atomic<BlockHeader*> m_returned;
+                    size_t                     m_allocated;
+                    size_t                     m_freed;
+                    size_t                     m_created;
+                };
+
             public:
                 ThreadSpecificPool(size_t ByteSize) :
-                    m_pool(),
+                    m_local(&ThreadSpecificPool::ReleaseLocalPool),
                     m_blockSize(ByteSize),
                     m_mutex()
                 {
-                    // We can do the new in the constructor list because the thread specific 
-                    // pointer doesn't have a supporting constructor.
-                    m_pool = new boost::pool<>(m_blockSize);
                 }
 
                 ~ThreadSpecificPool()
                 {
-                    // The documentation isn't particularly clear if delete needs to be called manually
-                    // or if the thread specific pointer will call delete for me.  Looking through the 
-                    // boost code doesn't make it any clearer. 
+                    // Detach the pool of this thread without queueing it for
+                    // reuse, then free the memory of all threads.
+                    m_local.release();
+                    for (size_t i = 0; i < m_all.size(); ++i)
+                    {
+                        delete m_all[i];
+                    }
                 }
 
                 /// \brief Allocate a block of memory of size ByteSize.
                 /// \throw std::bad_alloc if memory is exhausted.
                 void* Allocate()
                 {
-                    boost::mutex::scoped_lock l(m_mutex);
-                    void* result = m_pool->malloc();
+                    LocalPool* local = m_local.get();
+                    if (!local)
+                    {
+                        local = AttachLocalPool();
+                    }
+
+                    BlockHeader* block = local->m_freeList;
+                    if (!block)
+                    {
+                        // Reclaim the blocks released by other threads.
+                        block = local->m_returned.exchange(
+                            0, boost::memory_order_acquire);
+                        for (BlockHeader* b = block; b; b = b->m_next)
+                        {
+                            ++local->m_freed;
+                        }
+                    }
+
+                    if (block)
+                    {
+                        local->m_freeList = block->m_next;
+                    }
+                    else
+                    {
+                        block = static_cast<BlockHeader*>(
+                            local->m_pool.malloc());
+                        if (!block)
+                        {
+                            throw std::bad_alloc();
+                        }
+                        ++local->m_created;
+                    }
+
+                    block->m_owner = local;
+                    ++local->m_allocated;
+
+                    void* result = block + 1;
 
 #if defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
                     memset(result, 0, m_blockSize);
@@ -116,7 +217,6 @@ namespace Nektar
                 /// from this pool.  Doing this will result in undefined behavior.
                 void Deallocate(const void* p)
                 {
-                    boost::mutex::scoped_lock l(m_mutex);
 #if defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
                     // The idea here is to fill the returned memory with some known
                     // pattern, then detect that pattern on the allocate.  If the 
@@ -127,15 +227,96 @@ namespace Nektar
                     //memset(p, '+', m_pool->get_requested_size());
 #endif //defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
 
-                    m_pool->free(const_cast<void*>(p));
+                    BlockHeader* block = static_cast<BlockHeader*>(
+                        const_cast<void*>(p)) - 1;
+                    LocalPool*   owner = block->m_owner;
+
+                    if (owner == m_local.get())
+                    {
+                        block->m_next     = owner->m_freeList;
+                        owner->m_freeList = block;
+                        ++owner->m_freed;
+                    }
+                    else
+                    {
+                        // Push onto the return queue of the owning thread.
+                        BlockHeader* head = owner->m_returned.load(
+                            boost::memory_order_relaxed);
+                        do
+                        {
+                            block->m_next = head;
+                        }
+                        while (!owner->m_returned.compare_exchange_weak(
+                                   head, block, boost::memory_order_release,
+                                   boost::memory_order_relaxed));
+                    }
                 }
 
+                /// \brief Returns the usage counters of the pool, summed
+                /// over all threads.
+                ///
+                /// The counters of other threads are read without
+                /// synchronisation, so the result is approximate while they
+                /// are allocating. Blocks released by a thread other than
+                /// the one which allocated them count as in use until the
+                /// owning thread reclaims them.
+                MemPoolStatistics GetStatistics()
+                {
+                    boost::mutex::scoped_lock l(m_mutex);
+
+                    size_t allocated = 0, freed = 0, created = 0;
+                    for (size_t i = 0; i < m_all.size(); ++i)
+                    {
+                        allocated += m_all[i]->m_allocated;
+                        freed     += m_all[i]->m_freed;
+                        created   += m_all[i]->m_created;
+                    }
+
+                    MemPoolStatistics stats;
+                    stats.m_allocations   = allocated;
+                    stats.m_bytesInUse    = (allocated - freed) * m_blockSize;
+                    stats.m_highWaterMark = created * m_blockSize;
+                    return stats;
+                }
 
             private:
-                //boost::thread_specific_ptr<boost::pool<> > m_pool;
-                boost::pool<>* m_pool;
+                /// Sets up the pool of the calling thread, reusing the pool
+                /// of an exited thread if there is one.
+                LocalPool* AttachLocalPool()
+                {
+                    boost::mutex::scoped_lock l(m_mutex);
+
+                    LocalPool* local;
+                    if (m_orphans.empty())
+                    {
+                        local = new LocalPool(
+                            this, sizeof(BlockHeader) + m_blockSize);
+                        m_all.push_back(local);
+                    }
+                    else
+                    {
+                        local = m_orphans.back();
+                        m_orphans.pop_back();
+                    }
+
+                    m_local.reset(local);
+                    return local;
+                }
+
+                /// Called on thread exit to make the pool of the thread
+                /// available to others.
+                static void ReleaseLocalPool(LocalPool* local)
+                {
+                    ThreadSpecificPool* parent = local->m_parent;
+                    boost::mutex::scoped_lock l(parent->m_mutex);
+                    parent->m_orphans.push_back(local);
+                }
+
+                boost::thread_specific_ptr<LocalPool> m_local;
                 size_t m_blockSize;
                 boost::mutex m_mutex;
+                std::vector<LocalPool*> m_all;
+                std::vector<LocalPool*> m_orphans;
         };
     }
 
@@ -224,6 +405,22 @@ namespace Nektar
                 }
             }
             
+            /// \brief Returns the usage counters of each pool, keyed by
+            /// block size. Requests larger than the largest block size are
+            /// not included.
+            std::map<size_t, MemPoolStatistics> GetStatistics()
+            {
+                std::map<size_t, MemPoolStatistics> stats;
+                stats[4] = m_fourBytePool.GetStatistics();
+
+                PoolMapType::iterator iter;
+                for (iter = m_pools.begin(); iter != m_pools.end(); ++iter)
+                {
+                    stats[iter->first] = iter->second->GetStatistics();
+                }
+                return stats;
+            }
+
         private:
             detail::ThreadSpecificPool m_fourBytePool;
             std::map<size_t, boost::shared_ptr<detail::ThreadSpecificPool> > m_pools;
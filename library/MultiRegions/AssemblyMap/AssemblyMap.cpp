@@ -112,6 +112,9 @@ namespace Nektar
                                                             "GlobalSysSoln");
             m_preconType = pSession->GetSolverInfoAsEnum<PreconditionerType>(
                                                             "Preconditioner");
+            m_iterativeSolverType =
+                pSession->GetSolverInfoAsEnum<IterativeSolverType>(
+                                                            "IterativeSolver");
 
             // Override values with data from GlobalSysSolnInfo section 
             if(pSession->DefinesGlobalSysSolnInfo(variable, "GlobalSysSoln"))
@@ -130,6 +133,15 @@ namespace Nektar
                                                     "Preconditioner", precon);
             }
 
+            if(pSession->DefinesGlobalSysSolnInfo(variable, "IterativeSolver"))
+            {
+                std::string solver = pSession->GetGlobalSysSolnInfo(variable,
+                                                            "IterativeSolver");
+                m_iterativeSolverType =
+                    pSession->GetValueAsEnum<IterativeSolverType>(
+                                                    "IterativeSolver", solver);
+            }
+
             if(pSession->DefinesGlobalSysSolnInfo(variable,
                                                   "IterativeSolverTolerance"))
             {
@@ -186,6 +198,7 @@ namespace Nektar
             m_hash(0),
             m_solnType(oldLevelMap->m_solnType),
             m_preconType(oldLevelMap->m_preconType),
+            m_iterativeSolverType(oldLevelMap->m_iterativeSolverType),
             m_maxIterations(oldLevelMap->m_maxIterations),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
@@ -1210,6 +1223,11 @@ namespace Nektar
             return m_preconType;
         }
 
+        IterativeSolverType AssemblyMap::GetIterativeSolverType() const
+        {
+            return m_iterativeSolverType;
+        }
+
         NekDouble AssemblyMap::GetIterativeTolerance() const
         {
             return m_iterativeTolerance;
@@ -291,6 +291,8 @@ namespace Nektar
             /// Returns the method of solving global systems.
             MULTI_REGIONS_EXPORT GlobalSysSolnType GetGlobalSysSolnType() const;
             MULTI_REGIONS_EXPORT PreconditionerType GetPreconType() const;
+            MULTI_REGIONS_EXPORT IterativeSolverType
+                GetIterativeSolverType() const;
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetMaxIterations() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
@@ -369,6 +371,9 @@ namespace Nektar
             /// Type type of preconditioner to use in iterative solver.
             PreconditionerType m_preconType;
 
+            /// Krylov method to use in iterative solver.
+            IterativeSolverType m_iterativeSolverType;
+
             /// Maximum iterations for iterative solver
             int m_maxIterations;
 
@@ -59,6 +59,7 @@ namespace Nektar
     namespace MultiRegions
     {
         AssemblyMapDG::AssemblyMapDG():
+            m_traceExchangeP2P(false),
             m_numDirichletBndPhys(0)
         {
         }
@@ -831,6 +832,91 @@ namespace Nektar
             {
                 m_traceToUniversalMapUnique[i] = tmp2[i];
             }
+
+            SetUpTraceExchange();
+        }
+
+        /**
+         * Determines, for each trace point shared with another process, the
+         * rank of that process. This is done by gathering the number of
+         * copies of each point together with the minimum and maximum rank
+         * holding it. Points are sorted by universal ID within each
+         * neighbour so that the send and receive buffers of both processes
+         * are ordered consistently.
+         *
+         * The point-to-point exchange is only used if every shared point is
+         * held by exactly two different processes; otherwise all processes
+         * fall back to the gslib exchange.
+         */
+        void AssemblyMapDG::SetUpTraceExchange()
+        {
+            int i;
+            int nTracePhys = m_traceToUniversalMap.num_elements();
+            int rank       = m_comm->GetRank();
+
+            Array<OneD, NekDouble> count  (nTracePhys, 1.0);
+            Array<OneD, NekDouble> minRank(nTracePhys, (NekDouble)rank);
+            Array<OneD, NekDouble> maxRank(nTracePhys, (NekDouble)rank);
+
+            Gs::Gather(count,   Gs::gs_add, m_traceGsh);
+            Gs::Gather(minRank, Gs::gs_min, m_traceGsh);
+            Gs::Gather(maxRank, Gs::gs_max, m_traceGsh);
+
+            int unsupported = 0;
+            map<int, vector<pair<int, int> > > shared;
+
+            for (i = 0; i < nTracePhys; ++i)
+            {
+                int nCopies = (int)(count[i] + 0.5);
+                if (nCopies == 1)
+                {
+                    continue;
+                }
+
+                int pmin = (int)(minRank[i] + 0.5);
+                int pmax = (int)(maxRank[i] + 0.5);
+
+                if (nCopies != 2 || pmin == pmax)
+                {
+                    unsupported = 1;
+                    break;
+                }
+
+                int proc = pmin == rank ? pmax : pmin;
+                shared[proc].push_back(
+                    make_pair(m_traceToUniversalMap[i], i));
+            }
+
+            m_comm->AllReduce(unsupported, LibUtilities::ReduceMax);
+            m_traceExchangeP2P = unsupported == 0;
+
+            if (!m_traceExchangeP2P)
+            {
+                return;
+            }
+
+            int nShared = 0;
+            map<int, vector<pair<int, int> > >::iterator it;
+            for (it = shared.begin(); it != shared.end(); ++it)
+            {
+                sort(it->second.begin(), it->second.end());
+                nShared += it->second.size();
+            }
+
+            m_traceExchangeProcs   = Array<OneD, int>(shared.size());
+            m_traceExchangeOffsets = Array<OneD, int>(shared.size() + 1, 0);
+            m_traceExchangeIds     = Array<OneD, int>(nShared);
+
+            int cnt = 0;
+            for (i = 0, it = shared.begin(); it != shared.end(); ++it, ++i)
+            {
+                m_traceExchangeProcs[i] = it->first;
+                for (int j = 0; j < it->second.size(); ++j)
+                {
+                    m_traceExchangeIds[cnt++] = it->second[j].second;
+                }
+                m_traceExchangeOffsets[i+1] = cnt;
+            }
         }
 
         void AssemblyMapDG::RealignTraceElement(
@@ -919,6 +1005,94 @@ namespace Nektar
             Gs::Gather(pGlobal, Gs::gs_add, m_traceGsh);
         }
 
+        /**
+         * Starts the parallel assembly of each of the trace arrays in @p
+         * pGlobal, equivalent to calling UniversalTraceAssemble on each of
+         * them. The values of all arrays shared with a neighbouring process
+         * are sent in a single message. The arrays may not be accessed
+         * until EndUniversalTraceAssemble has been called on the returned
+         * request.
+         */
+        TraceExchangeRequestSharedPtr
+            AssemblyMapDG::BeginUniversalTraceAssemble(
+                const Array<OneD, Array<OneD, NekDouble> > &pGlobal) const
+        {
+            TraceExchangeRequestSharedPtr req =
+                MemoryManager<TraceExchangeRequest>::AllocateSharedPtr();
+            req->m_data = pGlobal;
+
+            int nData = pGlobal.num_elements();
+            int i, j;
+
+            if (!m_traceExchangeP2P)
+            {
+                for (i = 0; i < nData; ++i)
+                {
+                    UniversalTraceAssemble(req->m_data[i]);
+                }
+                return req;
+            }
+
+            int nProcs = m_traceExchangeProcs.num_elements();
+            req->m_sendBuf = Array<OneD, Array<OneD, NekDouble> >(nProcs);
+            req->m_recvBuf = Array<OneD, Array<OneD, NekDouble> >(nProcs);
+
+            for (i = 0; i < nProcs; ++i)
+            {
+                int nPts = m_traceExchangeOffsets[i+1]
+                         - m_traceExchangeOffsets[i];
+                req->m_recvBuf[i] = Array<OneD, NekDouble>(nData*nPts);
+                req->m_requests.push_back(m_comm->Irecv(
+                    m_traceExchangeProcs[i], req->m_recvBuf[i]));
+            }
+
+            for (i = 0; i < nProcs; ++i)
+            {
+                int offset = m_traceExchangeOffsets[i];
+                int nPts   = m_traceExchangeOffsets[i+1] - offset;
+                req->m_sendBuf[i] = Array<OneD, NekDouble>(nData*nPts);
+                for (j = 0; j < nData; ++j)
+                {
+                    Vmath::Gathr(nPts, &pGlobal[j][0],
+                                 &m_traceExchangeIds[offset],
+                                 &req->m_sendBuf[i][j*nPts]);
+                }
+                req->m_requests.push_back(m_comm->Isend(
+                    m_traceExchangeProcs[i], req->m_sendBuf[i]));
+            }
+
+            return req;
+        }
+
+        /**
+         * Completes an assembly started by BeginUniversalTraceAssemble.
+         */
+        void AssemblyMapDG::EndUniversalTraceAssemble(
+            const TraceExchangeRequestSharedPtr &pRequest) const
+        {
+            if (!m_traceExchangeP2P)
+            {
+                return;
+            }
+
+            m_comm->WaitAll(pRequest->m_requests);
+
+            int nData  = pRequest->m_data.num_elements();
+            int nProcs = m_traceExchangeProcs.num_elements();
+
+            for (int i = 0; i < nProcs; ++i)
+            {
+                int offset = m_traceExchangeOffsets[i];
+                int nPts   = m_traceExchangeOffsets[i+1] - offset;
+                for (int j = 0; j < nData; ++j)
+                {
+                    Vmath::Assmb(nPts, &pRequest->m_recvBuf[i][j*nPts],
+                                 &m_traceExchangeIds[offset],
+                                 &pRequest->m_data[j][0]);
+                }
+            }
+        }
+
         int AssemblyMapDG::v_GetLocalToGlobalMap(const int i) const
         {
             return m_localToGlobalBndMap[i];
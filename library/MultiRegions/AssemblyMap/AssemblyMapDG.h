@@ -49,6 +49,22 @@ namespace Nektar
         class AssemblyMapDG;
         typedef boost::shared_ptr<AssemblyMapDG>  AssemblyMapDGSharedPtr;
 
+        /// State of a trace exchange started by
+        /// AssemblyMapDG::BeginUniversalTraceAssemble.
+        struct TraceExchangeRequest
+        {
+            /// Trace arrays being assembled.
+            Array<OneD, Array<OneD, NekDouble> > m_data;
+            /// Send buffer for each neighbouring process.
+            Array<OneD, Array<OneD, NekDouble> > m_sendBuf;
+            /// Receive buffer for each neighbouring process.
+            Array<OneD, Array<OneD, NekDouble> > m_recvBuf;
+            /// Outstanding communication requests.
+            LibUtilities::CommRequestVector      m_requests;
+        };
+        typedef boost::shared_ptr<TraceExchangeRequest>
+            TraceExchangeRequestSharedPtr;
+
         ///
         class AssemblyMapDG: public AssemblyMap
         {
@@ -90,8 +106,26 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
                 Array<OneD, NekDouble> &pGlobal) const;
 
+            MULTI_REGIONS_EXPORT TraceExchangeRequestSharedPtr
+                BeginUniversalTraceAssemble(
+                    const Array<OneD, Array<OneD, NekDouble> > &pGlobal) const;
+
+            MULTI_REGIONS_EXPORT void EndUniversalTraceAssemble(
+                const TraceExchangeRequestSharedPtr &pRequest) const;
+
         protected:
             Gs::gs_data * m_traceGsh;
+
+            /// Whether the trace exchange is performed with point-to-point
+            /// communication rather than through #m_traceGsh.
+            bool m_traceExchangeP2P;
+            /// Processes sharing trace points with this process.
+            Array<OneD, int> m_traceExchangeProcs;
+            /// Offsets into #m_traceExchangeIds for each process.
+            Array<OneD, int> m_traceExchangeOffsets;
+            /// Trace points shared with each process, ordered by universal
+            /// ID so that both processes agree on the ordering.
+            Array<OneD, int> m_traceExchangeIds;
             
             /// Number of physical dirichlet boundary values in trace
             int m_numDirichletBndPhys;
@@ -112,6 +146,8 @@ namespace Nektar
                 const ExpListSharedPtr trace,
                 const PeriodicMap     &perMap = NullPeriodicMap);
 
+            void SetUpTraceExchange();
+
             virtual int v_GetLocalToGlobalMap(const int i) const;
 
             virtual int v_GetGlobalToUniversalMap(const int i) const;
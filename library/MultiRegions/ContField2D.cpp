@@ -875,13 +875,42 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing,
                 const bool PhysSpaceForcing)
 
+        {
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            Array<OneD,NekDouble> wsp(contNcoeffs);
+            HelmholtzForcing(inarray, wsp, PhysSpaceForcing);
+
+            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
+            
+            if(flags.isSet(eUseGlobal))
+            {
+                GlobalSolve(key,wsp,outarray,dirForcing);
+            }
+            else
+            {
+                Array<OneD,NekDouble> tmp(contNcoeffs);
+                LocalToGlobal(outarray,tmp);
+                GlobalSolve(key,wsp,tmp,dirForcing);
+                GlobalToLocal(tmp,outarray);
+            }
+        }
+
+
+        /**
+         * Forms the global right-hand side of the Helmholtz problem from the
+         * forcing function in @p inarray, including the weak boundary
+         * conditions of this field.
+         */
+        void ContField2D::HelmholtzForcing(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &wsp,
+                const bool PhysSpaceForcing)
         {
             //----------------------------------
             //  Setup RHS Inner product
             //----------------------------------
             // Inner product of forcing
             int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
-            Array<OneD,NekDouble> wsp(contNcoeffs);
             if(PhysSpaceForcing)
             {
                 IProductWRTBase(inarray,wsp,eGlobal);
@@ -920,19 +949,79 @@ namespace Nektar
 
             // Add weak boundary conditions to forcing
             Vmath::Vadd(contNcoeffs, wsp, 1, gamma, 1, wsp, 1);
+        }
 
-            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
-            
-            if(flags.isSet(eUseGlobal))
+
+        /**
+         * Solves the Helmholtz problem for several fields. When all fields
+         * share the local to global mapping of this field, and therefore the
+         * same global matrix, the global systems are solved together using
+         * GlobalLinSys::SolveMultiple. Otherwise the fields are solved in
+         * turn.
+         */
+        void ContField2D::v_HelmSolveMultiple(
+                const Array<OneD, ExpListSharedPtr> &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors)
+        {
+            int i, nFields = fields.num_elements();
+            Array<OneD, ContField2DSharedPtr> cfields(nFields);
+
+            for (i = 0; i < nFields; ++i)
             {
-                GlobalSolve(key,wsp,outarray,dirForcing);
+                cfields[i] = boost::dynamic_pointer_cast<ContField2D>(
+                    fields[i]);
+
+                if (!cfields[i] || cfields[i]->m_locToGloMap != m_locToGloMap)
+                {
+                    ExpList::v_HelmSolveMultiple(
+                        fields, inarray, outarray, flags, factors);
+                    return;
+                }
             }
-            else
+
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            int NumDirBcs   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+
+            Array<OneD, Array<OneD, const NekDouble> > rhs(nFields);
+            Array<OneD, Array<OneD,       NekDouble> > inout(nFields);
+
+            for (i = 0; i < nFields; ++i)
             {
-                Array<OneD,NekDouble> tmp(contNcoeffs);
-                LocalToGlobal(outarray,tmp);
-                GlobalSolve(key,wsp,tmp,dirForcing);
-                GlobalToLocal(tmp,outarray);
+                Array<OneD, NekDouble> wsp(contNcoeffs);
+                cfields[i]->HelmholtzForcing(inarray[i], wsp, true);
+                rhs[i] = wsp;
+
+                if(flags.isSet(eUseGlobal))
+                {
+                    inout[i] = outarray[i];
+                }
+                else
+                {
+                    inout[i] = Array<OneD, NekDouble>(contNcoeffs);
+                    LocalToGlobal(outarray[i], inout[i]);
+                }
+
+                // Set the Dirichlet degrees of freedom of each field
+                cfields[i]->v_ImposeDirichletConditions(inout[i]);
+            }
+
+            if(contNcoeffs - NumDirBcs > 0)
+            {
+                GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                    factors);
+                GetGlobalLinSys(key)->SolveMultiple(rhs, inout,
+                                                    m_locToGloMap);
+            }
+
+            if(!flags.isSet(eUseGlobal))
+            {
+                for (i = 0; i < nFields; ++i)
+                {
+                    GlobalToLocal(inout[i], outarray[i]);
+                }
             }
         }
 
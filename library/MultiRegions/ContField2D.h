@@ -248,6 +248,21 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
 
+            /// Solves the two-dimensional Helmholtz equation for several
+            /// fields which share the same global system.
+            MULTI_REGIONS_EXPORT virtual void v_HelmSolveMultiple(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors);
+
+            /// Forms the right-hand side of the Helmholtz equation.
+            void HelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp,
+                    const bool PhysSpaceForcing);
+
             /// Calculates the result of the multiplication of a global
             /// matrix of type specified by \a mkey with a vector given by \a
             /// inarray.
@@ -184,6 +184,20 @@ namespace Nektar
                     const StdRegions::VarCoeffMap &varcoeff,
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
+
+            virtual void v_HelmSolveMultiple(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors);
+
+            /// Forms the right-hand side of the Helmholtz equation.
+            void HelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp,
+                    const bool PhysSpaceForcing);
+
             virtual void v_GeneralMatrixOp(
                     const GlobalMatrixKey             &gkey,
                     const Array<OneD,const NekDouble> &inarray,
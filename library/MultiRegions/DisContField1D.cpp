@@ -846,6 +846,9 @@ namespace Nektar
          * set of trace normals since these are always extracted from
          * left-adjacent elements.
          *
+         * The parallel exchange of the trace may still be in progress on
+         * return, and is completed by v_EndFwdBwdTracePhys.
+         * 
          * @param field is a NekDouble array which contains the 1D data
          *              from which we wish to extract the backward and forward
          *              orientated trace/edge arrays.
@@ -853,11 +856,14 @@ namespace Nektar
          * @param Bwd   The resulting backwards space.
          */
 
-        void DisContField1D::v_GetFwdBwdTracePhys(
+        void DisContField1D::v_BeginFwdBwdTracePhys(
             const Array<OneD, const NekDouble> &field,
-            Array<OneD,       NekDouble> &Fwd,
-            Array<OneD,       NekDouble> &Bwd)
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
         {
+            // Complete any exchange still in progress.
+            v_EndFwdBwdTracePhys();
+
             // Counter variables
             int  n, v;
             
@@ -943,10 +949,33 @@ namespace Nektar
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
 
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Start parallel exchange for forwards/backwards spaces.
+            Array<OneD, Array<OneD, NekDouble> > traces(2);
+            traces[0] = Fwd;
+            traces[1] = Bwd;
+            m_traceExchange = m_traceMap->BeginUniversalTraceAssemble(traces);
+        }
+
+        /**
+         * @brief Completes the parallel exchange of the trace started by
+         * v_BeginFwdBwdTracePhys.
+         */
+        void DisContField1D::v_EndFwdBwdTracePhys()
+        {
+            if (m_traceExchange)
+            {
+                m_traceMap->EndUniversalTraceAssemble(m_traceExchange);
+                m_traceExchange.reset();
+            }
+        }
 
+        void DisContField1D::v_GetFwdBwdTracePhys(
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            v_BeginFwdBwdTracePhys(field, Fwd, Bwd);
+            v_EndFwdBwdTracePhys();
         }
         
 	
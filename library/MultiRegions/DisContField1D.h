@@ -121,6 +121,8 @@ namespace Nektar
 
             /// Local to global DG mapping for trace space.
             AssemblyMapDGSharedPtr                        m_traceMap;
+            /// Trace exchange in progress, if any.
+            TraceExchangeRequestSharedPtr m_traceExchange;
 
             /**
              * @brief A set storing the global IDs of any boundary edges.
@@ -181,6 +183,11 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &field,
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
+            virtual void v_BeginFwdBwdTracePhys(
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+            virtual void v_EndFwdBwdTracePhys();
             virtual void v_ExtractTracePhys(
                       Array<OneD,       NekDouble> &outarray);
             virtual void v_ExtractTracePhys(
@@ -1348,17 +1348,23 @@ namespace Nektar
          * set of trace normals since these are always extracted from
          * left-adjacent elements.
          *
+         * The parallel exchange of the trace may still be in progress on
+         * return, and is completed by v_EndFwdBwdTracePhys.
+         * 
          * @param field is a NekDouble array which contains the 2D data
          *              from which we wish to extract the backward and
          *              forward orientated trace/edge arrays.
          * @param Fwd   The resulting forwards space.
          * @param Bwd   The resulting backwards space.
          */
-        void DisContField2D::v_GetFwdBwdTracePhys(
+        void DisContField2D::v_BeginFwdBwdTracePhys(
             const Array<OneD, const NekDouble> &field,
                   Array<OneD,       NekDouble> &Fwd,
                   Array<OneD,       NekDouble> &Bwd)
         {
+            // Complete any exchange still in progress.
+            v_EndFwdBwdTracePhys();
+
             int cnt, n, e, npts, phys_offset;
 
             // Zero forward/backward vectors.
@@ -1474,9 +1480,33 @@ namespace Nektar
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
 
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Start parallel exchange for forwards/backwards spaces.
+            Array<OneD, Array<OneD, NekDouble> > traces(2);
+            traces[0] = Fwd;
+            traces[1] = Bwd;
+            m_traceExchange = m_traceMap->BeginUniversalTraceAssemble(traces);
+        }
+
+        /**
+         * @brief Completes the parallel exchange of the trace started by
+         * v_BeginFwdBwdTracePhys.
+         */
+        void DisContField2D::v_EndFwdBwdTracePhys()
+        {
+            if (m_traceExchange)
+            {
+                m_traceMap->EndUniversalTraceAssemble(m_traceExchange);
+                m_traceExchange.reset();
+            }
+        }
+
+        void DisContField2D::v_GetFwdBwdTracePhys(
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            v_BeginFwdBwdTracePhys(field, Fwd, Bwd);
+            v_EndFwdBwdTracePhys();
         }
         
 
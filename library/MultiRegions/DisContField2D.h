@@ -147,6 +147,8 @@ namespace Nektar
             GlobalLinSysMapShPtr   m_globalBndMat;
             ExpListSharedPtr       m_trace;
             AssemblyMapDGSharedPtr m_traceMap;
+            /// Trace exchange in progress, if any.
+            TraceExchangeRequestSharedPtr m_traceExchange;
             
             /**
              * Map of local trace (the points at the face of
@@ -205,6 +207,11 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &field,
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
+            virtual void v_BeginFwdBwdTracePhys(
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+            virtual void v_EndFwdBwdTracePhys();
             virtual void v_GetFwdBwdTracePhys(
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
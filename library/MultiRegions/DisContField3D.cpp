@@ -1714,11 +1714,14 @@ using namespace boost::assign;
             v_GetFwdBwdTracePhys(m_phys, Fwd, Bwd);
         }
 
-        void DisContField3D::v_GetFwdBwdTracePhys(
-                                          const Array<OneD, const NekDouble> &field,
+        void DisContField3D::v_BeginFwdBwdTracePhys(
+            const Array<OneD, const NekDouble> &field,
                   Array<OneD,       NekDouble> &Fwd,
                   Array<OneD,       NekDouble> &Bwd)
         {
+            // Complete any exchange still in progress.
+            v_EndFwdBwdTracePhys();
+
             int n, cnt, npts, e;
 
             // Zero vectors.
@@ -1792,9 +1795,33 @@ using namespace boost::assign;
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
             
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            // Start parallel exchange for forwards/backwards spaces.
+            Array<OneD, Array<OneD, NekDouble> > traces(2);
+            traces[0] = Fwd;
+            traces[1] = Bwd;
+            m_traceExchange = m_traceMap->BeginUniversalTraceAssemble(traces);
+        }
+
+        /**
+         * @brief Completes the parallel exchange of the trace started by
+         * v_BeginFwdBwdTracePhys.
+         */
+        void DisContField3D::v_EndFwdBwdTracePhys()
+        {
+            if (m_traceExchange)
+            {
+                m_traceMap->EndUniversalTraceAssemble(m_traceExchange);
+                m_traceExchange.reset();
+            }
+        }
+
+        void DisContField3D::v_GetFwdBwdTracePhys(
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            v_BeginFwdBwdTracePhys(field, Fwd, Bwd);
+            v_EndFwdBwdTracePhys();
         }
 
          const vector<bool> &DisContField3D::v_GetLeftAdjacentFaces(void) const
@@ -113,6 +113,8 @@ namespace Nektar
             GlobalLinSysMapShPtr        m_globalBndMat;
             ExpListSharedPtr            m_trace;
             AssemblyMapDGSharedPtr      m_traceMap;
+            /// Trace exchange in progress, if any.
+            TraceExchangeRequestSharedPtr m_traceExchange;
             /// Map of local trace (the points at the face of the
             /// element) to the trace space discretisation
             LocTraceToTraceMapSharedPtr m_locTraceToTraceMap; 
@@ -170,6 +172,11 @@ namespace Nektar
                 const Array<OneD,const NekDouble> &field,
                       Array<OneD,      NekDouble> &Fwd,
                       Array<OneD,      NekDouble> &Bwd);
+            virtual void v_BeginFwdBwdTracePhys(
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+            virtual void v_EndFwdBwdTracePhys();
             virtual const std::vector<bool> &v_GetLeftAdjacentFaces(void) const;
             virtual void v_ExtractTracePhys(
                       Array<OneD,       NekDouble> &outarray);
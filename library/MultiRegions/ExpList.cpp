@@ -62,12 +62,37 @@
 #include <Collections/CollectionOptimisation.h>
 #include <Collections/Operator.h>
 
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
 using namespace std;
 
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
 namespace Nektar
 {
     namespace MultiRegions
     {
+        /**
+         * @brief R-tree of the bounding boxes of the elements of an
+         * expansion list, used to find the elements which may contain a
+         * point without testing every element.
+         */
+        struct ElmtBoxTree
+        {
+            typedef bg::model::point<NekDouble, 3, bg::cs::cartesian> BPoint;
+            typedef bg::model::box<BPoint>                          BBox;
+            typedef std::pair<BBox, int>                            BoxElmt;
+
+            bgi::rtree<BoxElmt, bgi::rstar<16> > m_tree;
+            /// Number of coordinates spanned by the boxes, the others being
+            /// zero.
+            int                                  m_coordim;
+        };
+
         /**
          * @class ExpList
          * All multi-elemental expansions \f$u^{\delta}(\boldsymbol{x})\f$ can
@@ -1340,6 +1365,94 @@ namespace Nektar
             }
         }
 
+        /**
+         * Evaluates the backward transformation of the local coefficients
+         * in \a inarray and the derivatives of the result, as if
+         * BwdTrans_IterPerExp were followed by PhysDeriv. Collections for
+         * which the fused operator is available evaluate both in one pass
+         * over the coefficients of each element; the others apply the two
+         * operators in turn.
+         *
+         * @param   inarray         Local coefficients of size
+         *                          \f$N_{\mathrm{eof}}\f$.
+         * @param   outarray        Physical values of size
+         *                          \f$Q_{\mathrm{tot}}\f$.
+         * @param   out_d0          Derivative \f$\frac{d}{dx_1}\f$.
+         * @param   out_d1          Derivative \f$\frac{d}{dx_2}\f$.
+         * @param   out_d2          Derivative \f$\frac{d}{dx_3}\f$.
+         *
+         * Derivatives for which an empty array is given are not computed.
+         */
+        void ExpList::v_BwdTransPhysDeriv_IterPerExp(
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray,
+                  Array<OneD,       NekDouble> &out_d0,
+                  Array<OneD,       NekDouble> &out_d1,
+                  Array<OneD,       NekDouble> &out_d2)
+        {
+            Array<OneD, NekDouble> e_out;
+            Array<OneD, NekDouble> e_out_d0;
+            Array<OneD, NekDouble> e_out_d1;
+            Array<OneD, NekDouble> e_out_d2;
+            Array<OneD, NekDouble> e_wsp;
+            Array<OneD, NekDouble> wsp;
+            int offset;
+            for (int i = 0; i < m_collections.size(); ++i)
+            {
+                offset   = m_coll_phys_offset[i];
+                e_out    = outarray + offset;
+
+                // An offset into an empty array is no longer empty, so only
+                // take views of the derivatives which have been requested.
+                if (out_d0.num_elements())
+                {
+                    e_out_d0 = out_d0 + offset;
+                }
+                if (out_d1.num_elements())
+                {
+                    e_out_d1 = out_d1 + offset;
+                }
+                if (out_d2.num_elements())
+                {
+                    e_out_d2 = out_d2 + offset;
+                }
+
+                if (m_collections[i].HasOperator(
+                        Collections::eBwdTransPhysDeriv))
+                {
+                    m_collections[i].ApplyOperator(
+                        Collections::eBwdTransPhysDeriv,
+                        inarray + m_coll_coeff_offset[i],
+                        e_out, e_out_d0, e_out_d1, e_out_d2);
+                }
+                else
+                {
+                    // The PhysDeriv operators compute every direction, so
+                    // the derivatives which have not been requested are
+                    // written to a scratch array.
+                    if (wsp.num_elements() == 0 &&
+                        !(out_d0.num_elements() && out_d1.num_elements() &&
+                          out_d2.num_elements()))
+                    {
+                        wsp = Array<OneD, NekDouble>(m_npoints);
+                    }
+                    if (wsp.num_elements())
+                    {
+                        e_wsp = wsp + offset;
+                    }
+
+                    m_collections[i].ApplyOperator(
+                        Collections::eBwdTrans,
+                        inarray + m_coll_coeff_offset[i], e_out);
+                    m_collections[i].ApplyOperator(
+                        Collections::ePhysDeriv, e_out,
+                        out_d0.num_elements() ? e_out_d0 : e_wsp,
+                        out_d1.num_elements() ? e_out_d1 : e_wsp,
+                        out_d2.num_elements() ? e_out_d2 : e_wsp);
+                }
+            }
+        }
+
         LocalRegions::ExpansionSharedPtr& ExpList::GetExp(
                     const Array<OneD, const NekDouble> &gloCoord)
         {
@@ -1444,6 +1557,26 @@ namespace Nektar
             // non-embedded mesh (point can only match one element)
             else
             {
+                // Test the elements whose bounding box contains the point
+                // first, which is the only search needed unless the nearest
+                // element is requested for a point outside the mesh.
+                std::vector<int> candidates;
+                GetElmtCandidates(gloCoords, candidates);
+
+                for (int i = 0; i < candidates.size(); ++i)
+                {
+                    if ((*m_exp)[candidates[i]]->GetGeom()->ContainsPoint(
+                            gloCoords, locCoords, tol, nearpt))
+                    {
+                        return candidates[i];
+                    }
+                }
+
+                if (!returnNearestElmt)
+                {
+                    return -1;
+                }
+
                 static int start = 0;
                 int min_id  = 0;
                 NekDouble nearpt_min = 1e6;
@@ -1515,6 +1648,264 @@ namespace Nektar
             }
         }
 
+        /**
+         * Finds the elements whose bounding box, enlarged by a tenth of its
+         * size to account for curved elements, contains @p gloCoords. The
+         * R-tree of the bounding boxes is built on the first call, from the
+         * quadrature points of each element. Only the coordinates spanned by
+         * the elements are compared, so that, for instance, the points of
+         * any plane of a homogeneous expansion are located in the
+         * two-dimensional expansion of its first plane.
+         */
+        void ExpList::GetElmtCandidates(
+            const Array<OneD, const NekDouble> &gloCoords,
+            std::vector<int>                   &candidates)
+        {
+            typedef ElmtBoxTree::BPoint  BPoint;
+            typedef ElmtBoxTree::BBox    BBox;
+            typedef ElmtBoxTree::BoxElmt BoxElmt;
+
+            if (!m_elmtBoxTree)
+            {
+                m_elmtBoxTree = MemoryManager<ElmtBoxTree>::AllocateSharedPtr();
+                m_elmtBoxTree->m_coordim = (*m_exp)[0]->GetCoordim();
+
+                std::vector<BoxElmt> boxes((*m_exp).size());
+                for (int i = 0; i < (*m_exp).size(); ++i)
+                {
+                    int nq      = (*m_exp)[i]->GetTotPoints();
+                    int coordim = m_elmtBoxTree->m_coordim;
+                    Array<OneD, Array<OneD, NekDouble> > x(3);
+                    for (int j = 0; j < 3; ++j)
+                    {
+                        x[j] = Array<OneD, NekDouble>(nq, 0.0);
+                    }
+                    (*m_exp)[i]->GetCoords(x[0], x[1], x[2]);
+
+                    NekDouble xmin[3], xmax[3], size = 0.0;
+                    for (int j = 0; j < 3; ++j)
+                    {
+                        xmin[j] = j < coordim ? Vmath::Vmin(nq, x[j], 1) : 0.0;
+                        xmax[j] = j < coordim ? Vmath::Vmax(nq, x[j], 1) : 0.0;
+                        size    = max(size, xmax[j] - xmin[j]);
+                    }
+
+                    NekDouble margin = 0.1 * size;
+                    boxes[i] = BoxElmt(
+                        BBox(BPoint(xmin[0] - margin, xmin[1] - margin,
+                                    xmin[2] - margin),
+                             BPoint(xmax[0] + margin, xmax[1] + margin,
+                                    xmax[2] + margin)),
+                        i);
+                }
+
+                // Bulk loading builds a better balanced tree than inserting
+                // the boxes one at a time.
+                bgi::rtree<BoxElmt, bgi::rstar<16> > tree(boxes);
+                m_elmtBoxTree->m_tree.swap(tree);
+            }
+
+            NekDouble x[3] = {0.0, 0.0, 0.0};
+            for (int j = 0; j < min(m_elmtBoxTree->m_coordim,
+                                    (int)gloCoords.num_elements()); ++j)
+            {
+                x[j] = gloCoords[j];
+            }
+
+            std::vector<BoxElmt> result;
+            m_elmtBoxTree->m_tree.query(
+                bgi::intersects(BPoint(x[0], x[1], x[2])),
+                std::back_inserter(result));
+
+            candidates.resize(result.size());
+            for (int i = 0; i < result.size(); ++i)
+            {
+                candidates[i] = result[i].second;
+            }
+
+            // Test the elements in the order of the expansion list.
+            std::sort(candidates.begin(), candidates.end());
+        }
+
+        /**
+         * Locates each point of @p gloCoords, with coordinate @p d of point
+         * @p i in gloCoords[d][i], as GetExpIndex does for a single point.
+         * The points are given in the coordinates spanned by the elements:
+         * further components of @p gloCoords are ignored and missing ones
+         * are taken as zero. The element found for the previous point is
+         * tested first, which avoids searching the tree for consecutive
+         * points of the same element.
+         *
+         * @param gloCoords  Coordinates of the points.
+         * @param elmtIds    Element containing each point, or -1.
+         * @param locCoords  Local coordinates of the points in their element,
+         *                   with coordinate @p d of point @p i in
+         *                   locCoords[d][i] for each coordinate spanned by
+         *                   the elements.
+         */
+        void ExpList::GetExpIndex(
+            const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+            Array<OneD, int>                                 &elmtIds,
+            Array<OneD, Array<OneD, NekDouble> >             &locCoords,
+            NekDouble tol,
+            bool returnNearestElmt)
+        {
+            const int dim     = gloCoords.num_elements();
+            const int npts    = dim > 0 ? gloCoords[0].num_elements() : 0;
+            const int coordim = GetNumElmts() > 0 ? GetExp(0)->GetCoordim() : 0;
+
+            if (elmtIds.num_elements() != npts)
+            {
+                elmtIds = Array<OneD, int>(npts);
+            }
+            if (locCoords.num_elements() != coordim)
+            {
+                locCoords = Array<OneD, Array<OneD, NekDouble> >(coordim);
+            }
+            for (int j = 0; j < coordim; ++j)
+            {
+                if (locCoords[j].num_elements() != npts)
+                {
+                    locCoords[j] = Array<OneD, NekDouble>(npts, 0.0);
+                }
+            }
+
+            if (coordim == 0)
+            {
+                elmtIds = Array<OneD, int>(npts, -1);
+                return;
+            }
+
+            // A point of a manifold may lie in several elements, of which
+            // GetExpIndex picks the nearest, so the last element found is
+            // only tested first for other meshes.
+            bool embedded = coordim > GetExp(0)->GetShapeDimension();
+
+            Array<OneD, NekDouble> x(coordim, 0.0), xi(coordim, 0.0);
+            NekDouble nearpt = 1e6;
+            int last = -1;
+
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int j = 0; j < min(dim, coordim); ++j)
+                {
+                    x[j] = gloCoords[j][i];
+                }
+
+                if (!embedded && last >= 0 &&
+                    (*m_exp)[last]->GetGeom()->ContainsPoint(
+                        x, xi, tol, nearpt))
+                {
+                    elmtIds[i] = last;
+                }
+                else
+                {
+                    elmtIds[i] = GetExpIndex(x, xi, tol, returnNearestElmt);
+                    last       = elmtIds[i];
+                }
+
+                for (int j = 0; j < coordim; ++j)
+                {
+                    locCoords[j][i] = xi[j];
+                }
+            }
+        }
+
+        /**
+         * Evaluates the fields @p inarray, given at the quadrature points of
+         * this expansion list, at @p elmtIds.num_elements() points whose
+         * element and local coordinates have been found by GetExpIndex. The
+         * points are grouped by element, and the interpolation weights of
+         * all points of an element are computed once and applied to every
+         * field with StdExpansion::StdPhysEvaluate. Values of points with a
+         * negative element id are left unchanged.
+         *
+         * @param elmtIds    Element containing each point.
+         * @param locCoords  Local coordinates of the points, with coordinate
+         *                   @p d of point @p i in locCoords[d][i].
+         * @param inarray    Fields to evaluate.
+         * @param outarray   Values of the fields at the points.
+         */
+        void ExpList::PhysEvaluate(
+            const Array<OneD, const int>                     &elmtIds,
+            const Array<OneD, const Array<OneD, NekDouble> > &locCoords,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+            Array<OneD, Array<OneD, NekDouble> >             &outarray)
+        {
+            const int npts    = elmtIds.num_elements();
+            const int nelmts  = (*m_exp).size();
+            const int nfields = inarray.num_elements();
+            const int dim     = locCoords.num_elements();
+            int i, j, n, e, f;
+
+            // Sort the points by element.
+            Array<OneD, int> start(nelmts + 1, 0);
+            Array<OneD, int> order(npts);
+
+            for (i = 0; i < npts; ++i)
+            {
+                if (elmtIds[i] >= 0)
+                {
+                    ++start[elmtIds[i] + 1];
+                }
+            }
+
+            int maxpts = 0;
+            for (e = 0; e < nelmts; ++e)
+            {
+                maxpts        = max(maxpts, start[e + 1]);
+                start[e + 1] += start[e];
+            }
+
+            Array<OneD, int> pos(nelmts);
+            Vmath::Vcopy(nelmts, start, 1, pos, 1);
+            for (i = 0; i < npts; ++i)
+            {
+                if (elmtIds[i] >= 0)
+                {
+                    order[pos[elmtIds[i]]++] = i;
+                }
+            }
+
+            // Workspace for the points of one element.
+            Array<OneD, Array<OneD, NekDouble> > elmtCoords(dim);
+            for (j = 0; j < dim; ++j)
+            {
+                elmtCoords[j] = Array<OneD, NekDouble>(maxpts);
+            }
+            Array<OneD, NekDouble> weights, values(maxpts);
+
+            for (e = 0; e < nelmts; ++e)
+            {
+                n = start[e + 1] - start[e];
+                if (n == 0)
+                {
+                    continue;
+                }
+
+                for (i = 0; i < n; ++i)
+                {
+                    for (j = 0; j < dim; ++j)
+                    {
+                        elmtCoords[j][i] = locCoords[j][order[start[e] + i]];
+                    }
+                }
+
+                (*m_exp)[e]->StdPhysEvaluateWeights(n, elmtCoords, weights);
+
+                for (f = 0; f < nfields; ++f)
+                {
+                    (*m_exp)[e]->StdPhysEvaluate(
+                        n, weights, inarray[f] + m_phys_offset[e], values);
+
+                    for (i = 0; i < n; ++i)
+                    {
+                        outarray[f][order[start[e] + i]] = values[i];
+                    }
+                }
+            }
+        }
+
 
         /**
          * Configures geometric info, such as tangent direction, on each
@@ -2480,6 +2871,22 @@ namespace Nektar
             ASSERTL0(false,
                      "This method is not defined or valid for this class type");
         }
+
+        /**
+         * By default the trace is filled and exchanged immediately, so
+         * that v_EndFwdBwdTracePhys has nothing left to do.
+         */
+        void ExpList::v_BeginFwdBwdTracePhys(
+                                const Array<OneD,const NekDouble>  &field,
+                                      Array<OneD,NekDouble> &Fwd,
+                                      Array<OneD,NekDouble> &Bwd)
+        {
+            v_GetFwdBwdTracePhys(field, Fwd, Bwd);
+        }
+
+        void ExpList::v_EndFwdBwdTracePhys()
+        {
+        }
         
         const vector<bool> &ExpList::v_GetLeftAdjacentFaces(void) const
         {
@@ -2525,6 +2932,19 @@ namespace Nektar
             ASSERTL0(false, "HelmSolve not implemented.");
         }
 
+        void ExpList::v_HelmSolveMultiple(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors)
+        {
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->HelmSolve(inarray[i], outarray[i], flags, factors);
+            }
+        }
+
         void ExpList::v_LinearAdvectionDiffusionReactionSolve(
                        const Array<OneD, Array<OneD, NekDouble> > &velocity,
                        const Array<OneD, const NekDouble> &inarray,
@@ -3206,7 +3626,8 @@ namespace Nektar
                                                          impTypes, verbose);
                     }
 
-                    Collections::Collection tmp(collExp, impTypes);
+                    Collections::Collection tmp(collExp, impTypes,
+                                                colOpt.GetBlockSize(exp));
                     m_collections.push_back(tmp);
                 }
                 else
@@ -3243,7 +3664,8 @@ namespace Nektar
                                                                  verbose);
                             }
 
-                            Collections::Collection tmp(collExp, impTypes);
+                            Collections::Collection tmp(
+                                collExp, impTypes, colOpt.GetBlockSize(exp));
                             m_collections.push_back(tmp);
 
 
@@ -3272,7 +3694,8 @@ namespace Nektar
                                                                  impTypes,verbose);
                             }
 
-                            Collections::Collection tmp(collExp, impTypes);
+                            Collections::Collection tmp(
+                                collExp, impTypes, colOpt.GetBlockSize(exp));
                             m_collections.push_back(tmp);
                             collExp.clear();
                             collcnt = 0;
@@ -39,6 +39,7 @@
 #include <LibUtilities/Communication/Transposition.h>
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <SpatialDomains/MeshGraph.h>
 #include <LocalRegions/Expansion.h>
 #include <Collections/Collection.h>
@@ -62,6 +63,7 @@ namespace Nektar
         class AssemblyMapCG;
         class GlobalLinSysKey;
         class GlobalMatrix;
+        struct ElmtBoxTree;
 
         enum Direction
         {
@@ -282,6 +284,15 @@ namespace Nektar
                 NullNekDouble1DArray,
                 const bool PhysSpaceForcing = true);
             
+            /// Solve helmholtz problems with the same operator for several
+            /// fields
+            inline void HelmSolveMultiple(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors);
+
             /// Solve Advection Diffusion Reaction
             inline void LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
@@ -315,6 +326,15 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &inarray,
                       Array<OneD,NekDouble> &outarray);
 
+            /// This function elementally evaluates the backward transformation
+            /// together with the derivatives of the resulting field.
+            inline void BwdTransPhysDeriv_IterPerExp (
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray,
+                      Array<OneD,       NekDouble> &out_d0,
+                      Array<OneD,       NekDouble> &out_d1 = NullNekDouble1DArray,
+                      Array<OneD,       NekDouble> &out_d2 = NullNekDouble1DArray);
+
             ///
             inline void BwdTrans (
                 const Array<OneD,
@@ -657,6 +677,22 @@ namespace Nektar
                 NekDouble tol = 0.0,
                 bool returnNearestElmt = false);
 
+            /// This function returns the index and the Local Cartesian
+            /// Coordinates of the elements containing a batch of points.
+            MULTI_REGIONS_EXPORT void GetExpIndex(
+                const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                Array<OneD, int>                                 &elmtIds,
+                Array<OneD, Array<OneD, NekDouble> >             &locCoords,
+                NekDouble tol = 0.0,
+                bool returnNearestElmt = false);
+
+            /// Evaluate fields at a batch of points located by GetExpIndex.
+            MULTI_REGIONS_EXPORT void PhysEvaluate(
+                const Array<OneD, const int>                     &elmtIds,
+                const Array<OneD, const Array<OneD, NekDouble> > &locCoords,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                Array<OneD, Array<OneD, NekDouble> >             &outarray);
+
             /// Get the start offset position for a global list of #m_coeffs
             /// correspoinding to element n.
             inline int GetCoeff_Offset(int n) const;
@@ -752,6 +788,16 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            /// Start filling @a Fwd and @a Bwd; the parallel exchange may
+            /// still be in progress on return.
+            inline void BeginFwdBwdTracePhys(
+                const Array<OneD,const NekDouble> &field,
+                      Array<OneD,NekDouble> &Fwd,
+                      Array<OneD,NekDouble> &Bwd);
+
+            /// Complete any exchange started by BeginFwdBwdTracePhys.
+            inline void EndFwdBwdTracePhys();
+
             inline const std::vector<bool> &GetLeftAdjacentFaces(void) const;
             
             inline void ExtractTracePhys(Array<OneD,NekDouble> &outarray);
@@ -1061,6 +1107,15 @@ namespace Nektar
             /// Mapping from geometry ID of element to index inside #m_exp
             boost::unordered_map<int, int> m_elmtToExpId;
 
+            /// Bounding box search tree of the elements, built on demand by
+            /// GetExpIndex.
+            boost::shared_ptr<ElmtBoxTree> m_elmtBoxTree;
+
+            /// Find the elements whose bounding box contains a point.
+            void GetElmtCandidates(
+                const Array<OneD, const NekDouble> &gloCoords,
+                std::vector<int>                   &candidates);
+
             /// This function assembles the block diagonal matrix of local
             /// matrices of the type \a mtype.
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
@@ -1161,6 +1216,13 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            virtual void v_BeginFwdBwdTracePhys(
+                const Array<OneD,const NekDouble>  &field,
+                      Array<OneD,NekDouble> &Fwd,
+                      Array<OneD,NekDouble> &Bwd);
+
+            virtual void v_EndFwdBwdTracePhys();
+
             virtual const std::vector<bool> &v_GetLeftAdjacentFaces(void) const;
 
             virtual void v_ExtractTracePhys(
@@ -1184,6 +1246,13 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing,
                 const bool PhysSpaceForcing);
 
+            virtual void v_HelmSolveMultiple(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors);
+
             virtual void v_LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
                 const Array<OneD, const NekDouble> &inarray,
@@ -1232,6 +1301,13 @@ namespace Nektar
             virtual void v_BwdTrans_IterPerExp(
                 const Array<OneD,const NekDouble> &inarray,
                       Array<OneD,NekDouble> &outarray);
+
+            virtual void v_BwdTransPhysDeriv_IterPerExp(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray,
+                      Array<OneD,       NekDouble> &out_d0,
+                      Array<OneD,       NekDouble> &out_d1,
+                      Array<OneD,       NekDouble> &out_d2);
         
             virtual void v_FwdTrans(
                 const Array<OneD,const NekDouble> &inarray,
@@ -1707,6 +1783,20 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        inline void ExpList::BwdTransPhysDeriv_IterPerExp (
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray,
+                  Array<OneD,       NekDouble> &out_d0,
+                  Array<OneD,       NekDouble> &out_d1,
+                  Array<OneD,       NekDouble> &out_d2)
+        {
+            v_BwdTransPhysDeriv_IterPerExp(inarray,outarray,out_d0,out_d1,out_d2);
+        }
+
+
         /**
          *
          */
@@ -1736,6 +1826,22 @@ namespace Nektar
         }
 
 
+        /**
+         * Solve the Helmholtz problem for each of the given @p fields, which
+         * are expected to include this one. Where the fields share the same
+         * global system, the systems may be solved together.
+         */
+        inline void ExpList::HelmSolveMultiple(
+            const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const FlagList &flags,
+            const StdRegions::ConstFactorMap &factors)
+        {
+            v_HelmSolveMultiple(fields, inarray, outarray, flags, factors);
+        }
+
+
         /**
          *
          */
@@ -2188,6 +2294,7 @@ namespace Nektar
             Array<OneD,NekDouble> &Fwd,
             Array<OneD,NekDouble> &Bwd)
         {
+            LibUtilities::ProfileRegion region("GetFwdBwd");
             v_GetFwdBwdTracePhys(Fwd,Bwd);
         }
 
@@ -2196,9 +2303,25 @@ namespace Nektar
                   Array<OneD,NekDouble> &Fwd,
                   Array<OneD,NekDouble> &Bwd)
         {
+            LibUtilities::ProfileRegion region("GetFwdBwd");
             v_GetFwdBwdTracePhys(field,Fwd,Bwd);
         }
 
+        inline void ExpList::BeginFwdBwdTracePhys(
+            const Array<OneD,const NekDouble>  &field,
+                  Array<OneD,NekDouble> &Fwd,
+                  Array<OneD,NekDouble> &Bwd)
+        {
+            LibUtilities::ProfileRegion region("BeginFwdBwd");
+            v_BeginFwdBwdTracePhys(field,Fwd,Bwd);
+        }
+
+        inline void ExpList::EndFwdBwdTracePhys()
+        {
+            LibUtilities::ProfileRegion region("EndFwdBwd");
+            v_EndFwdBwdTracePhys();
+        }
+
         inline const std::vector<bool> &ExpList::GetLeftAdjacentFaces(void) const
         {
             return v_GetLeftAdjacentFaces();
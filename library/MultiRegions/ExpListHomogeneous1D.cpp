@@ -49,6 +49,8 @@ namespace Nektar
         // Forward declaration for typedefs
         ExpListHomogeneous1D::ExpListHomogeneous1D():
             ExpList(),
+            m_fusedFFT(false),
+            m_pipelinedTranspose(false),
             m_homogeneousBasis(LibUtilities::NullBasisSharedPtr),
             m_lhom(1),
             m_homogeneous1DBlockMat(MemoryManager<Homo1DBlockMatrixMap>::AllocateSharedPtr())
@@ -59,6 +61,8 @@ namespace Nektar
                 &pSession,const LibUtilities::BasisKey &HomoBasis, const NekDouble lhom, const bool useFFT, const bool dealiasing):
             ExpList(pSession),
             m_useFFT(useFFT),
+            m_fusedFFT(false),
+            m_pipelinedTranspose(false),
             m_lhom(lhom),
             m_homogeneous1DBlockMat(MemoryManager<Homo1DBlockMatrixMap>::AllocateSharedPtr()),
             m_dealiasing(dealiasing)
@@ -89,6 +93,11 @@ namespace Nektar
             m_transposition = MemoryManager<LibUtilities::Transposition>
                                 ::AllocateSharedPtr(HomoBasis, m_comm, m_StripZcomm);
 
+            // Overlap the transpositions of the dealiased products with
+            // computation if requested.
+            m_session->MatchSolverInfo("PipelinedTransposition", "True",
+                                       m_pipelinedTranspose, false);
+
             m_planes = Array<OneD,ExpListSharedPtr>(
                                 m_homogeneousBasis->GetNumPoints() /
                                 m_StripZcomm->GetSize());
@@ -97,6 +106,13 @@ namespace Nektar
             {
                 m_FFT = LibUtilities::GetNektarFFTFactory().CreateInstance(
                                 "NekFFTW", m_homogeneousBasis->GetNumPoints());
+
+                // If all planes are stored on this process, transform the
+                // lines of the plane ordering directly unless disabled.
+                bool disableFused;
+                m_session->MatchSolverInfo("FusedFFT", "False",
+                                           disableFused, false);
+                m_fusedFFT = !disableFused && m_StripZcomm->GetSize() == 1;
             }
 
             if(m_dealiasing)
@@ -127,6 +143,8 @@ namespace Nektar
             m_StripZcomm(In.m_StripZcomm),
             m_useFFT(In.m_useFFT),
             m_FFT(In.m_FFT),
+            m_fusedFFT(In.m_fusedFFT),
+            m_pipelinedTranspose(In.m_pipelinedTranspose),
             m_tmpIN(In.m_tmpIN),
             m_tmpOUT(In.m_tmpOUT),
             m_homogeneousBasis(In.m_homogeneousBasis),
@@ -144,6 +162,8 @@ namespace Nektar
             m_transposition(In.m_transposition),
             m_useFFT(In.m_useFFT),
             m_FFT(In.m_FFT),
+            m_fusedFFT(In.m_fusedFFT),
+            m_pipelinedTranspose(In.m_pipelinedTranspose),
             m_tmpIN(In.m_tmpIN),
             m_tmpOUT(In.m_tmpOUT),
             m_homogeneousBasis(In.m_homogeneousBasis),
@@ -225,51 +245,72 @@ namespace Nektar
             int num_dfts_per_proc    = num_points_per_plane / num_proc
                                         + (num_points_per_plane % num_proc > 0);
 
-            Array<OneD, NekDouble> ShufV1(num_dfts_per_proc*N,0.0);
-            Array<OneD, NekDouble> ShufV2(num_dfts_per_proc*N,0.0);
-            Array<OneD, NekDouble> ShufV1V2(num_dfts_per_proc*N,0.0);
-
-            Array<OneD, NekDouble> ShufV1_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1_PAD_phys(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV2_PAD_phys(m_padsize,0.0);
-
-            Array<OneD, NekDouble> ShufV1V2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble> ShufV1V2_PAD_phys(m_padsize,0.0);
+            // Layout of the pencils: either the plane ordering, or
+            // contiguous pencils after transposition.
+            int nLines  = m_fusedFFT ? num_points_per_plane : num_dfts_per_proc;
+            int stride  = m_fusedFFT ? num_points_per_plane : 1;
+            int padDist = m_fusedFFT ? 1                    : m_padsize;
+
+            Array<OneD, NekDouble> ShufV1V2(nLines*N,0.0);
+
+            Array<OneD, NekDouble> ShufV1_PAD_coef(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_coef(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1_PAD_phys(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_phys(nLines*m_padsize,0.0);
+
+            Array<OneD, NekDouble> ShufV1V2_PAD_coef(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1V2_PAD_phys(nLines*m_padsize,0.0);
+
+            Array<OneD, Array<OneD, NekDouble> > V(2);
+            Array<OneD, Array<OneD, NekDouble> > ShufV(2);
+            V[0] = V1;
+            V[1] = V2;
+            if (!m_fusedFFT)
+            {
+                ShufV[0] = Array<OneD, NekDouble>(nLines*N,0.0);
+                ShufV[1] = m_pipelinedTranspose ?
+                    Array<OneD, NekDouble>(nLines*N,0.0) : ShufV[0];
+            }
+
+            // Copying the pencils of lenght N into bigger pencils of lenght
+            // 1.5N and moving to physical space using the padded system.
+            // We are in Fourier space
+            LibUtilities::TranspositionRequestSharedPtr request;
+            PadComponent(nLines, 0, V, ShufV, request, ShufV1_PAD_coef);
+            m_FFT_deal->FFTBwdTransMany(nLines, stride, padDist,
+                                        ShufV1_PAD_coef, ShufV1_PAD_phys);
+            PadComponent(nLines, 1, V, ShufV, request, ShufV2_PAD_coef);
+            m_FFT_deal->FFTBwdTransMany(nLines, stride, padDist,
+                                        ShufV2_PAD_coef, ShufV2_PAD_phys);
+
+            // Perfroming the vectors multiplication in physical space on
+            // the padded system
+            Vmath::Vmul(nLines*m_padsize, ShufV1_PAD_phys,   1,
+                                          ShufV2_PAD_phys,   1,
+                                          ShufV1V2_PAD_phys, 1);
+
+            // Moving back the result (V1*V2)_phys in Fourier space, padded
+            // system
+            m_FFT_deal->FFTFwdTransMany(nLines, stride, padDist,
+                                        ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
+
+            // Copying the first part of the padded pencils in the full
+            // vector (Fourier space)
+            UnpadLines(nLines, ShufV1V2_PAD_coef, ShufV1V2);
 
-            m_transposition->Transpose(V1, ShufV1, false, LibUtilities::eXYtoZ);
-            m_transposition->Transpose(V2, ShufV2, false, LibUtilities::eXYtoZ);
-
-            // Looping on the pencils
-            for(int i = 0 ; i < num_dfts_per_proc ; i++)
+            // Moving the results to the output
+            if (m_fusedFFT)
             {
-                // Copying the i-th pencil pf lenght N into a bigger
-                // pencil of lenght 2N We are in Fourier space
-                Vmath::Vcopy(N, &(ShufV1[i*N]), 1, &(ShufV1_PAD_coef[0]), 1);
-                Vmath::Vcopy(N, &(ShufV2[i*N]), 1, &(ShufV2_PAD_coef[0]), 1);
-
-                // Moving to physical space using the padded system
-                m_FFT_deal->FFTBwdTrans(ShufV1_PAD_coef, ShufV1_PAD_phys);
-                m_FFT_deal->FFTBwdTrans(ShufV2_PAD_coef, ShufV2_PAD_phys);
-
-                // Perfroming the vectors multiplication in physical space on
-                // the padded system
-                Vmath::Vmul(m_padsize, ShufV1_PAD_phys,   1,
-                                       ShufV2_PAD_phys,   1,
-                                       ShufV1V2_PAD_phys, 1);
-
-                // Moving back the result (V1*V2)_phys in Fourier space, padded
-                // system
-                m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
-
-                // Copying the first half of the padded pencil in the full
-                // vector (Fourier space)
-                Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
-                                &(ShufV1V2[i*N]),        1);
+                if (m_WaveSpace)
+                {
+                    Vmath::Vcopy(num_dofs, ShufV1V2, 1, outarray, 1);
+                }
+                else
+                {
+                    HomogeneousBwdTrans(ShufV1V2, outarray, coeffstate);
+                }
             }
-
-            // Moving the results to the output
-            if (m_WaveSpace)
+            else if (m_WaveSpace)
             {
                 m_transposition->Transpose(ShufV1V2, outarray, false,
                                        LibUtilities::eZtoXY);
@@ -318,138 +359,225 @@ namespace Nektar
             int num_dfts_per_proc    = num_points_per_plane / num_proc
                                         + (num_points_per_plane % num_proc > 0);
 
-            // Get inputs in Fourier space
-            Array<OneD, Array<OneD, NekDouble> > V1(ndim);
-            Array<OneD, Array<OneD, NekDouble> > V2(ndim*nvec);
-            if(m_WaveSpace)
+            // Get inputs in Fourier space, the components of the first
+            // term followed by those of the second term
+            Array<OneD, Array<OneD, NekDouble> > V(ndim + ndim*nvec);
+            for (int i = 0; i < ndim + ndim*nvec; i++)
             {
-                for (int i = 0; i < ndim; i++)
+                const Array<OneD, NekDouble> &in =
+                    i < ndim ? inarray1[i] : inarray2[i-ndim];
+
+                if(m_WaveSpace)
                 {
-                    V1[i] = inarray1[i];
+                    V[i] = in;
                 }
-                for (int i = 0; i < ndim*nvec; i++)
+                else
                 {
-                    V2[i] = inarray2[i];
+                    V[i] = Array<OneD, NekDouble> (num_dofs);
+                    HomogeneousFwdTrans(in,V[i],coeffstate);
                 }
             }
-            else
+
+            // Layout of the pencils: either the plane ordering, or
+            // contiguous pencils after transposition.
+            int nLines  = m_fusedFFT ? num_points_per_plane : num_dfts_per_proc;
+            int stride  = m_fusedFFT ? num_points_per_plane : 1;
+            int padDist = m_fusedFFT ? 1                    : m_padsize;
+
+            // Allocate variables for ffts
+            Array<OneD, Array<OneD, NekDouble> > ShufV(2);
+            if (!m_fusedFFT)
             {
-                for (int i = 0; i < ndim; i++)
-                {
-                    V1[i] = Array<OneD, NekDouble> (num_dofs);
-                    HomogeneousFwdTrans(inarray1[i],V1[i],coeffstate);
-                }
-                for (int i = 0; i < ndim*nvec; i++)
-                {
-                    V2[i] = Array<OneD, NekDouble> (num_dofs);
-                    HomogeneousFwdTrans(inarray2[i],V2[i],coeffstate);
-                }
+                ShufV[0] = Array<OneD, NekDouble>(nLines*N,0.0);
+                ShufV[1] = m_pipelinedTranspose ?
+                    Array<OneD, NekDouble>(nLines*N,0.0) : ShufV[0];
             }
+            Array<OneD, NekDouble> ShufV1V2(nLines*N,0.0);
+            Array<OneD, NekDouble> ShufV_PAD_coef(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV2_PAD_phys(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1V2_PAD_coef(nLines*m_padsize,0.0);
+            Array<OneD, NekDouble> ShufV1V2_PAD_phys(nLines*m_padsize,0.0);
 
-            // Allocate variables for ffts
-            Array<OneD, Array<OneD, NekDouble> > ShufV1(ndim);
-            Array<OneD, NekDouble>               ShufV1_PAD_coef(m_padsize,0.0);
             Array<OneD, Array<OneD, NekDouble> > ShufV1_PAD_phys(ndim);
             for (int i = 0; i < ndim; i++)
             {
-                ShufV1[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
                 ShufV1_PAD_phys[i] = Array<OneD, NekDouble>
-                                     (m_padsize,0.0);
+                                     (nLines*m_padsize,0.0);
             }
 
-            Array<OneD, Array<OneD, NekDouble> > ShufV2(ndim*nvec);
-            Array<OneD, NekDouble>               ShufV2_PAD_coef(m_padsize,0.0);
-            Array<OneD, Array<OneD, NekDouble> > ShufV2_PAD_phys(ndim*nvec);
-            for (int i = 0; i < ndim*nvec; i++)
+            // Moving the first term to physical space using the padded
+            // system
+            LibUtilities::TranspositionRequestSharedPtr request;
+            for (int i = 0; i < ndim; i++)
             {
-                ShufV2[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
-                ShufV2_PAD_phys[i] = Array<OneD, NekDouble>
-                                     (m_padsize,0.0);
+                PadComponent(nLines, i, V, ShufV, request, ShufV_PAD_coef);
+                m_FFT_deal->FFTBwdTransMany(nLines, stride, padDist,
+                                            ShufV_PAD_coef,
+                                            ShufV1_PAD_phys[i]);
             }
 
-            Array<OneD, Array<OneD, NekDouble> > ShufV1V2(nvec);
-            Array<OneD, NekDouble>               ShufV1V2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble>               ShufV1V2_PAD_phys(m_padsize,0.0);
-            for (int i = 0; i < nvec; i++)
+            Array<OneD, NekDouble> V1V2(num_dofs);
+            for (int j = 0; j < nvec; j++)
             {
-                ShufV1V2[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
+                // Performing the vectors multiplication in physical space on
+                // the padded system, moving each component of the second
+                // term to physical space in turn
+                Vmath::Zero(nLines*m_padsize, ShufV1V2_PAD_phys, 1);
+                for (int k = 0; k < ndim; k++)
+                {
+                    PadComponent(nLines, ndim + j*ndim + k, V, ShufV,
+                                 request, ShufV_PAD_coef);
+                    m_FFT_deal->FFTBwdTransMany(nLines, stride, padDist,
+                                                ShufV_PAD_coef,
+                                                ShufV2_PAD_phys);
+
+                    Vmath::Vvtvp(nLines*m_padsize,
+                                 ShufV1_PAD_phys[k], 1,
+                                 ShufV2_PAD_phys,    1,
+                                 ShufV1V2_PAD_phys,  1,
+                                 ShufV1V2_PAD_phys,  1);
+                }
+
+                // Moving back the result (V1*V2)_phys in Fourier space,
+                // padded system
+                m_FFT_deal->FFTFwdTransMany(nLines, stride, padDist,
+                                            ShufV1V2_PAD_phys,
+                                            ShufV1V2_PAD_coef);
+
+                // Copying the first part of the padded pencils in the full
+                // vector (Fourier space)
+                UnpadLines(nLines, ShufV1V2_PAD_coef, ShufV1V2);
+
+                // Moving the results to the output
+                if (m_fusedFFT)
+                {
+                    if (m_WaveSpace)
+                    {
+                        Vmath::Vcopy(num_dofs, ShufV1V2, 1, outarray[j], 1);
+                    }
+                    else
+                    {
+                        HomogeneousBwdTrans(ShufV1V2, outarray[j],
+                                            coeffstate);
+                    }
+                }
+                else if (m_WaveSpace)
+                {
+                    m_transposition->Transpose(ShufV1V2, outarray[j],
+                                               false,
+                                               LibUtilities::eZtoXY);
+                }
+                else
+                {
+                    m_transposition->Transpose(ShufV1V2, V1V2, false,
+                                               LibUtilities::eZtoXY);
+                    HomogeneousBwdTrans(V1V2, outarray[j], coeffstate);
+                }
             }
+        }
 
-            // Transpose inputs
-            for (int i = 0; i < ndim; i++)
+        /**
+         * Copy each pencil of length N in @p inarray into the first N entries
+         * of the corresponding pencil of length #m_padsize in @p outarray.
+         * The remaining entries of @p outarray are left untouched, and so
+         * should be zero.
+         */
+        void ExpListHomogeneous1D::PadLines(
+            const int                           nLines,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            int N = m_homogeneousBasis->GetNumPoints();
+
+            if (m_fusedFFT)
             {
-                m_transposition->Transpose(V1[i], ShufV1[i], false,
-                                           LibUtilities::eXYtoZ);
+                // In the plane ordering the padded pencils are extra planes.
+                Vmath::Vcopy(nLines*N, &inarray[0], 1, &outarray[0], 1);
             }
-            for (int i = 0; i < ndim*nvec; i++)
+            else
             {
-                m_transposition->Transpose(V2[i], ShufV2[i], false,
-                                           LibUtilities::eXYtoZ);
+                for (int i = 0; i < nLines; i++)
+                {
+                    Vmath::Vcopy(N, &inarray[i*N],          1,
+                                    &outarray[i*m_padsize], 1);
+                }
             }
+        }
 
-            // Looping on the pencils
-            for(int i = 0 ; i < num_dfts_per_proc ; i++)
+        /**
+         * Copy the first N entries of each pencil of length #m_padsize in
+         * @p inarray into the corresponding pencil of length N of @p outarray.
+         */
+        void ExpListHomogeneous1D::UnpadLines(
+            const int                           nLines,
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            int N = m_homogeneousBasis->GetNumPoints();
+
+            if (m_fusedFFT)
             {
-                for (int j = 0; j < ndim; j++)
-                {
-                    // Copying the i-th pencil pf lenght N into a bigger
-                    // pencil of lenght 1.5N We are in Fourier space
-                    Vmath::Vcopy(N, &(ShufV1[j][i*N]), 1,
-                                    &(ShufV1_PAD_coef[0]), 1);
-                    // Moving to physical space using the padded system
-                    m_FFT_deal->FFTBwdTrans(ShufV1_PAD_coef, ShufV1_PAD_phys[j]);
-                }
-                for (int j = 0; j < ndim*nvec; j++)
+                Vmath::Vcopy(nLines*N, &inarray[0], 1, &outarray[0], 1);
+            }
+            else
+            {
+                for (int i = 0; i < nLines; i++)
                 {
-                    Vmath::Vcopy(N, &(ShufV2[j][i*N]), 1,
-                                    &(ShufV2_PAD_coef[0]), 1);
-                    m_FFT_deal->FFTBwdTrans(ShufV2_PAD_coef, ShufV2_PAD_phys[j]);
+                    Vmath::Vcopy(N, &inarray[i*m_padsize], 1,
+                                    &outarray[i*N],         1);
                 }
+            }
+        }
 
-                // Performing the vectors multiplication in physical space on
-                // the padded system
-                for (int j = 0; j < nvec; j++)
+        /**
+         * Copy component @p c of @p inarray into the padded pencils of
+         * @p outarray, transposing it first unless the FFTs are applied to
+         * the plane ordering. The components must be requested in order.
+         *
+         * With pipelined transposition, the transposition of component c+1
+         * into the other buffer of @p shuf is started before component c is
+         * padded, so that its communication overlaps with the padding and
+         * transforms of component c. @p request holds the transposition in
+         * progress between calls.
+         */
+        void ExpListHomogeneous1D::PadComponent(
+            const int                                   nLines,
+            const int                                   c,
+            const Array<OneD, Array<OneD, NekDouble> > &inarray,
+                  Array<OneD, Array<OneD, NekDouble> > &shuf,
+                  LibUtilities::TranspositionRequestSharedPtr &request,
+                  Array<OneD,       NekDouble> &outarray)
+        {
+            if (m_fusedFFT)
+            {
+                PadLines(nLines, inarray[c], outarray);
+            }
+            else if (m_pipelinedTranspose)
+            {
+                int nComp = inarray.num_elements();
+
+                if (!request)
                 {
-                    Vmath::Zero(m_padsize, ShufV1V2_PAD_phys, 1);
-                    for (int k = 0; k < ndim; k++)
-                    {
-                        Vmath::Vvtvp(m_padsize, ShufV1_PAD_phys[k], 1,
-                                                ShufV2_PAD_phys[j*ndim+k], 1,
-                                                ShufV1V2_PAD_phys, 1,
-                                                ShufV1V2_PAD_phys, 1);
-                    }
-                    // Moving back the result (V1*V2)_phys in Fourier space,
-                    // padded system
-                    m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
-                    // Copying the first half of the padded pencil in the full
-                    // vector (Fourier space)
-                    Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
-                                    &(ShufV1V2[j][i*N]),     1);
+                    request = m_transposition->BeginTranspose(
+                        inarray[c], shuf[c % 2], false, LibUtilities::eXYtoZ);
                 }
-            }
+                m_transposition->EndTranspose(request);
+                request.reset();
 
-            // Moving the results to the output
-            if (m_WaveSpace)
-            {
-                for (int j = 0; j < nvec; j++)
+                if (c + 1 < nComp)
                 {
-                    m_transposition->Transpose(ShufV1V2[j], outarray[j],
-                                           false,
-                                           LibUtilities::eZtoXY);
+                    request = m_transposition->BeginTranspose(
+                        inarray[c+1], shuf[(c+1) % 2], false,
+                        LibUtilities::eXYtoZ);
                 }
+
+                PadLines(nLines, shuf[c % 2], outarray);
             }
             else
             {
-                Array<OneD, NekDouble> V1V2(num_dofs);
-                for (int j = 0; j < nvec; j++)
-                {
-                    m_transposition->Transpose(ShufV1V2[j], V1V2, false,
-                                       LibUtilities::eZtoXY);
-                    HomogeneousBwdTrans(V1V2, outarray[j], coeffstate);
-                }
+                m_transposition->Transpose(inarray[c], shuf[0], false,
+                                           LibUtilities::eXYtoZ);
+                PadLines(nLines, shuf[0], outarray);
             }
         }
 
@@ -537,6 +665,21 @@ namespace Nektar
                 HomogeneousBwdTrans(outarray,outarray);
             }
         }
+
+        /**
+         * The homogeneous directions require the full field, so the
+         * transform and derivative are evaluated in turn.
+         */
+        void ExpListHomogeneous1D::v_BwdTransPhysDeriv_IterPerExp(
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray,
+                  Array<OneD,       NekDouble> &out_d0,
+                  Array<OneD,       NekDouble> &out_d1,
+                  Array<OneD,       NekDouble> &out_d2)
+        {
+            v_BwdTrans_IterPerExp(inarray, outarray);
+            v_PhysDeriv(outarray, out_d0, out_d1, out_d2);
+        }
         
         /**
          * Inner product
@@ -614,7 +757,28 @@ namespace Nektar
             
             if(m_useFFT)
             {        
+                int N = m_homogeneousBasis->GetNumPoints();
                 int num_points_per_plane = num_dofs/m_planes.num_elements();
+
+                // All planes are local: transform the lines of the plane
+                // ordering directly, skipping the transpositions.
+                if(m_fusedFFT && Shuff && UnShuff)
+                {
+                    if(IsForwards)
+                    {
+                        m_FFT->FFTFwdTransMany(num_points_per_plane,
+                                               num_points_per_plane, 1,
+                                               inarray, outarray);
+                    }
+                    else
+                    {
+                        m_FFT->FFTBwdTransMany(num_points_per_plane,
+                                               num_points_per_plane, 1,
+                                               inarray, outarray);
+                    }
+                    return;
+                }
+
                 int num_dfts_per_proc;
                 if(!m_session->DefinesSolverInfo("HomoStrip"))
                 {
@@ -629,8 +793,8 @@ namespace Nektar
                                       + (num_points_per_plane % nP > 0);
                 }
 
-                Array<OneD, NekDouble> fft_in (num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),0.0);
-                Array<OneD, NekDouble> fft_out(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),0.0);
+                Array<OneD, NekDouble> fft_in (num_dfts_per_proc*N,0.0);
+                Array<OneD, NekDouble> fft_out(num_dfts_per_proc*N,0.0);
         
                 if(Shuff)
                 {
@@ -638,23 +802,20 @@ namespace Nektar
                 }
                 else 
                 {
-                    Vmath::Vcopy(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),
+                    Vmath::Vcopy(num_dfts_per_proc*N,
                                  inarray,1,fft_in,1);
                 }
                 
+                // Transform all pencils of the transposed block at once
                 if(IsForwards)
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTFwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTFwdTransMany(num_dfts_per_proc, 1, N,
+                                           fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTBwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTBwdTransMany(num_dfts_per_proc, 1, N,
+                                           fft_in, fft_out);
                 }
         
                 if(UnShuff)
@@ -663,7 +824,7 @@ namespace Nektar
                 }
                 else 
                 {
-                    Vmath::Vcopy(num_dfts_per_proc*m_homogeneousBasis->GetNumPoints(),
+                    Vmath::Vcopy(num_dfts_per_proc*N,
                                  fft_out,1,outarray,1);
                 }
             }
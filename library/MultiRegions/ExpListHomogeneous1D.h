@@ -141,6 +141,14 @@ namespace Nektar
 
             LibUtilities::NektarFFTSharedPtr        m_FFT_deal;
 
+            /// Apply the FFTs directly to lines of the plane ordering when
+            /// all planes are stored locally, skipping the transposition.
+            bool                                    m_fusedFFT;
+
+            /// Overlap the transposition of each field in the dealiased
+            /// products with the transforms of the previous one.
+            bool                                    m_pipelinedTranspose;
+
             Array<OneD,NekDouble>                   m_tmpIN;
             Array<OneD,NekDouble>                   m_tmpOUT;
             
@@ -200,6 +208,13 @@ namespace Nektar
             
             virtual void v_BwdTrans_IterPerExp(const Array<OneD,const NekDouble> &inarray,
                                                Array<OneD,      NekDouble> &outarray);
+
+            virtual void v_BwdTransPhysDeriv_IterPerExp(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray,
+                      Array<OneD,       NekDouble> &out_d0,
+                      Array<OneD,       NekDouble> &out_d1,
+                      Array<OneD,       NekDouble> &out_d2);
             
             virtual void v_IProductWRTBase(const Array<OneD, const NekDouble> &inarray, 
                                            Array<OneD, NekDouble> &outarray, 
@@ -278,6 +293,22 @@ namespace Nektar
             bool m_dealiasing;
             int m_padsize;
 
+            void PadLines(const int                           nLines,
+                          const Array<OneD, const NekDouble> &inarray,
+                                Array<OneD,       NekDouble> &outarray);
+
+            void UnpadLines(const int                           nLines,
+                            const Array<OneD, const NekDouble> &inarray,
+                                  Array<OneD,       NekDouble> &outarray);
+
+            void PadComponent(
+                const int                                   nLines,
+                const int                                   c,
+                const Array<OneD, Array<OneD, NekDouble> > &inarray,
+                      Array<OneD, Array<OneD, NekDouble> > &shuf,
+                      LibUtilities::TranspositionRequestSharedPtr &request,
+                      Array<OneD,       NekDouble> &outarray);
+
             /// Spectral vanishing Viscosity coefficient for stabilisation 
             Array<OneD, NekDouble> m_specVanVisc;
         };
@@ -373,6 +373,21 @@ namespace Nektar
             }
         }
 
+        /**
+         * The homogeneous directions require the full field, so the
+         * transform and derivative are evaluated in turn.
+         */
+        void ExpListHomogeneous2D::v_BwdTransPhysDeriv_IterPerExp(
+            const Array<OneD, const NekDouble> &inarray,
+                  Array<OneD,       NekDouble> &outarray,
+                  Array<OneD,       NekDouble> &out_d0,
+                  Array<OneD,       NekDouble> &out_d1,
+                  Array<OneD,       NekDouble> &out_d2)
+        {
+            v_BwdTrans_IterPerExp(inarray, outarray);
+            v_PhysDeriv(outarray, out_d0, out_d1, out_d2);
+        }
+
 
         void ExpListHomogeneous2D::v_IProductWRTBase(const Array<OneD, const NekDouble> &inarray, Array<OneD, NekDouble> &outarray,  CoeffState coeffstate)
         {
@@ -424,6 +424,40 @@ namespace Nektar
             vExp->DropLocStaticCondMatrix(matkey);
         }
 
+        /**
+         * Solve the system for each right-hand side in turn. Derived classes
+         * override this to share work and communication between the
+         * right-hand sides.
+         */
+        void GlobalLinSys::v_SolveMultiple(
+            const Array<OneD, Array<OneD, const NekDouble> > &in,
+                  Array<OneD, Array<OneD,       NekDouble> > &out,
+            const AssemblyMapSharedPtr                       &locToGloMap,
+            const Array<OneD, Array<OneD, const NekDouble> > &dirForcing)
+        {
+            for (int i = 0; i < in.num_elements(); ++i)
+            {
+                v_Solve(in[i], out[i], locToGloMap, dirForcing[i]);
+            }
+        }
+
+        /**
+         * Solve the matrix system for each right-hand side in turn.
+         */
+        void GlobalLinSys::v_SolveLinearSystemMultiple(
+            const int                                         pNumRows,
+            const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                  Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr                       &locToGloMap,
+            const int                                         pNumDir)
+        {
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                v_SolveLinearSystem(pNumRows, pInput[i], pOutput[i],
+                                    locToGloMap, pNumDir);
+            }
+        }
+
         void GlobalLinSys::v_InitObject()
         {
             NEKERROR(ErrorUtil::efatal, "Method does not exist" );
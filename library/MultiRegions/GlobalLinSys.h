@@ -37,6 +37,7 @@
 
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <MultiRegions/GlobalLinSysKey.h>
 #include <boost/enable_shared_from_this.hpp>
 #include <MultiRegions/ExpList.h>
@@ -103,6 +104,14 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides, which
+            /// share the same matrix, at the same time.
+            MULTI_REGIONS_EXPORT
+            inline void SolveMultiple(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             /// Returns a shared pointer to the current object.
             boost::shared_ptr<GlobalLinSys> GetSharedThisPtr()
             {
@@ -122,6 +131,14 @@ namespace Nektar
                 const AssemblyMapSharedPtr        &locToGloMap,
                 const int                          pNumDir = 0);
 
+            /// Solve the linear system for several input and output vectors.
+            inline void SolveLinearSystemMultiple(
+                const int                                         pNumRows,
+                const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                      Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const int                                         pNumDir = 0);
+
         protected:
             /// Key associated with this linear system.
             const GlobalLinSysKey                m_linSysKey;
@@ -156,6 +173,21 @@ namespace Nektar
                 const AssemblyMapSharedPtr        &locToGloMap,
                 const int                          pNumDir) = 0;
 
+            /// Solve a linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const Array<OneD, Array<OneD, const NekDouble> > &dirForcing);
+
+            /// Solve a basic matrix system for several right-hand sides.
+            virtual void v_SolveLinearSystemMultiple(
+                const int                                         pNumRows,
+                const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                      Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const int                                         pNumDir);
+
             virtual void v_InitObject();
             virtual void v_Initialise(
                 const boost::shared_ptr<AssemblyMap>& pLocToGloMap);
@@ -191,10 +223,27 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const Array<OneD, const NekDouble> &dirForcing)
         {
+            LibUtilities::ProfileRegion region("GlobalLinSys");
             v_Solve(in,out,locToGloMap,dirForcing);
         }
 
 
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveMultiple(
+                    const Array<OneD, Array<OneD, const NekDouble> > &in,
+                          Array<OneD, Array<OneD,       NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap)
+        {
+            Array<OneD, Array<OneD, const NekDouble> > dirForcing(
+                in.num_elements(), NullNekDouble1DArray);
+
+            LibUtilities::ProfileRegion region("GlobalLinSys");
+            v_SolveMultiple(in,out,locToGloMap,dirForcing);
+        }
+
+
         /**
          *
          */
@@ -208,6 +257,21 @@ namespace Nektar
             v_SolveLinearSystem(pNumRows, pInput, pOutput, locToGloMap, pNumDir);
         }
 
+
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                      Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &locToGloMap,
+                const int pNumDir)
+        {
+            v_SolveLinearSystemMultiple(pNumRows, pInput, pOutput,
+                                        locToGloMap, pNumDir);
+        }
+
         inline void GlobalLinSys::InitObject()
         {
             v_InitObject();
@@ -79,5 +79,37 @@ namespace Nektar
 
             m_linSys->Solve(Vin, Vout);
         }
+
+        /**
+         * Solve the linear system for several right-hand sides. These are
+         * gathered into a single column-major array so that the factorised
+         * matrix is applied to all of them in one call.
+         */
+        void GlobalLinSysDirect::v_SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                      Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &pLocToGloMap,
+                const int pNumDir)
+        {
+            const int nHomDofs = pNumRows - pNumDir;
+            const int nRhs     = pInput.num_elements();
+
+            Array<OneD, NekDouble> x(nHomDofs*nRhs);
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                Vmath::Vcopy(nHomDofs, &pInput[i][pNumDir], 1,
+                                       &x[i*nHomDofs],      1);
+            }
+
+            m_linSys->SolveMultiple(nRhs, x);
+
+            for (int i = 0; i < nRhs; ++i)
+            {
+                Vmath::Vcopy(nHomDofs, &x[i*nHomDofs],       1,
+                                       &pOutput[i][pNumDir], 1);
+            }
+        }
     }
 }
@@ -66,6 +66,13 @@ namespace Nektar
                       Array<OneD,      NekDouble> &pOutput,
                 const AssemblyMapSharedPtr &locToGloMap,
                 const int pNumDir);
+            /// Solve the linear system for several right-hand sides.
+            virtual void v_SolveLinearSystemMultiple(
+                const int pNumRows,
+                const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                      Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &locToGloMap,
+                const int pNumDir);
         };
     }
 }
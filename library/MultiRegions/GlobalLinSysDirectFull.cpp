@@ -112,41 +112,78 @@ namespace Nektar
                     const AssemblyMapSharedPtr &pLocToGloMap,
                     const Array<OneD, const NekDouble>  &pDirForcing)
         {
-            bool dirForcCalculated = (bool) pDirForcing.num_elements();
+            Array<OneD, Array<OneD, const NekDouble> > vIn (1, pInput);
+            Array<OneD, Array<OneD, const NekDouble> > vDir(1, pDirForcing);
+            Array<OneD, Array<OneD,       NekDouble> > vOut(1, pOutput);
+
+            v_SolveMultiple(vIn, vOut, pLocToGloMap, vDir);
+        }
+
+
+        /**
+         * Solve the linear system for several right-hand sides using a full
+         * global matrix system. The factorised matrix is applied to all
+         * right-hand sides in a single call.
+         */
+        void GlobalLinSysDirectFull::v_SolveMultiple(
+            const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                  Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr                       &pLocToGloMap,
+            const Array<OneD, Array<OneD, const NekDouble> > &pDirForcing)
+        {
+            int nRhs      = pInput.num_elements();
             int nDirDofs  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
             int nGlobDofs = pLocToGloMap->GetNumGlobalCoeffs();
-            Array<OneD, NekDouble> tmp(nGlobDofs);
-            
+
             if(nDirDofs)
             {
-                // calculate the dirichlet forcing
-                if(dirForcCalculated)
+                Array<OneD, Array<OneD, const NekDouble> > rhs(nRhs);
+                Array<OneD, Array<OneD,       NekDouble> > out(nRhs);
+
+                for (int i = 0; i < nRhs; ++i)
                 {
-                    Vmath::Vsub(nGlobDofs,
-                                pInput.get(),      1,
-                                pDirForcing.get(), 1,
-                                tmp.get(),         1);
+                    Array<OneD, NekDouble> tmp(nGlobDofs);
+
+                    // calculate the dirichlet forcing
+                    if(pDirForcing[i].num_elements())
+                    {
+                        Vmath::Vsub(nGlobDofs,
+                                    pInput[i].get(),      1,
+                                    pDirForcing[i].get(), 1,
+                                    tmp.get(),            1);
+                    }
+                    else
+                    {
+                        // Calculate Dirichlet forcing and subtract it from
+                        // the rhs
+                        m_expList.lock()->GeneralMatrixOp(
+                            m_linSysKey, pOutput[i], tmp, eGlobal);
+
+                        Vmath::Vsub(nGlobDofs,
+                                    pInput[i].get(), 1,
+                                    tmp.get(),       1,
+                                    tmp.get(),       1);
+                    }
+
+                    rhs[i] = tmp;
+                    out[i] = Array<OneD, NekDouble>(nGlobDofs,0.0);
                 }
-                else
+
+                SolveLinearSystemMultiple(
+                    nGlobDofs, rhs, out, pLocToGloMap, nDirDofs);
+
+                for (int i = 0; i < nRhs; ++i)
                 {
-                    // Calculate Dirichlet forcing and subtract it from the rhs
-                    m_expList.lock()->GeneralMatrixOp(
-                        m_linSysKey, pOutput, tmp, eGlobal);
-                    
-                    Vmath::Vsub(nGlobDofs, 
-                                pInput.get(), 1,
-                                tmp.get(),    1,
-                                tmp.get(),    1);
+                    Vmath::Vadd(nGlobDofs-nDirDofs,
+                                &out[i]    [nDirDofs], 1,
+                                &pOutput[i][nDirDofs], 1,
+                                &pOutput[i][nDirDofs], 1);
                 }
-
-                Array<OneD, NekDouble> out(nGlobDofs,0.0);
-                SolveLinearSystem(nGlobDofs, tmp, out, pLocToGloMap, nDirDofs);
-                Vmath::Vadd(nGlobDofs-nDirDofs,    &out    [nDirDofs], 1,
-                            &pOutput[nDirDofs], 1, &pOutput[nDirDofs], 1);
             }
             else
             {
-                SolveLinearSystem(nGlobDofs, pInput, pOutput, pLocToGloMap, nDirDofs);
+                SolveLinearSystemMultiple(
+                    nGlobDofs, pInput, pOutput, pLocToGloMap, nDirDofs);
             }
         }
 
@@ -81,6 +81,13 @@ namespace Nektar
                         const Array<OneD, const NekDouble> &dirForcing
                                                         = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const Array<OneD, Array<OneD, const NekDouble> > &dirForcing);
+
             void AssembleFullMatrix(const boost::shared_ptr<AssemblyMap>& locToGloMap);
             //void AssembleFullMatrixDG(const boost::shared_ptr<AssemblyMapDG>& locToGloMap);
         };
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/GlobalLinSysIterative.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 using namespace std;
 
@@ -41,6 +42,17 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string GlobalLinSysIterative::lookupIds[2] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeSolver", "ConjugateGradient", eConjugateGradient),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeSolver", "PipelinedConjugateGradient",
+                ePipelinedConjugateGradient)
+        };
+        std::string GlobalLinSysIterative::def =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "IterativeSolver", "ConjugateGradient");
+
         /**
          * @class GlobalLinSysIterative
          *
@@ -63,6 +75,7 @@ namespace Nektar
         {
             m_tolerance = pLocToGloMap->GetIterativeTolerance();
             m_maxiter   = pLocToGloMap->GetMaxIterations();
+            m_solverType = pLocToGloMap->GetIterativeSolverType();
 
             LibUtilities::CommSharedPtr vComm = m_expList.lock()->GetComm()->GetRowComm();
             m_root    = (vComm->GetRank())? false : true;
@@ -107,6 +120,51 @@ namespace Nektar
         }
 
 
+        /**
+         * Solve the matrix system for several right-hand sides. Unless
+         * previous solutions are used to construct the initial guess, or the
+         * pipelined method has been selected, the systems are solved
+         * simultaneously using DoBlockConjugateGradient.
+         */
+        void GlobalLinSysIterative::v_SolveLinearSystemMultiple(
+                    const int nGlobal,
+                    const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                          Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            if (pInput.num_elements() == 1 || m_useProjection ||
+                m_solverType == ePipelinedConjugateGradient)
+            {
+                for (int i = 0; i < pInput.num_elements(); ++i)
+                {
+                    v_SolveLinearSystem(nGlobal, pInput[i], pOutput[i],
+                                        plocToGloMap, nDir);
+                }
+            }
+            else
+            {
+                DoBlockConjugateGradient(nGlobal, pInput, pOutput,
+                                         plocToGloMap, nDir);
+            }
+        }
+
+        /**
+         * Perform the matrix-vector multiply for each of several vectors in
+         * turn. Derived classes may override this to apply the operator to
+         * all vectors at once.
+         */
+        void GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            for (int i = 0; i < pInput.num_elements(); ++i)
+            {
+                v_DoMatrixMultiply(pInput[i], pOutput[i]);
+            }
+        }
+
+
         /**
          * This method implements A-conjugate projection technique
          * in order to speed up successive linear solves with
@@ -359,6 +417,8 @@ namespace Nektar
             const AssemblyMapSharedPtr        &plocToGloMap,
             const int                          nDir)
         {
+            LibUtilities::ProfileRegion region("ConjugateGradient");
+
             if (!m_precon)
             {
                 v_UniqueMap();
@@ -366,6 +426,12 @@ namespace Nektar
                 m_precon->BuildPreconditioner();
             }
 
+            if (m_solverType == ePipelinedConjugateGradient)
+            {
+                DoPipelinedConjugateGradient(nGlobal, pInput, pOutput, nDir);
+                return;
+            }
+
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
                 = m_expList.lock()->GetComm()->GetRowComm();
@@ -462,6 +528,8 @@ namespace Nektar
             // Continue until convergence
             while (true)
             {
+                LibUtilities::ProfileRegion iteration("Iteration");
+
                 if(k >= m_maxiter)
                 {
                     if (m_root)
@@ -540,6 +608,428 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve several global linear systems, which share the same matrix,
+         * using the preconditioned conjugate gradient method of
+         * DoConjugateGradient. Each system follows its own conjugate
+         * gradient recurrence, but the matrix-vector multiplies of all
+         * systems are performed together through v_DoMatrixMultiplyMultiple
+         * and the inner products of all systems are exchanged in a single
+         * reduction per iteration. Systems which have converged are not
+         * updated further. If no right-hand side magnitude has been set, for
+         * instance below the top level of multi-level static condensation,
+         * the tolerance of each system is relative to the magnitude of its
+         * own right-hand side.
+         *
+         * @param       pInput      Input residuals of all DOFs.
+         * @param       pOutput     Solution vectors of all DOFs.
+         */
+        void GlobalLinSysIterative::DoBlockConjugateGradient(
+            const int                                         nGlobal,
+            const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                  Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr                       &plocToGloMap,
+            const int                                         nDir)
+        {
+            LibUtilities::ProfileRegion region("BlockConjugateGradient");
+
+            if (!m_precon)
+            {
+                v_UniqueMap();
+                m_precon = CreatePrecon(plocToGloMap);
+                m_precon->BuildPreconditioner();
+            }
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+            int nRhs    = pInput.num_elements();
+
+            // Allocate array storage
+            Array<OneD, Array<OneD, NekDouble> > w_A(nRhs), s_A(nRhs);
+            Array<OneD, Array<OneD, NekDouble> > p_A(nRhs), r_A(nRhs);
+            Array<OneD, Array<OneD, NekDouble> > q_A(nRhs);
+            Array<OneD, NekDouble> tmp;
+
+            Array<OneD, NekDouble> alpha(nRhs), beta(nRhs, 0.0), rho(nRhs);
+            Array<OneD, NekDouble> mu(nRhs), eps(nRhs);
+            Array<OneD, NekDouble> rhsMag(nRhs, m_rhs_magnitude);
+            Array<OneD, NekDouble> vExchange(3*nRhs, 0.0);
+            Array<OneD, int>       nIter(nRhs, 0);
+            Array<OneD, bool>      active(nRhs, true);
+
+            int i, j, k, nActive = 0;
+            bool setMag = m_rhs_magnitude == NekConstants::kNekUnsetDouble;
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                w_A[i] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                s_A[i] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                p_A[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                r_A[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                q_A[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+
+                // Copy initial residual from input
+                Vmath::Vcopy(nNonDir, &pInput[i][nDir], 1, &r_A[i][0], 1);
+            }
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                // zero homogeneous out array ready for solution updates
+                // Should not be earlier in case input vector is same as
+                // output and above copy has been peformed
+                Vmath::Zero(nNonDir, tmp = pOutput[i] + nDir, 1);
+
+                // evaluate initial residual error for exit check
+                vExchange[i] = Vmath::Dot2(nNonDir,
+                                           r_A[i],
+                                           r_A[i],
+                                           m_map + nDir);
+
+                // and the magnitude of the right-hand side if required
+                if (setMag && m_map.num_elements() > 0)
+                {
+                    vExchange[nRhs+i] = Vmath::Dot2(nGlobal,
+                                                    &pInput[i][0],
+                                                    &pInput[i][0],
+                                                    &m_map[0]);
+                }
+            }
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            if (setMag)
+            {
+                // As in Set_Rhs_Magnitude, avoid using a vanishing
+                // right-hand side to scale the tolerance.
+                for (i = 0; i < nRhs; ++i)
+                {
+                    rhsMag[i] = vExchange[nRhs+i] > 1e-6 ?
+                                vExchange[nRhs+i] : 1.0;
+                }
+                m_rhs_magnitude = rhsMag[0];
+            }
+
+            m_totalIterations = 0;
+
+            // If input residual is less than tolerance skip solve.
+            for (i = 0; i < nRhs; ++i)
+            {
+                eps[i] = vExchange[i];
+
+                if (eps[i] < m_tolerance * m_tolerance * rhsMag[i])
+                {
+                    active[i] = false;
+                }
+                else
+                {
+                    nActive++;
+                }
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > wAct, sAct;
+
+            while (nActive > 0)
+            {
+                LibUtilities::ProfileRegion iteration("Iteration");
+
+                // Gather the systems which are still being solved
+                wAct = Array<OneD, Array<OneD, NekDouble> >(nActive);
+                sAct = Array<OneD, Array<OneD, NekDouble> >(nActive);
+                for (i = j = 0; i < nRhs; ++i)
+                {
+                    if (!active[i])
+                    {
+                        continue;
+                    }
+
+                    if (nIter[i] > 0)
+                    {
+                        // Compute new search direction p_k, q_k
+                        Vmath::Svtvp(nNonDir, beta[i], &p_A[i][0], 1,
+                                     &w_A[i][nDir], 1, &p_A[i][0], 1);
+                        Vmath::Svtvp(nNonDir, beta[i], &q_A[i][0], 1,
+                                     &s_A[i][nDir], 1, &q_A[i][0], 1);
+
+                        // Update solution x_{k+1}
+                        Vmath::Svtvp(nNonDir, alpha[i], &p_A[i][0], 1,
+                                     &pOutput[i][nDir], 1,
+                                     &pOutput[i][nDir], 1);
+
+                        // Update residual vector r_{k+1}
+                        Vmath::Svtvp(nNonDir, -alpha[i], &q_A[i][0], 1,
+                                     &r_A[i][0], 1, &r_A[i][0], 1);
+                    }
+
+                    // Apply preconditioner
+                    m_precon->DoPreconditioner(r_A[i], tmp = w_A[i] + nDir);
+
+                    wAct[j]   = w_A[i];
+                    sAct[j++] = s_A[i];
+                }
+
+                // Perform the method-specific matrix-vector multiply
+                // operation for all active systems.
+                v_DoMatrixMultiplyMultiple(wAct, sAct);
+
+                Vmath::Zero(3*nRhs, vExchange, 1);
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (!active[i])
+                    {
+                        continue;
+                    }
+
+                    // <r_{k+1}, w_{k+1}>
+                    vExchange[3*i]   = Vmath::Dot2(nNonDir,
+                                                   r_A[i],
+                                                   w_A[i] + nDir,
+                                                   m_map + nDir);
+                    // <s_{k+1}, w_{k+1}>
+                    vExchange[3*i+1] = Vmath::Dot2(nNonDir,
+                                                   s_A[i] + nDir,
+                                                   w_A[i] + nDir,
+                                                   m_map + nDir);
+                    // <r_{k+1}, r_{k+1}>
+                    vExchange[3*i+2] = Vmath::Dot2(nNonDir,
+                                                   r_A[i],
+                                                   r_A[i],
+                                                   m_map + nDir);
+                }
+
+                // Perform inner-product exchanges of all systems together
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                for (i = 0; i < nRhs; ++i)
+                {
+                    if (!active[i])
+                    {
+                        continue;
+                    }
+
+                    NekDouble rho_new = vExchange[3*i];
+                    mu[i]             = vExchange[3*i+1];
+
+                    if (nIter[i] == 0)
+                    {
+                        rho[i]   = rho_new;
+                        alpha[i] = rho[i]/mu[i];
+                        nIter[i] = 1;
+                        continue;
+                    }
+
+                    eps[i] = vExchange[3*i+2];
+                    k      = nIter[i]++;
+
+                    // test if norm is within tolerance
+                    if (eps[i] < m_tolerance * m_tolerance * rhsMag[i])
+                    {
+                        if (m_verbose && m_root)
+                        {
+                            cout << "CG iterations made = " << nIter[i]
+                                 << " using tolerance of "  << m_tolerance
+                                 << " (error = "
+                                 << sqrt(eps[i]/rhsMag[i])
+                                 << ", rhs_mag = " << sqrt(rhsMag[i])
+                                 << ")" << endl;
+                        }
+                        active[i] = false;
+                        nActive--;
+                        continue;
+                    }
+
+                    if (k > m_maxiter)
+                    {
+                        if (m_root)
+                        {
+                            cout << "CG iterations made = " << nIter[i]
+                                 << " using tolerance of "  << m_tolerance
+                                 << " (error = "
+                                 << sqrt(eps[i]/rhsMag[i])
+                                 << ", rhs_mag = " << sqrt(rhsMag[i])
+                                 << ")" << endl;
+                        }
+                        ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                        "Exceeded maximum number of iterations");
+                    }
+
+                    // Compute search direction and solution coefficients
+                    beta[i]  = rho_new/rho[i];
+                    alpha[i] = rho_new/(mu[i] - rho_new*beta[i]/alpha[i]);
+                    rho[i]   = rho_new;
+                }
+            }
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                m_totalIterations = max(m_totalIterations, nIter[i]);
+            }
+        }
+
+        /**
+         * Solve a global linear system using the pipelined preconditioned
+         * conjugate gradient method (Ghysels and Vanroose, Parallel Comput.
+         * 40, 2014). The recurrences are rearranged so that the single
+         * global reduction of each iteration is started before, and
+         * completed after, the application of the preconditioner and the
+         * matrix-vector multiply, hiding its latency on large core counts.
+         *
+         * The additional recurrences make the method slightly less robust
+         * than DoConjugateGradient in reaching very tight tolerances.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoPipelinedConjugateGradient(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const int                          nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. Vectors which are passed to
+            // v_DoMatrixMultiply are of full size with zero Dirichlet part.
+            Array<OneD, NekDouble> u_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> m_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> n_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> z_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            int k;
+            NekDouble alpha = 0.0, beta, gamma, gamma_old = 0.0, delta, eps;
+            Array<OneD, NekDouble> vExchange(3,0.0);
+            LibUtilities::CommRequestSharedPtr vRequest;
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir,tmp = pOutput + nDir,1);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            // u_0 = M^{-1} r_0, w_0 = A u_0
+            m_precon->DoPreconditioner(r_A, tmp = u_A + nDir);
+            v_DoMatrixMultiply(u_A, w_A);
+
+            m_totalIterations = 0;
+
+            // Continue until convergence
+            for (k = 0; ; ++k)
+            {
+                LibUtilities::ProfileRegion iteration("Iteration");
+
+                // <r_k, u_k>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <w_k, u_k>
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           w_A + nDir,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <r_k, r_k>
+                vExchange[2] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+
+                // Start inner-product exchanges and overlap them with the
+                // preconditioner and matrix-vector multiply
+                vRequest = vComm->IAllReduce(
+                    vExchange, Nektar::LibUtilities::ReduceSum);
+
+                // m_k = M^{-1} w_k, n_k = A m_k
+                m_precon->DoPreconditioner(w_A + nDir, tmp = m_A + nDir);
+                v_DoMatrixMultiply(m_A, n_A);
+
+                vComm->Wait(vRequest);
+
+                gamma = vExchange[0];
+                delta = vExchange[1];
+                eps   = vExchange[2];
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose && m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude)
+                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
+                             << endl;
+                    }
+                    break;
+                }
+
+                if(k >= m_maxiter)
+                {
+                    if (m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude)
+                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
+                             << endl;
+                    }
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                // Compute search direction and solution coefficients
+                if (k > 0)
+                {
+                    beta  = gamma/gamma_old;
+                    alpha = gamma/(delta - beta*gamma/alpha);
+                }
+                else
+                {
+                    beta  = 0.0;
+                    alpha = gamma/delta;
+                }
+                gamma_old = gamma;
+
+                // z_k = n_k + beta z_{k-1}, q_k = m_k + beta q_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &z_A[0], 1, &n_A[nDir], 1, &z_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &q_A[0], 1, &m_A[nDir], 1, &q_A[0], 1);
+
+                // s_k = w_k + beta s_{k-1}, p_k = u_k + beta p_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &s_A[0], 1, &w_A[nDir], 1, &s_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &u_A[nDir], 1, &p_A[0], 1);
+
+                // Update solution x_{k+1} and residual r_{k+1}
+                Vmath::Svtvp(nNonDir, alpha, &p_A[0], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &s_A[0], 1, &r_A[0], 1, &r_A[0], 1);
+
+                // u_{k+1} = u_k - alpha q_k, w_{k+1} = w_k - alpha z_k
+                Vmath::Svtvp(nNonDir, -alpha, &q_A[0], 1, &u_A[nDir], 1, &u_A[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &z_A[0], 1, &w_A[nDir], 1, &w_A[nDir], 1);
+
+                m_totalIterations++;
+            }
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(
             const NekVector<NekDouble> &pIn)
         {
@@ -60,6 +60,9 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysIterative();
 
+            static std::string lookupIds[];
+            static std::string def;
+
         protected:
             /// Global to universal unique map
             Array<OneD, int>                            m_map;
@@ -79,6 +82,9 @@ namespace Nektar
             PreconditionerSharedPtr                     m_precon;
 
             MultiRegions::PreconditionerType            m_precontype;
+
+            /// Krylov method used to solve the system
+            MultiRegions::IterativeSolverType           m_solverType;
             
             int                                         m_totalIterations;
 
@@ -111,9 +117,22 @@ namespace Nektar
                     const int pNumDir);
 
 
+            /// Simultaneous iterative solve of several systems
+            void DoBlockConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                          Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
 
             virtual void v_UniqueMap() = 0;
+
+            /// Matrix-vector multiply of several vectors
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
             
         private:
             void UpdateKnownSolutions(
@@ -121,6 +140,12 @@ namespace Nektar
                     const Array<OneD,const NekDouble> &pSolution,
                     const int pNumDirBndDofs);
 
+            void DoPipelinedConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
             NekDouble CalculateAnorm(
                     const int nGlobal,
                     const Array<OneD,const NekDouble> &in,
@@ -135,6 +160,14 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Solve the matrix system for several right-hand sides
+            virtual void v_SolveLinearSystemMultiple(
+                    const int pNumRows,
+                    const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                          Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput) = 0;
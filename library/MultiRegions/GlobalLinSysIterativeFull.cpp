@@ -36,6 +36,7 @@
 #include <map>
 #include <MultiRegions/GlobalLinSysIterativeFull.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 using namespace std;
 
@@ -113,6 +114,25 @@ namespace Nektar
                           Array<OneD,       NekDouble>  &pOutput,
                     const AssemblyMapSharedPtr &pLocToGloMap,
                     const Array<OneD, const NekDouble>  &pDirForcing)
+        {
+            Array<OneD, Array<OneD, const NekDouble> > vIn (1, pInput);
+            Array<OneD, Array<OneD, const NekDouble> > vDir(1, pDirForcing);
+            Array<OneD, Array<OneD,       NekDouble> > vOut(1, pOutput);
+
+            v_SolveMultiple(vIn, vOut, pLocToGloMap, vDir);
+        }
+
+
+        /**
+         * Solve the linear system for several right-hand sides. The
+         * Dirichlet forcing is removed from each right-hand side before the
+         * systems are solved together.
+         */
+        void GlobalLinSysIterativeFull::v_SolveMultiple(
+            const Array<OneD, Array<OneD, const NekDouble> > &pInput,
+                  Array<OneD, Array<OneD,       NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr                       &pLocToGloMap,
+            const Array<OneD, Array<OneD, const NekDouble> > &pDirForcing)
         {
             boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
             bool vCG;
@@ -131,55 +151,71 @@ namespace Nektar
                 ASSERTL0(false, "Unknown map type");
             }
 
-            bool dirForcCalculated = (bool) pDirForcing.num_elements();
+            int nRhs      = pInput.num_elements();
             int nDirDofs  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
             int nGlobDofs = pLocToGloMap->GetNumGlobalCoeffs();
             int nDirTotal = nDirDofs;
-            
+
             expList->GetComm()->GetRowComm()
                    ->AllReduce(nDirTotal, LibUtilities::ReduceSum);
-            
-            Array<OneD, NekDouble> tmp(nGlobDofs), tmp2;
+
+            Array<OneD, Array<OneD, const NekDouble> > rhs(nRhs);
 
             if(nDirTotal)
             {
-                // calculate the Dirichlet forcing
-                if(dirForcCalculated)
-                {
-                    Vmath::Vsub(nGlobDofs, pInput.get(), 1,
-                                pDirForcing.get(), 1,
-                                tmp.get(), 1);
-                }
-                else
-                {
-                    // Calculate the dirichlet forcing B_b (== X_b) and
-                    // substract it from the rhs
-                    expList->GeneralMatrixOp(
-                        m_linSysKey, pOutput, tmp, eGlobal);
-
-                    Vmath::Vsub(nGlobDofs, pInput.get(), 1,
-                                           tmp.get(),    1,
-                                           tmp.get(),    1);
-                }
-                if (vCG)
+                ASSERTL0(vCG, "Need DG solve if using Dir BCs");
+
+                Array<OneD, Array<OneD, NekDouble> > out(nRhs);
+
+                for (int i = 0; i < nRhs; ++i)
                 {
-                    Array<OneD, NekDouble> out(nGlobDofs,0.0);
+                    Array<OneD, NekDouble> tmp(nGlobDofs);
 
-                    // solve for perturbation from intiial guess in pOutput
-                    SolveLinearSystem(
-                        nGlobDofs, tmp, out, pLocToGloMap, nDirDofs);
-                    Vmath::Vadd(nGlobDofs-nDirDofs,    &out    [nDirDofs], 1,
-                                &pOutput[nDirDofs], 1, &pOutput[nDirDofs], 1);
+                    // calculate the Dirichlet forcing
+                    if(pDirForcing[i].num_elements())
+                    {
+                        Vmath::Vsub(nGlobDofs, pInput[i].get(), 1,
+                                    pDirForcing[i].get(), 1,
+                                    tmp.get(), 1);
+                    }
+                    else
+                    {
+                        // Calculate the dirichlet forcing B_b (== X_b) and
+                        // substract it from the rhs
+                        expList->GeneralMatrixOp(
+                            m_linSysKey, pOutput[i], tmp, eGlobal);
+
+                        Vmath::Vsub(nGlobDofs, pInput[i].get(), 1,
+                                               tmp.get(),       1,
+                                               tmp.get(),       1);
+                    }
+
+                    rhs[i] = tmp;
+                    out[i] = Array<OneD, NekDouble>(nGlobDofs,0.0);
                 }
-                else
+
+                // solve for perturbation from intiial guess in pOutput
+                SolveLinearSystemMultiple(
+                    nGlobDofs, rhs, out, pLocToGloMap, nDirDofs);
+
+                for (int i = 0; i < nRhs; ++i)
                 {
-                    ASSERTL0(false, "Need DG solve if using Dir BCs");
+                    Vmath::Vadd(nGlobDofs-nDirDofs,
+                                &out[i]    [nDirDofs], 1,
+                                &pOutput[i][nDirDofs], 1,
+                                &pOutput[i][nDirDofs], 1);
                 }
             }
             else
             {
-                Vmath::Vcopy(nGlobDofs, pInput, 1, tmp, 1);
-                SolveLinearSystem(nGlobDofs, tmp, pOutput, pLocToGloMap);
+                for (int i = 0; i < nRhs; ++i)
+                {
+                    Array<OneD, NekDouble> tmp(nGlobDofs);
+                    Vmath::Vcopy(nGlobDofs, pInput[i], 1, tmp, 1);
+                    rhs[i] = tmp;
+                }
+                SolveLinearSystemMultiple(nGlobDofs, rhs, pOutput,
+                                          pLocToGloMap);
             }
         }
 
@@ -191,6 +227,8 @@ namespace Nektar
                 const Array<OneD, NekDouble>& pInput,
                       Array<OneD, NekDouble>& pOutput)
         {
+            LibUtilities::ProfileRegion region("MatrixMultiply");
+
             boost::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
             // Perform matrix-vector operation A*d_i
             expList->GeneralMatrixOp(m_linSysKey,
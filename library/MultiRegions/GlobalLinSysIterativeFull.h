@@ -84,6 +84,13 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing
                                                         = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const Array<OneD, Array<OneD, const NekDouble> > &dirForcing);
+
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
@@ -36,6 +36,7 @@
 
 #include <MultiRegions/GlobalLinSysIterativeStaticCond.h>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
 #include <LibUtilities/LinearAlgebra/SparseDiagBlkMatrix.hpp>
@@ -74,7 +75,7 @@ namespace Nektar
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
                 "LocalMatrixStorageStrategy",
                 "Sparse");
-        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[3] = {
+        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[4] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "LocalMatrixStorageStrategy",
                 "Contiguous",
@@ -87,6 +88,10 @@ namespace Nektar
                 "LocalMatrixStorageStrategy",
                 "Sparse",
                 MultiRegions::eSparse),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LocalMatrixStorageStrategy",
+                "MatrixFree",
+                MultiRegions::eMatrixFree),
         };
 
         /**
@@ -114,7 +119,8 @@ namespace Nektar
             const boost::shared_ptr<AssemblyMap> &pLocToGloMap)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_matrixFree          (false)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eIterativeStaticCond)||
                      (pKey.GetGlobalSysSolnType()==eIterativeMultiLevelStaticCond),
@@ -141,7 +147,8 @@ namespace Nektar
             const PreconditionerSharedPtr         pPrecon)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_matrixFree          (false)
         {
             m_schurCompl  = pSchurCompl;
             m_S1Blk       = pSchurCompl;
@@ -156,6 +163,23 @@ namespace Nektar
         {
             m_precon = CreatePrecon(m_locToGloMap);
 
+            // With matrix-free storage the Schur complement is not assembled:
+            // the preconditioner is built from elemental blocks retrieved on
+            // demand (see v_GetStaticCondBlock).
+            bool preconBuilt = false;
+            if (UseMatrixFreeSchurComplement())
+            {
+                m_matrixFree = true;
+                m_precon->BuildPreconditioner();
+                preconBuilt  = true;
+
+                if (SetupMatrixFreeTopLevel())
+                {
+                    Initialise(m_locToGloMap);
+                    return;
+                }
+            }
+
             // Allocate memory for top-level structure
             SetupTopLevel(m_locToGloMap);
 
@@ -177,7 +201,10 @@ namespace Nektar
             }
 
             // Build preconditioner
-            m_precon->BuildPreconditioner();
+            if (!preconBuilt)
+            {
+                m_precon->BuildPreconditioner();
+            }
 
             // Do transform of Schur complement matrix
             for (n = 0; n < n_exp; ++n)
@@ -208,8 +235,23 @@ namespace Nektar
         {
             DNekScalBlkMatSharedPtr schurComplBlock;
             int  scLevel           = m_locToGloMap->GetStaticCondLevel();
-            DNekScalBlkMatSharedPtr sc = scLevel == 0 ? m_S1Blk : m_schurCompl;
-            DNekScalMatSharedPtr    localMat = sc->GetBlock(n,n);
+            DNekScalMatSharedPtr    localMat;
+
+            if (m_matrixFree && scLevel == 0)
+            {
+                // The Schur complement is not stored: compute the elemental
+                // block and release it from the expansion once returned.
+                localMat = GlobalLinSys::v_GetStaticCondBlock(n)->
+                    GetBlock(0,0);
+                GlobalLinSys::v_DropStaticCondBlock(n);
+            }
+            else
+            {
+                DNekScalBlkMatSharedPtr sc =
+                    scLevel == 0 ? m_S1Blk : m_schurCompl;
+                localMat = sc->GetBlock(n,n);
+            }
+
             unsigned int nbdry    = localMat->GetRows();
             unsigned int nblks    = 1;
             unsigned int esize[1] = {nbdry};
@@ -326,6 +368,17 @@ namespace Nektar
                     GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
                                        "LocalMatrixStorageStrategy");
 
+            if (storageStrategy == MultiRegions::eMatrixFree)
+            {
+                if (m_matrixFree)
+                {
+                    return;
+                }
+
+                // Fall back to the default storage strategy
+                storageStrategy = MultiRegions::eSparse;
+            }
+
             switch(storageStrategy)
             {
                 case MultiRegions::eContiguous:
@@ -466,7 +519,7 @@ namespace Nektar
                 default:
                     ErrorUtil::NekError("Solver info property \
                         LocalMatrixStorageStrategy takes values \
-                        Contiguous, Non-contiguous and Sparse");
+                        Contiguous, Non-contiguous, Sparse and MatrixFree");
             }
         }
 
@@ -477,6 +530,8 @@ namespace Nektar
                 const Array<OneD, NekDouble>& pInput,
                       Array<OneD, NekDouble>& pOutput)
         {
+            LibUtilities::ProfileRegion region("MatrixMultiply");
+
             int nLocal = m_locToGloMap->GetNumLocalBndCoeffs();
             int nDir = m_locToGloMap->GetNumGlobalDirBndCoeffs();
             bool doGlobalOp = m_expList.lock()->GetGlobalOptParam()->
@@ -491,6 +546,15 @@ namespace Nektar
                 m_sparseSchurCompl->Multiply(in,out);
                 m_locToGloMap->UniversalAssembleBnd(pOutput, nDir);
             }
+            else if (m_matrixFree)
+            {
+                // Apply the Schur complement elementally without matrices
+                Array<OneD, NekDouble> tmp = m_wsp + nLocal;
+
+                m_locToGloMap->GlobalToLocalBnd(pInput, m_wsp);
+                MatrixFreeSchurComplMultiply(m_wsp, tmp);
+                m_locToGloMap->AssembleBnd(tmp, pOutput);
+            }
             else if (m_sparseSchurCompl)
             {
                 // Do matrix multiply locally using block-diagonal sparse matrix
@@ -518,6 +582,384 @@ namespace Nektar
             }
         }
 
+        /**
+         * When the Schur complement is held as dense local blocks, the local
+         * boundary values of all vectors are gathered into the columns of a
+         * single array so that each block is applied to all of them using
+         * one matrix-matrix multiply.
+         */
+        void GlobalLinSysIterativeStaticCond::v_DoMatrixMultiplyMultiple(
+                const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                      Array<OneD, Array<OneD, NekDouble> > &pOutput)
+        {
+            LibUtilities::ProfileRegion region("MatrixMultiply");
+
+            int nRhs   = pInput.num_elements();
+            int nLocal = m_locToGloMap->GetNumLocalBndCoeffs();
+            bool doGlobalOp = m_expList.lock()->GetGlobalOptParam()->
+                    DoGlobalMatOp(m_linSysKey.GetMatrixType());
+
+            if (doGlobalOp || m_sparseSchurCompl || m_matrixFree || nRhs == 1)
+            {
+                GlobalLinSysIterative::v_DoMatrixMultiplyMultiple(
+                    pInput, pOutput);
+                return;
+            }
+
+            if (m_wspMultiple.num_elements() < 2*nRhs*nLocal)
+            {
+                m_wspMultiple = Array<OneD, NekDouble>(2*nRhs*nLocal);
+            }
+
+            int i, cnt;
+            Array<OneD, NekDouble> tmp;
+            Array<OneD, NekDouble> tmpout = m_wspMultiple + nRhs*nLocal;
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                m_locToGloMap->GlobalToLocalBnd(
+                    pInput[i], tmp = m_wspMultiple + i*nLocal);
+            }
+
+            for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+            {
+                const int rows = m_rows[i];
+                Blas::Dgemm('N', 'N', rows, nRhs, rows,
+                            m_scale[i], m_denseBlocks[i], rows,
+                            m_wspMultiple.get()+cnt, nLocal,
+                            0.0, tmpout.get()+cnt, nLocal);
+            }
+
+            for (i = 0; i < nRhs; ++i)
+            {
+                m_locToGloMap->AssembleBnd(tmp = tmpout + i*nLocal,
+                                           pOutput[i]);
+            }
+        }
+
+        /**
+         * Determines whether the Schur complement should be applied
+         * matrix-free. This requires the MatrixFree local matrix storage
+         * strategy, single-level static condensation, a continuous Galerkin
+         * operator and local (rather than global) matrix operations.
+         */
+        bool GlobalLinSysIterativeStaticCond::UseMatrixFreeSchurComplement()
+        {
+            boost::shared_ptr<ExpList> expList = m_expList.lock();
+
+            if (expList->GetSession()->
+                    GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
+                        "LocalMatrixStorageStrategy") !=
+                MultiRegions::eMatrixFree)
+            {
+                return false;
+            }
+
+            bool doGlobalOp = expList->GetGlobalOptParam()->
+                DoGlobalMatOp(m_linSysKey.GetMatrixType());
+
+            if (!m_locToGloMap->AtLastLevel() || doGlobalOp ||
+                m_linSysKey.GetMatrixType() ==
+                    StdRegions::eHybridDGHelmBndLam)
+            {
+                if (m_root)
+                {
+                    cout << "Warning: Schur complement cannot be applied "
+                         << "matrix-free; using Sparse local matrix storage."
+                         << endl;
+                }
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Sets up the top level of the system for the application of the
+         * Schur complement
+         * \f$\boldsymbol{S} = \boldsymbol{A} - \boldsymbol{BD^{-1}C}\f$
+         * without assembling it. In place of SetupTopLevel, the elemental
+         * condensed blocks are retrieved one element at a time: the blocks
+         * \f$\boldsymbol{BD^{-1}}\f$, \f$\boldsymbol{C}\f$ and
+         * \f$\boldsymbol{D^{-1}}\f$ needed to condense the right-hand side
+         * and recover the interior solution are kept, together with the
+         * elemental boundary and interior maps, whereas the elemental Schur
+         * complement is only used to check the matrix-free operator (see
+         * MatrixFreeElmtMultiply) before it is released.
+         *
+         * If the preconditioner transforms the Schur complement, or the
+         * matrix-free operator does not reproduce it, false is returned and
+         * the system should be set up with stored matrices instead.
+         */
+        bool GlobalLinSysIterativeStaticCond::SetupMatrixFreeTopLevel()
+        {
+            boost::shared_ptr<ExpList> expList = m_expList.lock();
+            int n, i, nBnd, nInt, cnt, maxCoeffs = 0, maxInt = 0;
+            int n_exp = expList->GetNumElmts();
+            bool valid = true;
+
+            const Array<OneD,const unsigned int>& nbdry_size
+                    = m_locToGloMap->GetNumLocalBndCoeffsPerPatch();
+            const Array<OneD,const unsigned int>& nint_size
+                    = m_locToGloMap->GetNumLocalIntCoeffsPerPatch();
+
+            if (nbdry_size.num_elements() != n_exp)
+            {
+                valid = false;
+            }
+
+            // Setup Block Matrix systems, the Schur complement being empty
+            MatrixStorage blkmatStorage = eDIAGONAL;
+            m_S1Blk      = MemoryManager<DNekScalBlkMat>
+                    ::AllocateSharedPtr(nbdry_size, nbdry_size, blkmatStorage);
+            m_schurCompl = m_S1Blk;
+            m_BinvD      = MemoryManager<DNekScalBlkMat>
+                    ::AllocateSharedPtr(nbdry_size, nint_size , blkmatStorage);
+            m_C          = MemoryManager<DNekScalBlkMat>
+                    ::AllocateSharedPtr(nint_size , nbdry_size, blkmatStorage);
+            m_invD       = MemoryManager<DNekScalBlkMat>
+                    ::AllocateSharedPtr(nint_size , nint_size , blkmatStorage);
+
+            m_bndMaps = Array<OneD, Array<OneD, unsigned int> >(n_exp);
+            m_intMaps = Array<OneD, Array<OneD, unsigned int> >(n_exp);
+
+            for (n = 0; valid && n < n_exp; ++n)
+            {
+                expList->GetExp(n)->GetBoundaryMap(m_bndMaps[n]);
+                expList->GetExp(n)->GetInteriorMap(m_intMaps[n]);
+                maxCoeffs = max(maxCoeffs, expList->GetExp(n)->GetNcoeffs());
+                maxInt    = max(maxInt, (int)m_intMaps[n].num_elements());
+            }
+
+            m_wspElmt = Array<OneD, NekDouble>(2*maxCoeffs + 2*maxInt);
+
+            // Retrieve the condensed blocks element by element, comparing
+            // the matrix-free operator with the elemental Schur complement on
+            // a test vector and timing both.
+            size_t    nS = 0, nBinvD = 0, nC = 0, nInvD = 0, nMaps = 0;
+            NekDouble timeStored = 0.0, timeFree = 0.0;
+            NekDouble maxDiff = 0.0, maxVal = 0.0;
+            Timer     timer;
+
+            for (n = cnt = 0; valid && n < n_exp; ++n)
+            {
+                DNekScalBlkMatSharedPtr loc_schur
+                    = GlobalLinSys::v_GetStaticCondBlock(n);
+                DNekScalMatSharedPtr S = loc_schur->GetBlock(0,0), t;
+
+                // The preconditioner must not have changed the basis.
+                if (m_precon->TransformedSchurCompl(n, S)->GetOwnedMatrix()
+                        != S->GetOwnedMatrix())
+                {
+                    valid = false;
+                    break;
+                }
+
+                m_BinvD->SetBlock(n, n, t = loc_schur->GetBlock(0,1));
+                m_C    ->SetBlock(n, n, t = loc_schur->GetBlock(1,0));
+                m_invD ->SetBlock(n, n, t = loc_schur->GetBlock(1,1));
+
+                nBnd = nbdry_size[n];
+                nInt = nint_size[n];
+
+                Array<OneD, NekDouble> x(nBnd), y1(nBnd), y2(nBnd);
+                for (i = 0; i < nBnd; ++i)
+                {
+                    x[i] = 1.0 + 0.5 * sin(1.0 + cnt + i);
+                }
+
+                NekVector<NekDouble> X (nBnd, x,  eWrapper);
+                NekVector<NekDouble> Y1(nBnd, y1, eWrapper);
+
+                timer.Start();
+                Multiply(Y1, *S, X);
+                timer.Stop();
+                timeStored += timer.TimePerTest(1);
+
+                timer.Start();
+                MatrixFreeElmtMultiply(n, x, y2);
+                timer.Stop();
+                timeFree += timer.TimePerTest(1);
+
+                for (i = 0; i < nBnd; ++i)
+                {
+                    maxDiff = max(maxDiff, fabs(y1[i] - y2[i]));
+                    maxVal  = max(maxVal,  fabs(y1[i]));
+                }
+
+                // Only the blocks held above are retained.
+                GlobalLinSys::v_DropStaticCondBlock(n);
+
+                nS     += nBnd * nBnd;
+                nBinvD += nBnd * nInt;
+                nC     += nInt * nBnd;
+                nInvD  += nInt * nInt;
+                nMaps  += nBnd + nInt;
+                cnt    += nBnd;
+            }
+
+            valid = valid && maxDiff <= 1e-8 * max(maxVal, 1.0);
+
+            if (!valid)
+            {
+                if (m_root)
+                {
+                    cout << "Warning: Schur complement cannot be applied "
+                         << "matrix-free; using Sparse local matrix storage."
+                         << endl;
+                }
+                m_bndMaps    = Array<OneD, Array<OneD, unsigned int> >();
+                m_intMaps    = Array<OneD, Array<OneD, unsigned int> >();
+                m_wspElmt    = Array<OneD, NekDouble>();
+                m_matrixFree = false;
+                return false;
+            }
+
+            m_wspLocal = Array<OneD, NekDouble>(cnt);
+
+            if (m_verbose && m_root)
+            {
+                const NekDouble toMB = sizeof(NekDouble) / 1048576.0;
+
+                cout << "Matrix-free Schur complement on rank 0:" << endl
+                     << "\tSchur complement storage : "
+                     << nS * toMB << " MB not assembled" << endl
+                     << "\tBD^{-1} storage          : "
+                     << nBinvD * toMB << " MB" << endl
+                     << "\tC storage                : "
+                     << nC * toMB << " MB" << endl
+                     << "\tD^{-1} storage           : "
+                     << nInvD * toMB << " MB" << endl
+                     << "\tElemental maps           : "
+                     << nMaps * sizeof(unsigned int) / 1048576.0
+                     << " MB" << endl
+                     << "\tElemental matrix multiply: "
+                     << timeStored << " s" << endl
+                     << "\tMatrix-free multiply     : "
+                     << timeFree << " s" << endl;
+            }
+
+            return true;
+        }
+
+        /**
+         * Applies the Schur complement of element @p n to its local boundary
+         * values @p pInput. The interior values
+         * @f$\boldsymbol{x}_i = -\boldsymbol{D^{-1}C}\boldsymbol{x}_b@f$ are
+         * found from the action of the elemental operator on the boundary
+         * values, after which the boundary part of the action of the operator
+         * on @f$(\boldsymbol{x}_b, \boldsymbol{x}_i)@f$ is
+         * @f$\boldsymbol{S}\boldsymbol{x}_b@f$. The elemental operator is
+         * evaluated using the sum-factorisation kernels of the expansion.
+         */
+        void GlobalLinSysIterativeStaticCond::MatrixFreeElmtMultiply(
+                const int                           n,
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            boost::shared_ptr<ExpList> expList = m_expList.lock();
+            LocalRegions::ExpansionSharedPtr exp = expList->GetExp(n);
+            const Array<OneD, unsigned int> &bmap = m_bndMaps[n];
+            const Array<OneD, unsigned int> &imap = m_intMaps[n];
+            int i;
+            int nBnd    = bmap.num_elements();
+            int nInt    = imap.num_elements();
+            int nCoeffs = exp->GetNcoeffs();
+
+            // need to be initialised with zero size for non variable
+            // coefficient case
+            StdRegions::VarCoeffMap varcoeffs;
+            StdRegions::VarCoeffMap::const_iterator x;
+            for (x  = m_linSysKey.GetVarCoeffs().begin();
+                 x != m_linSysKey.GetVarCoeffs().end(); ++x)
+            {
+                varcoeffs[x->first] = x->second +
+                    expList->GetPhys_Offset(n);
+            }
+
+            StdRegions::StdMatrixKey mkey(m_linSysKey.GetMatrixType(),
+                                          exp->DetShapeType(), *exp,
+                                          m_linSysKey.GetConstFactors(),
+                                          varcoeffs);
+
+            Array<OneD, NekDouble> u    = m_wspElmt;
+            Array<OneD, NekDouble> w    = m_wspElmt + nCoeffs;
+            Array<OneD, NekDouble> wInt = m_wspElmt + 2*nCoeffs;
+            Array<OneD, NekDouble> uInt = m_wspElmt + 2*nCoeffs + nInt;
+
+            Vmath::Zero(nCoeffs, u, 1);
+            for (i = 0; i < nBnd; ++i)
+            {
+                u[bmap[i]] = pInput[i];
+            }
+
+            if (nInt)
+            {
+                // C x_b is the interior part of A (x_b, 0)
+                exp->GeneralMatrixOp(u, w, mkey);
+
+                for (i = 0; i < nInt; ++i)
+                {
+                    wInt[i] = w[imap[i]];
+                }
+
+                NekVector<NekDouble> WInt(nInt, wInt, eWrapper);
+                NekVector<NekDouble> UInt(nInt, uInt, eWrapper);
+                Multiply(UInt, *m_invD->GetBlock(n,n), WInt);
+
+                for (i = 0; i < nInt; ++i)
+                {
+                    u[imap[i]] = -uInt[i];
+                }
+            }
+
+            exp->GeneralMatrixOp(u, w, mkey);
+
+            for (i = 0; i < nBnd; ++i)
+            {
+                pOutput[i] = w[bmap[i]];
+            }
+        }
+
+        /**
+         * Applies the Schur complement to the local boundary vector @p
+         * pInput, element by element.
+         */
+        void GlobalLinSysIterativeStaticCond::MatrixFreeSchurComplMultiply(
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            int n, cnt, nBlk = m_bndMaps.num_elements();
+            Array<OneD, NekDouble> tmp;
+
+            for (n = cnt = 0; n < nBlk; ++n)
+            {
+                MatrixFreeElmtMultiply(n, pInput + cnt, tmp = pOutput + cnt);
+                cnt += m_bndMaps[n].num_elements();
+            }
+        }
+
+        /**
+         * Multiply by the Schur complement, using the matrix-free operator
+         * when the Schur complement has not been assembled.
+         */
+        void GlobalLinSysIterativeStaticCond::v_SchurComplMultiply(
+                const DNekScalBlkMatSharedPtr &pSchurCompl,
+                NekVector<NekDouble>          &pInOut)
+        {
+            if (m_matrixFree && pSchurCompl == m_S1Blk)
+            {
+                int nLocal = pInOut.GetDimension();
+                MatrixFreeSchurComplMultiply(pInOut.GetPtr(), m_wspLocal);
+                Vmath::Vcopy(nLocal, m_wspLocal, 1, pInOut.GetPtr(), 1);
+            }
+            else
+            {
+                GlobalLinSysStaticCond::v_SchurComplMultiply(
+                    pSchurCompl, pInOut);
+            }
+        }
+
         void GlobalLinSysIterativeStaticCond::v_UniqueMap()
         {
             m_map = m_locToGloMap->GetGlobalToUniversalBndMapUnique();
@@ -57,14 +57,16 @@ namespace Nektar
             eNoStrategy,
             eContiguous,
             eNonContiguous,
-            eSparse
+            eSparse,
+            eMatrixFree
         };
 
         const char* const LocalMatrixStorageStrategyMap[] =
         {
             "Contiguous",
             "Non-contiguous",
-            "Sparse"
+            "Sparse",
+            "MatrixFree"
         };
 
 
@@ -146,6 +148,18 @@ namespace Nektar
             Array<OneD, NekDouble>                   m_scale;
             /// Sparse representation of Schur complement matrix at this level
             DNekSmvBsrDiagBlkMatSharedPtr            m_sparseSchurCompl;
+            /// Workspace for multiplication of several vectors
+            Array<OneD, NekDouble>                   m_wspMultiple;
+            /// Whether the Schur complement is applied without being stored
+            bool                                     m_matrixFree;
+            /// Elemental boundary maps for the matrix-free Schur complement
+            Array<OneD, Array<OneD, unsigned int> >  m_bndMaps;
+            /// Elemental interior maps for the matrix-free Schur complement
+            Array<OneD, Array<OneD, unsigned int> >  m_intMaps;
+            /// Elemental workspace for the matrix-free Schur complement
+            Array<OneD, NekDouble>                   m_wspElmt;
+            /// Local boundary workspace for the matrix-free Schur complement
+            Array<OneD, NekDouble>                   m_wspLocal;
             /// Utility strings
             static std::string                       storagedef;
             static std::string                       storagelookupIds[];
@@ -160,11 +174,41 @@ namespace Nektar
             /// stored as a sparse block-diagonal matrix.
             void PrepareLocalSchurComplement();
 
+            /// Whether the Schur complement is to be applied matrix-free.
+            bool UseMatrixFreeSchurComplement();
+
+            /// Sets up the top level without assembling the Schur
+            /// complement.
+            bool SetupMatrixFreeTopLevel();
+
+            /// Applies the Schur complement of one element without storing
+            /// it.
+            void MatrixFreeElmtMultiply(
+                    const int                           n,
+                    const Array<OneD, const NekDouble> &pInput,
+                          Array<OneD,       NekDouble> &pOutput);
+
+            /// Applies the Schur complement to a local boundary vector
+            /// without using the stored Schur complement matrices.
+            void MatrixFreeSchurComplMultiply(
+                    const Array<OneD, const NekDouble> &pInput,
+                          Array<OneD,       NekDouble> &pOutput);
+
+            virtual void v_SchurComplMultiply(
+                    const DNekScalBlkMatSharedPtr &pSchurCompl,
+                    NekVector<NekDouble>          &pInOut);
+
             /// Perform a Shur-complement matrix multiply operation.
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
 
+            /// Perform a Shur-complement matrix multiply operation on several
+            /// vectors.
+            virtual void v_DoMatrixMultiplyMultiple(
+                    const Array<OneD, Array<OneD, NekDouble> > &pInput,
+                          Array<OneD, Array<OneD, NekDouble> > &pOutput);
+
             virtual void v_UniqueMap();
         };
     }
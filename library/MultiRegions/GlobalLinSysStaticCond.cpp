@@ -109,10 +109,32 @@ namespace Nektar
             const AssemblyMapSharedPtr         &pLocToGloMap,
             const Array<OneD, const NekDouble> &dirForcing)
         {
-            bool dirForcCalculated = (bool) dirForcing.num_elements();
+            Array<OneD, Array<OneD, const NekDouble> > vIn (1, in);
+            Array<OneD, Array<OneD, const NekDouble> > vDir(1, dirForcing);
+            Array<OneD, Array<OneD,       NekDouble> > vOut(1, out);
+
+            v_SolveMultiple(vIn, vOut, pLocToGloMap, vDir);
+        }
+
+
+        /**
+         * Solve the statically condensed system for several right-hand
+         * sides. The boundary forcing of each right-hand side is formed in
+         * turn, after which the condensed boundary systems are solved
+         * together so that the solver may share work and communication
+         * between them. The interior degrees of freedom are then recovered
+         * for each right-hand side.
+         */
+        void GlobalLinSysStaticCond::v_SolveMultiple(
+            const Array<OneD, Array<OneD, const NekDouble> > &in,
+                  Array<OneD, Array<OneD,       NekDouble> > &out,
+            const AssemblyMapSharedPtr                       &pLocToGloMap,
+            const Array<OneD, Array<OneD, const NekDouble> > &dirForcing)
+        {
             bool atLastLevel       = pLocToGloMap->AtLastLevel();
             int  scLevel           = pLocToGloMap->GetStaticCondLevel();
-            
+            int  nRhs              = in.num_elements();
+
             int nGlobDofs          = pLocToGloMap->GetNumGlobalCoeffs();
             int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
             int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
@@ -121,66 +143,79 @@ namespace Nektar
             int nIntDofs           = pLocToGloMap->GetNumGlobalCoeffs()
                 - nGlobBndDofs;
 
-            Array<OneD, NekDouble> F = m_wsp + 2*nLocBndDofs + nGlobHomBndDofs;
+            // The forcing of the first right-hand side lives in the
+            // workspace; the others need their own storage since they are
+            // all required until the boundary systems have been solved.
+            Array<OneD, Array<OneD, NekDouble> > F(nRhs);
             Array<OneD, NekDouble> tmp;
-            if(nDirBndDofs && dirForcCalculated)
-            {
-                Vmath::Vsub(nGlobDofs,in.get(),1,dirForcing.get(),1,F.get(),1);
-            }
-            else
-            {
-                Vmath::Vcopy(nGlobDofs,in.get(),1,F.get(),1);
-            }
-            
-            NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,tmp=F+nDirBndDofs,
-                                          eWrapper);
-            NekVector<NekDouble> F_GlobBnd(nGlobBndDofs,F,eWrapper);
-            NekVector<NekDouble> F_Int(nIntDofs,tmp=F+nGlobBndDofs,eWrapper);
-            
-            NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out,eWrapper);
-            NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
-                                              tmp=out+nDirBndDofs,
-                                              eWrapper);
-            NekVector<NekDouble> V_Int(nIntDofs,tmp=out+nGlobBndDofs,eWrapper);
+            int i;
+
             NekVector<NekDouble> V_LocBnd(nLocBndDofs,m_wsp,eWrapper);
-            
             NekVector<NekDouble> V_GlobHomBndTmp(
                 nGlobHomBndDofs,tmp = m_wsp + 2*nLocBndDofs,eWrapper);
 
-            // set up normalisation factor for right hand side on first SC level
-            DNekScalBlkMatSharedPtr sc = v_PreSolve(scLevel, F_GlobBnd);
-
-            if(nGlobHomBndDofs)
+            for (i = 0; i < nRhs; ++i)
             {
+                bool dirForcCalculated = (bool) dirForcing[i].num_elements();
+
+                F[i] = i == 0 ? m_wsp + 2*nLocBndDofs + nGlobHomBndDofs
+                              : Array<OneD, NekDouble>(nGlobDofs);
+
+                if(nDirBndDofs && dirForcCalculated)
+                {
+                    Vmath::Vsub(nGlobDofs,in[i].get(),1,
+                                dirForcing[i].get(),1,F[i].get(),1);
+                }
+                else
+                {
+                    Vmath::Vcopy(nGlobDofs,in[i].get(),1,F[i].get(),1);
+                }
+
+                NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,
+                                              tmp=F[i]+nDirBndDofs,
+                                              eWrapper);
+                NekVector<NekDouble> F_GlobBnd(nGlobBndDofs,F[i],eWrapper);
+                NekVector<NekDouble> F_Int(nIntDofs,tmp=F[i]+nGlobBndDofs,
+                                           eWrapper);
+                NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out[i],eWrapper);
+
+                // set up normalisation factor for right hand side on first
+                // SC level
+                DNekScalBlkMatSharedPtr sc = v_PreSolve(scLevel, F_GlobBnd);
+
+                if(!nGlobHomBndDofs)
+                {
+                    continue;
+                }
+
                 // construct boundary forcing
                 if( nIntDofs  && ((!dirForcCalculated) && (atLastLevel)) )
                 {
                     DNekScalBlkMat &BinvD      = *m_BinvD;
-                    DNekScalBlkMat &SchurCompl = *sc;
 
                     // include dirichlet boundary forcing
                     pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = BinvD*F_Int + SchurCompl*V_LocBnd;
+                    v_SchurComplMultiply(sc, V_LocBnd);
+                    V_LocBnd = BinvD*F_Int + V_LocBnd;
                 }
                 else if((!dirForcCalculated) && (atLastLevel))
                 {
                     // include dirichlet boundary forcing
-                    DNekScalBlkMat &SchurCompl = *sc;
                     pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
-                    V_LocBnd = SchurCompl*V_LocBnd;
+                    v_SchurComplMultiply(sc, V_LocBnd);
                 }
                 else
                 {
                     DNekScalBlkMat &BinvD      = *m_BinvD;
                     DiagonalBlockFullScalMatrixMultiply( V_LocBnd, BinvD, F_Int);
                 }
-                
+
                 pLocToGloMap->AssembleBnd(V_LocBnd,V_GlobHomBndTmp,
                                           nDirBndDofs);
                 Subtract(F_HomBnd, F_HomBnd, V_GlobHomBndTmp);
 
                 // Transform from original basis to low energy
-                v_BasisTransform(F, nDirBndDofs);
+                v_BasisTransform(F[i], nDirBndDofs);
 
                 // For parallel multi-level static condensation some
                 // processors may have different levels to others. This
@@ -195,7 +230,7 @@ namespace Nektar
                     // processes, we must do dummy communication for the
                     // remaining levels
                     Array<OneD, NekDouble> tmp(nGlobBndDofs);
-                    for (int i = scLevel; i < lcLevel; ++i)
+                    for (int j = scLevel; j < lcLevel; ++j)
                     {
                         Vmath::Fill(nGlobBndDofs, 0.0, tmp, 1);
                         pLocToGloMap->UniversalAssembleBnd(tmp);
@@ -205,52 +240,87 @@ namespace Nektar
                         Subtract( F_HomBnd, F_HomBnd, V_GlobHomBndTmp);
                     }
                 }
+            }
+
+            // solve boundary systems
+            if(nGlobHomBndDofs)
+            {
+                Array<OneD, Array<OneD, const NekDouble> > vF(nRhs);
+                for (i = 0; i < nRhs; ++i)
+                {
+                    vF[i] = F[i];
+                }
 
-                // solve boundary system
                 if(atLastLevel)
                 {
-                    Array<OneD, NekDouble> pert(nGlobBndDofs,0.0);
+                    Array<OneD, Array<OneD, NekDouble> > pert(nRhs);
+                    for (i = 0; i < nRhs; ++i)
+                    {
+                        pert[i] = Array<OneD, NekDouble>(nGlobBndDofs,0.0);
+                    }
 
                     // Solve for difference from initial solution given inout;
-                    SolveLinearSystem(
-                        nGlobBndDofs, F, pert, pLocToGloMap, nDirBndDofs);
+                    SolveLinearSystemMultiple(
+                        nGlobBndDofs, vF, pert, pLocToGloMap, nDirBndDofs);
 
-                    // Transform back to original basis
-                    v_BasisInvTransform(pert);
+                    for (i = 0; i < nRhs; ++i)
+                    {
+                        // Transform back to original basis
+                        v_BasisInvTransform(pert[i]);
 
-                    // Add back initial conditions onto difference
-                    Vmath::Vadd(nGlobHomBndDofs,&out[nDirBndDofs],1,
-                                &pert[nDirBndDofs],1,&out[nDirBndDofs],1);
+                        // Add back initial conditions onto difference
+                        Vmath::Vadd(nGlobHomBndDofs,&out[i][nDirBndDofs],1,
+                                    &pert[i][nDirBndDofs],1,
+                                    &out[i][nDirBndDofs],1);
+                    }
                 }
                 else
                 {
-                    m_recursiveSchurCompl->Solve(F,
-                                V_GlobBnd.GetPtr(),
+                    m_recursiveSchurCompl->SolveMultiple(vF, out,
                                 pLocToGloMap->GetNextLevelLocalToGlobalMap());
                 }
             }
 
-            // solve interior system
+            // solve interior systems
             if(nIntDofs)
             {
                 DNekScalBlkMat &invD  = *m_invD;
 
-                if(nGlobHomBndDofs || nDirBndDofs)
+                for (i = 0; i < nRhs; ++i)
                 {
-                    DNekScalBlkMat &C     = *m_C;
-
-                    if(dirForcCalculated && nDirBndDofs)
-                    {
-                        pLocToGloMap->GlobalToLocalBnd(V_GlobHomBnd,V_LocBnd,
-                                                      nDirBndDofs);
-                    }
-                    else
+                    bool dirForcCalculated =
+                        (bool) dirForcing[i].num_elements();
+
+                    NekVector<NekDouble> F_Int(nIntDofs,
+                                               tmp=F[i]+nGlobBndDofs,
+                                               eWrapper);
+                    NekVector<NekDouble> V_GlobBnd(nGlobBndDofs,out[i],
+                                                   eWrapper);
+                    NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,
+                                                      tmp=out[i]+nDirBndDofs,
+                                                      eWrapper);
+                    NekVector<NekDouble> V_Int(nIntDofs,
+                                               tmp=out[i]+nGlobBndDofs,
+                                               eWrapper);
+
+                    if(nGlobHomBndDofs || nDirBndDofs)
                     {
-                        pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                        DNekScalBlkMat &C     = *m_C;
+
+                        if(dirForcCalculated && nDirBndDofs)
+                        {
+                            pLocToGloMap->GlobalToLocalBnd(V_GlobHomBnd,
+                                                           V_LocBnd,
+                                                           nDirBndDofs);
+                        }
+                        else
+                        {
+                            pLocToGloMap->GlobalToLocalBnd(V_GlobBnd,V_LocBnd);
+                        }
+                        F_Int = F_Int - C*V_LocBnd;
                     }
-                    F_Int = F_Int - C*V_LocBnd;
+                    Multiply( V_Int, invD, F_Int);
                 }
-                Multiply( V_Int, invD, F_Int);
             }
         }
 
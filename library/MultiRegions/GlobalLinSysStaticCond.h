@@ -84,6 +84,14 @@ namespace Nektar
                 
             }
 
+            /// Multiply a local boundary vector by the Schur complement
+            virtual void v_SchurComplMultiply(
+                const DNekScalBlkMatSharedPtr &pSchurCompl,
+                NekVector<NekDouble>          &pInOut)
+            {
+                pInOut = (*pSchurCompl)*pInOut;
+            }
+
             virtual void v_AssembleSchurComplement(
                 boost::shared_ptr<AssemblyMap> pLoctoGloMap)
             {
@@ -125,6 +133,13 @@ namespace Nektar
                 const Array<OneD, const NekDouble>  &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides.
+            virtual void v_SolveMultiple(
+                const Array<OneD, Array<OneD, const NekDouble> > &in,
+                      Array<OneD, Array<OneD,       NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const Array<OneD, Array<OneD, const NekDouble> > &dirForcing);
+
             virtual void v_InitObject();
 
             /// Initialise this object
@@ -142,6 +142,19 @@ namespace Nektar
             "FullLinearSpaceWithBlock"
         };
 
+        /// Type of Krylov method used by the iterative solvers.
+        enum IterativeSolverType
+        {
+            eConjugateGradient,
+            ePipelinedConjugateGradient
+        };
+
+        const char* const IterativeSolverTypeMap[] =
+        {
+            "ConjugateGradient",
+            "PipelinedConjugateGradient"
+        };
+
 
         // let's keep this for linking to external
         // sparse libraries
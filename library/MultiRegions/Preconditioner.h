@@ -43,6 +43,7 @@
 #include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/Communication/GsLib.hpp>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 #include <boost/shared_ptr.hpp>
 
@@ -208,6 +209,7 @@ namespace Nektar
             const Array<OneD, NekDouble> &pInput,
                   Array<OneD, NekDouble> &pOutput)
         {
+            LibUtilities::ProfileRegion region("Preconditioner");
 	    v_DoPreconditioner(pInput,pOutput);
         }
         
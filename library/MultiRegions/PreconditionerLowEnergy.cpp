@@ -966,6 +966,9 @@ namespace Nektar
            m_InvRTBlk      = MemoryManager<DNekScalBlkMat>
                ::AllocateSharedPtr(nbdry_size, nbdry_size , blkmatStorage);
 
+           map<LibUtilities::ShapeType, vector<unsigned int> > shapeBlocks;
+           m_blockOffsets = Array<OneD, unsigned int>(n_exp, 0U);
+
            for(n=0; n < n_exp; ++n)
            {
                nel = n;
@@ -973,6 +976,12 @@ namespace Nektar
                locExpansion = expList->GetExp(nel);
                LibUtilities::ShapeType eType=locExpansion->DetShapeType();
 
+               shapeBlocks[eType].push_back(n);
+               if (n > 0)
+               {
+                   m_blockOffsets[n] = m_blockOffsets[n-1] + nbdry_size[n-1];
+               }
+
                //Block R matrix
                m_RBlk->SetBlock(n,n, transmatrixmap[eType]);
 
@@ -985,7 +994,69 @@ namespace Nektar
                //Block inverse RT matrix
                m_InvRTBlk->SetBlock(n,n, invtransposedtransmatrixmap[eType]);
            }
+
+           // Elements of the same shape share the reference transformation
+           // matrices, so their blocks may be applied together.
+           m_blockGroups.clear();
+           map<LibUtilities::ShapeType, vector<unsigned int> >::iterator it;
+           for (it = shapeBlocks.begin(); it != shapeBlocks.end(); ++it)
+           {
+               m_blockGroups.push_back(it->second);
+           }
        }
+
+        /**
+         * \brief Multiply the local boundary vector by one of the block
+         * transformation matrices.
+         *
+         * All elements of the same shape use the same reference
+         * transformation matrix. The local boundary coefficients of each
+         * group of elements are gathered into the columns of a contiguous
+         * workspace, so that the shared matrix is applied to the whole group
+         * with a single matrix-matrix multiply, and then scattered back to
+         * @p pLocal.
+         */
+        void PreconditionerLowEnergy::MultiplyByBlockMatrix(
+            const DNekScalBlkMatSharedPtr &pBlkMat,
+            Array<OneD, NekDouble>        &pLocal)
+        {
+            for (int g = 0; g < m_blockGroups.size(); ++g)
+            {
+                const vector<unsigned int> &blocks = m_blockGroups[g];
+                const int nBlocks = blocks.size();
+
+                DNekScalMatSharedPtr mat =
+                    pBlkMat->GetBlock(blocks[0], blocks[0]);
+                const int rows = mat->GetRows();
+
+                ASSERTL1(mat->GetStorageType() == eFULL,
+                         "Transformation matrices must use full storage");
+
+                if (m_blockWsp.num_elements() < 2*rows*nBlocks)
+                {
+                    m_blockWsp = Array<OneD, NekDouble>(2*rows*nBlocks);
+                }
+
+                NekDouble *in  = m_blockWsp.get();
+                NekDouble *out = m_blockWsp.get() + rows*nBlocks;
+
+                for (int i = 0; i < nBlocks; ++i)
+                {
+                    Vmath::Vcopy(rows, &pLocal[m_blockOffsets[blocks[i]]], 1,
+                                       in + i*rows, 1);
+                }
+
+                Blas::Dgemm(mat->GetTransposeFlag(), 'N', rows, nBlocks, rows,
+                            mat->Scale(), mat->GetRawPtr(), rows,
+                            in, rows, 0.0, out, rows);
+
+                for (int i = 0; i < nBlocks; ++i)
+                {
+                    Vmath::Vcopy(rows, out + i*rows, 1,
+                                 &pLocal[m_blockOffsets[blocks[i]]], 1);
+                }
+            }
+        }
         
 
 
@@ -1009,9 +1080,6 @@ namespace Nektar
             NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,pInOut+offset,
                                           eWrapper);
 
-            //Block transformation matrix
-            DNekScalBlkMat &R = *m_RBlk;
-
             Array<OneD, NekDouble> pLocal(nLocBndDofs, 0.0);
             NekVector<NekDouble> F_LocBnd(nLocBndDofs,pLocal,eWrapper);
             m_map = m_locToGloMap->GetLocalToGlobalBndMap();
@@ -1024,7 +1092,7 @@ namespace Nektar
             Vmath::Gathr(m_map.num_elements(), m_locToGloSignMult.get(), tmp.get(), m_map.get(), pLocal.get());
 
             //Multiply by the block transformation matrix
-            F_LocBnd=R*F_LocBnd;
+            MultiplyByBlockMatrix(m_RBlk, pLocal);
 
             //Assemble local boundary to global non-dirichlet Dofs
             m_locToGloMap->AssembleBnd(F_LocBnd,F_HomBnd, nDirBndDofs);
@@ -1056,9 +1124,6 @@ namespace Nektar
             NekVector<NekDouble> F_GlobBnd(nGlobHomBndDofs,pInput,eWrapper);
             NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,pOutput,
                                           eWrapper);
-            //Block transformation matrix
-            DNekScalBlkMat &R = *m_RBlk;
-
             Array<OneD, NekDouble> pLocal(nLocBndDofs, 0.0);
             NekVector<NekDouble> F_LocBnd(nLocBndDofs,pLocal,eWrapper);
             m_map = m_locToGloMap->GetLocalToGlobalBndMap();
@@ -1073,7 +1138,7 @@ namespace Nektar
             Vmath::Gathr(m_map.num_elements(), m_locToGloSignMult.get(), tmp.get(), m_map.get(), pLocal.get());
 
             //Multiply by the block transformation matrix
-            F_LocBnd=R*F_LocBnd;
+            MultiplyByBlockMatrix(m_RBlk, pLocal);
 
             //Assemble local boundary to global non-dirichlet boundary
             m_locToGloMap->AssembleBnd(F_LocBnd,F_HomBnd,nDirBndDofs);
@@ -1099,9 +1164,6 @@ namespace Nektar
             ASSERTL1(pInOut.num_elements() >= nGlobBndDofs,
                      "Output array is greater than the nGlobBndDofs");
 
-            //Block transposed transformation matrix
-            DNekScalBlkMat &RT = *m_RTBlk;
-
             NekVector<NekDouble> V_GlobHomBnd(nGlobHomBndDofs,pInOut+nDirBndDofs,
                                               eWrapper);
 
@@ -1114,7 +1176,7 @@ namespace Nektar
             m_locToGloMap->GlobalToLocalBnd(V_GlobHomBnd,V_LocBnd, nDirBndDofs);
 
             //Multiply by the block transposed transformation matrix
-            V_LocBnd=RT*V_LocBnd;
+            MultiplyByBlockMatrix(m_RTBlk, pLocal);
 
 
             //Assemble local boundary to global boundary
@@ -1148,9 +1210,6 @@ namespace Nektar
             NekVector<NekDouble> F_GlobBnd(nGlobHomBndDofs,pInput,eWrapper);
             NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,pOutput,
                                           eWrapper);
-            //Block inverse transformation matrix
-            DNekScalBlkMat &invR = *m_InvRBlk;
-
             Array<OneD, NekDouble> pLocal(nLocBndDofs, 0.0);
             NekVector<NekDouble> F_LocBnd(nLocBndDofs,pLocal,eWrapper);
             m_map = m_locToGloMap->GetLocalToGlobalBndMap();
@@ -1165,7 +1224,7 @@ namespace Nektar
             Vmath::Gathr(m_map.num_elements(), m_locToGloSignMult.get(), tmp.get(), m_map.get(), pLocal.get());
 
             //Multiply by block inverse transformation matrix
-            F_LocBnd=invR*F_LocBnd;
+            MultiplyByBlockMatrix(m_InvRBlk, pLocal);
 
             //Assemble local boundary to global non-dirichlet boundary
             m_locToGloMap->AssembleBnd(F_LocBnd,F_HomBnd,nDirBndDofs);
@@ -1193,9 +1252,6 @@ namespace Nektar
             NekVector<NekDouble> F_GlobBnd(nGlobHomBndDofs,pInput,eWrapper);
             NekVector<NekDouble> F_HomBnd(nGlobHomBndDofs,pOutput,
                                           eWrapper);
-            //Block inverse transformation matrix
-            DNekScalBlkMat &invRT = *m_InvRTBlk;
-
             Array<OneD, NekDouble> pLocal(nLocBndDofs, 0.0);
             NekVector<NekDouble> F_LocBnd(nLocBndDofs,pLocal,eWrapper);
             m_map = m_locToGloMap->GetLocalToGlobalBndMap();
@@ -1203,7 +1259,7 @@ namespace Nektar
             m_locToGloMap->GlobalToLocalBnd(pInput,pLocal, nDirBndDofs);
 
             //Multiply by the block transposed transformation matrix
-            F_LocBnd=invRT*F_LocBnd;
+            MultiplyByBlockMatrix(m_InvRTBlk, pLocal);
 
             m_locToGloMap->AssembleBnd(pLocal,pOutput, nDirBndDofs);
 
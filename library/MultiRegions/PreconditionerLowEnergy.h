@@ -106,6 +106,14 @@ namespace Nektar
             Array<OneD, NekDouble>  m_multiplicity;
             Array<OneD, int>        m_map;
 
+            /// Blocks of the transformation matrices which share the same
+            /// reference matrix, grouped by element shape
+            std::vector<std::vector<unsigned int> > m_blockGroups;
+            /// Offset of each block in the local boundary vector
+            Array<OneD, unsigned int> m_blockOffsets;
+            /// Workspace for the batched block multiplication
+            Array<OneD, NekDouble>  m_blockWsp;
+
 	private:
 
             void SetUpReferenceElements(void);
@@ -114,6 +122,10 @@ namespace Nektar
 
             void SetupBlockTransformationMatrix(void);
 
+            void MultiplyByBlockMatrix(
+                const DNekScalBlkMatSharedPtr &pBlkMat,
+                Array<OneD, NekDouble>        &pLocal);
+
             void ModifyPrismTransformationMatrix(
                 LocalRegions::TetExpSharedPtr TetExp,
                 LocalRegions::PrismExpSharedPtr PrismExp,
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Advection/Advection.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 namespace Nektar
 {
@@ -83,6 +84,7 @@ void Advection::Advect(
     const Array<OneD, Array<OneD, NekDouble> >        &pFwd,
     const Array<OneD, Array<OneD, NekDouble> >        &pBwd)
 {
+    LibUtilities::ProfileRegion region("Advection");
     v_Advect(nConvectiveFields, pFields, pAdvVel, pInarray,
             pOutarray, pTime, pFwd, pBwd);
 }
@@ -106,21 +106,15 @@ namespace Nektar
             ASSERTL1(m_riemann,
                      "Riemann solver must be provided for AdvectionWeakDG.");
 
-            m_fluxVector(inarray, fluxvector);
-
-            // Get the advection part (without numerical flux)
-            for(i = 0; i < nConvectiveFields; ++i)
-            {
-                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
-
-                fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
-            }
-
             // Store forwards/backwards space along trace space
             Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
 
+            // Start the exchange of the trace between processes, which is
+            // overlapped with the evaluation of the volume terms. If the
+            // trace was given, the caller may also have left its exchange
+            // in progress.
             if (pFwd == NullNekDoubleArrayofArray ||
                 pBwd == NullNekDoubleArrayofArray)
             {
@@ -129,7 +123,8 @@ namespace Nektar
                     Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                     Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                     numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                    fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                    fields[i]->BeginFwdBwdTracePhys(
+                        inarray[i], Fwd[i], Bwd[i]);
                 }
             }
             else
@@ -142,6 +137,22 @@ namespace Nektar
                 }
             }
 
+            m_fluxVector(inarray, fluxvector);
+
+            // Get the advection part (without numerical flux)
+            for(i = 0; i < nConvectiveFields; ++i)
+            {
+                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
+
+                fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
+            }
+
+            // Complete the trace exchange
+            for(i = 0; i < nConvectiveFields; ++i)
+            {
+                fields[i]->EndFwdBwdTracePhys();
+            }
+
             m_riemann->Solve(m_spaceDim, Fwd, Bwd, numflux);
 
             // Evaulate <\phi, \hat{F}\cdot n> - OutField[i]
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Diffusion/Diffusion.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 namespace Nektar
 {
@@ -63,6 +64,7 @@ namespace Nektar
             const Array<OneD, Array<OneD, NekDouble> >        &pFwd,
             const Array<OneD, Array<OneD, NekDouble> >        &pBwd)
         {
+            LibUtilities::ProfileRegion region("Diffusion");
             v_Diffuse(nConvectiveFields, fields, inarray, outarray, pFwd, pBwd);
         }
     }
@@ -84,7 +84,7 @@ namespace Nektar
             int nCoeffs   = fields[0]->GetNcoeffs();
             int nTracePts = fields[0]->GetTrace()->GetTotPoints();
             
-            Array<OneD, NekDouble>  qcoeffs(nCoeffs);
+            Array<OneD, Array<OneD, Array<OneD, NekDouble> > > qcoeffs(nDim);
 
             Array<OneD, Array<OneD, NekDouble> > fluxvector(nDim);
 
@@ -114,21 +114,59 @@ namespace Nektar
                 fluxvector[k] = Array<OneD, NekDouble>(nPts, 0.0);
             }
                         
+            // Start the exchange of the trace between processes, which is
+            // overlapped with the evaluation of the volume terms.
+            Array<OneD, Array<OneD, NekDouble> > Fwd = pFwd;
+            Array<OneD, Array<OneD, NekDouble> > Bwd = pBwd;
+
+            if (pFwd == NullNekDoubleArrayofArray ||
+                pBwd == NullNekDoubleArrayofArray)
+            {
+                Fwd = Array<OneD, Array<OneD, NekDouble> >(nConvectiveFields);
+                Bwd = Array<OneD, Array<OneD, NekDouble> >(nConvectiveFields);
+
+                for (i = 0; i < nConvectiveFields; ++i)
+                {
+                    Fwd[i] = Array<OneD, NekDouble>(nTracePts, 0.0);
+                    Bwd[i] = Array<OneD, NekDouble>(nTracePts, 0.0);
+                    fields[i]->BeginFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                }
+            }
+
+            for (j = 0; j < nDim; ++j)
+            {
+                qcoeffs[j] = Array<OneD, Array<OneD, NekDouble> >(
+                    nConvectiveFields);
+
+                for (i = 0; i < nConvectiveFields; ++i)
+                {
+                    qcoeffs[j][i] = Array<OneD, NekDouble>(nCoeffs);
+                    fields[i]->IProductWRTDerivBase(j, inarray[i],
+                                                    qcoeffs[j][i]);
+                }
+            }
+
+            for (i = 0; i < nConvectiveFields; ++i)
+            {
+                fields[i]->EndFwdBwdTracePhys();
+            }
+
             // Compute q_{\eta} and q_{\xi}
             // Obtain numerical fluxes
 
-            v_NumFluxforScalar(fields, inarray, flux, pFwd, pBwd);
+            v_NumFluxforScalar(fields, inarray, flux, Fwd, Bwd);
 
             for (j = 0; j < nDim; ++j)
             {
                 for (i = 0; i < nConvectiveFields; ++i)
                 {
-                    fields[i]->IProductWRTDerivBase(j, inarray[i], qcoeffs);
-                    Vmath::Neg                      (nCoeffs, qcoeffs, 1);
-                    fields[i]->AddTraceIntegral     (flux[j][i], qcoeffs);
+                    Vmath::Neg                      (nCoeffs, qcoeffs[j][i], 1);
+                    fields[i]->AddTraceIntegral     (flux[j][i], qcoeffs[j][i]);
                     fields[i]->SetPhysState         (false);
-                    fields[i]->MultiplyByElmtInvMass(qcoeffs, qcoeffs);
-                    fields[i]->BwdTrans             (qcoeffs, qfield[j][i]);
+                    fields[i]->MultiplyByElmtInvMass(qcoeffs[j][i],
+                                                     qcoeffs[j][i]);
+                    fields[i]->BwdTrans             (qcoeffs[j][i],
+                                                     qfield[j][i]);
                 }
             }
             // Compute u from q_{\eta} and q_{\xi}
@@ -38,6 +38,8 @@
 
 #include <LocalRegions/MatrixKey.h>
 #include <LibUtilities/BasicUtils/Equation.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <Collections/CollectionOptimisation.h>
 #include <MultiRegions/ContField1D.h>
 #include <MultiRegions/ContField2D.h>
 #include <MultiRegions/ContField3D.h>
@@ -124,6 +126,7 @@ namespace Nektar
 
             // Instantiate a field reader/writer
             m_fld = LibUtilities::FieldIO::CreateDefault(m_session);
+            m_session->MatchSolverInfo("IOAsync", "True", m_asyncIO, false);
 
             // Read the geometry and the expansion information
             m_graph = SpatialDomains::MeshGraph::Read(m_session);
@@ -652,6 +655,31 @@ namespace Nektar
                 m_fields[0]->GetTrace()->GetNormals(m_traceNormals);
             }
 
+            // Every process reaches this point once its fields are set up,
+            // so agree here on the autotuned collection implementations and
+            // set up the collections of the fields again with them. Other
+            // expansion lists keep the implementations selected locally.
+            Collections::CollectionOptimisation colOpt(
+                m_session, Collections::eNoImpType);
+            if (colOpt.IsUsingAutotuning() && colOpt.SynchroniseTimings())
+            {
+                for (i = 0; i < m_fields.num_elements(); ++i)
+                {
+                    if (m_HomogeneousType == eHomogeneous1D)
+                    {
+                        int nplanes = m_fields[i]->GetZIDs().num_elements();
+                        for (int n = 0; n < nplanes; ++n)
+                        {
+                            m_fields[i]->GetPlane(n)->CreateCollections();
+                        }
+                    }
+                    else if (m_HomogeneousType == eNotHomogeneous)
+                    {
+                        m_fields[i]->CreateCollections();
+                    }
+                }
+            }
+
             // Set Default Parameter
             m_session->LoadParameter("Time",          m_time,       0.0);
             m_session->LoadParameter("TimeStep",      m_timestep,   0.01);
@@ -2220,6 +2248,8 @@ namespace Nektar
             std::vector<Array<OneD, NekDouble> > &fieldcoeffs,
             std::vector<std::string>             &variables)
         {
+            LibUtilities::ProfileRegion region("WriteFld");
+
             std::vector<LibUtilities::FieldDefinitionsSharedPtr> FieldDef
                 = field->GetFieldDefinitions();
             std::vector<std::vector<NekDouble> > FieldData(FieldDef.size());
@@ -2257,7 +2287,16 @@ namespace Nektar
             LibUtilities::FieldMetaDataMap fieldMetaDataMap(m_fieldMetaDataMap);
             mapping->Output( fieldMetaDataMap, outname);
 
-            m_fld->Write(outname, FieldDef, FieldData, fieldMetaDataMap, true);
+            if (m_asyncIO)
+            {
+                m_fld->WriteAsync(outname, FieldDef, FieldData,
+                                  fieldMetaDataMap, true);
+            }
+            else
+            {
+                m_fld->Write(outname, FieldDef, FieldData, fieldMetaDataMap,
+                             true);
+            }
         }
 
 
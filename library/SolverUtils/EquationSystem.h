@@ -458,6 +458,8 @@ namespace Nektar
             LibUtilities::SessionReaderSharedPtr        m_session;
             /// Field input/output
             LibUtilities::FieldIOSharedPtr              m_fld;
+            /// Write output files asynchronously
+            bool                                        m_asyncIO;
             /// Map of interpolator objects
             std::map<std::string, FieldUtils::Interpolator > m_interpolators;
             /// pts fields we already read from disk: {funcFilename: (filename, ptsfield)}
@@ -756,6 +758,7 @@ namespace Nektar
         inline void EquationSystem::Output(void)
         {
             v_Output();
+            m_fld->WaitForWrite();
         }
         
         /**
@@ -69,6 +69,7 @@ FilterCheckpoint::FilterCheckpoint(
     m_outputFrequency = floor(equ.Evaluate());
 
     m_fld = LibUtilities::FieldIO::CreateDefault(pSession);
+    m_session->MatchSolverInfo("IOAsync", "True", m_asyncIO, false);
 }
 
 FilterCheckpoint::~FilterCheckpoint()
@@ -113,7 +114,14 @@ void FilterCheckpoint::v_Update(
                                         pFields[j]->UpdateCoeffs());
         }
     }
-    m_fld->Write(vOutputFilename.str(),FieldDef,FieldData);
+    if (m_asyncIO)
+    {
+        m_fld->WriteAsync(vOutputFilename.str(), FieldDef, FieldData);
+    }
+    else
+    {
+        m_fld->Write(vOutputFilename.str(), FieldDef, FieldData);
+    }
     m_outputIndex++;
 }
 
@@ -121,7 +129,7 @@ void FilterCheckpoint::v_Finalise(
         const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields,
         const NekDouble &time)
 {
-
+    m_fld->WaitForWrite();
 }
 
 bool FilterCheckpoint::v_IsTimeDependent()
@@ -33,10 +33,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <algorithm>
 #include <iomanip>
+#include <map>
+
+#include <LibUtilities/Memory/NekMemoryManager.hpp>
 #include <SolverUtils/Filters/FilterHistoryPoints.h>
-#include <MultiRegions/ExpList3DHomogeneous1D.h>
 
 #include <boost/format.hpp>
 
@@ -115,6 +117,34 @@ FilterHistoryPoints::FilterHistoryPoints(
         }
     }
 
+    // OutputFormat
+    it = pParams.find("OutputFormat");
+    if (it == pParams.end())
+    {
+        m_outputBinary = false;
+    }
+    else
+    {
+        ASSERTL0(boost::iequals(it->second, "Ascii") ||
+                 boost::iequals(it->second, "Binary"),
+                 "OutputFormat should be Ascii or Binary.");
+        m_outputBinary = boost::iequals(it->second, "Binary");
+    }
+
+    // OutputBufferSize
+    it = pParams.find("OutputBufferSize");
+    if (it == pParams.end())
+    {
+        m_outputBufferSize = 1;
+    }
+    else
+    {
+        LibUtilities::Equation equ(m_session, it->second);
+        m_outputBufferSize = floor(equ.Evaluate());
+        ASSERTL0(m_outputBufferSize > 0,
+                 "OutputBufferSize should be at least 1.");
+    }
+
     // Points
     it = pParams.find("Points");
     ASSERTL0(it != pParams.end(), "Missing parameter 'Points'.");
@@ -143,12 +173,15 @@ void FilterHistoryPoints::v_Initialise(
              "No history points in stream.");
 
     m_index = 0;
-    m_historyList.clear();
+    m_outputBuffer.clear();
 
     vector<unsigned int> planeIDs;
     // Read history points
     Array<OneD, NekDouble>  gloCoord(3,0.0);
-    int dim = pFields[0]->GetGraph()->GetSpaceDimension();
+    // Homogeneous fields which are not continuous have no mesh graph, so
+    // their dimension is taken from that of their elements.
+    SpatialDomains::MeshGraphSharedPtr graph = pFields[0]->GetGraph();
+    int dim = graph ? graph->GetSpaceDimension() : pFields[0]->GetCoordim(0);
     if (m_isHomogeneous1D)
     {
         dim++;
@@ -214,26 +247,44 @@ void FilterHistoryPoints::v_Initialise(
     Array<OneD, NekDouble> dist_loc(vHP,  1e16);
     std::vector<Array<OneD, NekDouble> > LocCoords;
 
+    // Determine the expansion and local coordinates of all points at once
+    Array<OneD, Array<OneD, NekDouble> > gloCoords(3);
+    Array<OneD, Array<OneD, NekDouble> > locCoordsAll;
+    for (int j = 0; j < 3; ++j)
+    {
+        gloCoords[j] = Array<OneD, NekDouble>(vHP);
+    }
+    for (i = 0; i < vHP; ++i)
+    {
+        m_historyPoints[i]->GetCoords(gloCoords[0][i],
+                                      gloCoords[1][i],
+                                      gloCoords[2][i]);
+    }
+
+    if (m_isHomogeneous1D)
+    {
+        pFields[0]->GetPlane(0)->GetExpIndex(gloCoords, idList, locCoordsAll,
+                                             NekConstants::kNekZeroTol);
+    }
+    else
+    {
+        pFields[0]->GetExpIndex(gloCoords, idList, locCoordsAll,
+                                NekConstants::kNekZeroTol);
+    }
+
     // Find the nearest element on this process to which the history
     // point could belong and note down the distance from the element
     // and the process ID.
     for (i = 0; i < vHP; ++i)
     {
-        Array<OneD, NekDouble> locCoords(3);
-        m_historyPoints[i]->GetCoords(  gloCoord[0],
-                                        gloCoord[1],
-                                        gloCoord[2]);
-
-        // Determine the expansion and local coordinates
-        if (m_isHomogeneous1D)
+        Array<OneD, NekDouble> locCoords(3, 0.0);
+        for (int j = 0; j < locCoordsAll.num_elements(); ++j)
         {
-            idList[i] = pFields[0]->GetPlane(0)->GetExpIndex(gloCoord,locCoords,
-                                        NekConstants::kNekZeroTol);
+            locCoords[j] = locCoordsAll[j][i];
         }
-        else
+        for (int j = 0; j < 3; ++j)
         {
-            idList[i] = pFields[0]->GetExpIndex(gloCoord,locCoords,
-                                        NekConstants::kNekZeroTol);
+            gloCoord[j] = gloCoords[j][i];
         }
 
         // Save Local coordinates for later
@@ -314,6 +365,8 @@ void FilterHistoryPoints::v_Initialise(
 
     // Determine the element in which each history point resides.
     // If point is not in mesh (on this process), id is -1.
+    map<int, vector<int> > elmtPoints;
+    int nPlan = 0;
     for (i = 0; i < vHP; ++i)
     {
         // If point lies on partition boundary, only the proc with max
@@ -323,18 +376,97 @@ void FilterHistoryPoints::v_Initialise(
             idList[i] = -1;
         }
 
-        // If the current process owns this history point, add it to its
-        // local list of history points.
+        // If the current process owns this history point, add it to the
+        // points of its element.
         if (idList[i] != -1)
         {
-            m_historyLocalPointMap[m_historyList.size()] = i;
-            m_historyList.push_back(
-                     std::pair<SpatialDomains::PointGeomSharedPtr,
-                                              Array<OneD, NekDouble> >
-                              (m_historyPoints[i], LocCoords[i]));
+            elmtPoints[idList[i]].push_back(i);
+            ++nPlan;
         }
     }
 
+    // Build the evaluation plan of the history points of this process,
+    // grouped by element, so that each update only applies the
+    // precomputed interpolation weights.
+    MultiRegions::ExpListSharedPtr exp = m_isHomogeneous1D ?
+        pFields[0]->GetPlane(0) : pFields[0];
+    int nElmts = elmtPoints.size();
+
+    m_planElmts   = Array<OneD, int>(nElmts);
+    m_planOffsets = Array<OneD, int>(nElmts + 1, 0);
+    m_planWeights = Array<OneD, Array<OneD, NekDouble> >(nElmts);
+    m_planPoints  = Array<OneD, int>(nPlan);
+    m_planPlanes  = Array<OneD, int>(nPlan, 0);
+    m_planFourier = Array<OneD, Array<OneD, NekDouble> >(nPlan);
+
+    map<int, vector<int> >::iterator it;
+    for (i = 0, it = elmtPoints.begin(); it != elmtPoints.end(); ++it, ++i)
+    {
+        int n = it->second.size();
+
+        m_planElmts[i]       = it->first;
+        m_planOffsets[i + 1] = m_planOffsets[i] + n;
+
+        Array<OneD, Array<OneD, NekDouble> > elmtCoords(3);
+        for (int d = 0; d < 3; ++d)
+        {
+            elmtCoords[d] = Array<OneD, NekDouble>(n);
+        }
+
+        for (int j = 0; j < n; ++j)
+        {
+            int p  = m_planOffsets[i] + j;
+            int pt = it->second[j];
+
+            m_planPoints[p] = pt;
+            for (int d = 0; d < 3; ++d)
+            {
+                elmtCoords[d][j] = LocCoords[pt][d];
+            }
+
+            if (m_isHomogeneous1D)
+            {
+                // Values of the local Fourier modes at the plane of the
+                // point, used when the field is in wave space.
+                LibUtilities::BasisSharedPtr homBasis =
+                    pFields[0]->GetHomogeneousBasis();
+                Array<OneD, const unsigned int> zIDs = pFields[0]->GetZIDs();
+                const Array<OneD, const NekDouble> &bdata =
+                    homBasis->GetBdata();
+                int nq = homBasis->GetNumPoints();
+
+                m_planPlanes[p]  = m_planeIDs[pt];
+                m_planFourier[p] = Array<OneD, NekDouble>(zIDs.num_elements());
+                for (int k = 0; k < zIDs.num_elements(); ++k)
+                {
+                    m_planFourier[p][k] = bdata[zIDs[k] * nq + planeIDs[pt]];
+                }
+            }
+        }
+
+        exp->GetExp(it->first)->StdPhysEvaluateWeights(
+            n, elmtCoords, m_planWeights[i]);
+    }
+
+    // Gather the history points evaluated by each process on the root
+    // process, which assembles the output.
+    Array<OneD, int> nLocal(1, nPlan);
+    Array<OneD, int> gatherOffsets;
+    m_gatherSizes = vComm->Gather(0, nLocal);
+    if (vComm->GetRank() == 0)
+    {
+        int nProcs = vComm->GetSize();
+        gatherOffsets = Array<OneD, int>(nProcs, 0);
+        for (i = 1; i < nProcs; ++i)
+        {
+            gatherOffsets[i] = gatherOffsets[i - 1] + m_gatherSizes[i - 1];
+        }
+        m_gatherPoints = Array<OneD, int>(
+            gatherOffsets[nProcs - 1] + m_gatherSizes[nProcs - 1]);
+    }
+    vComm->Gatherv(m_planPoints, m_gatherPoints, m_gatherSizes,
+                   gatherOffsets, 0);
+
     // Collate the element ID list across processes and check each
     // history point is allocated to a process
     vComm->AllReduce(idList, LibUtilities::ReduceMax);
@@ -371,14 +503,16 @@ void FilterHistoryPoints::v_Initialise(
         bool adaptive;
         m_session->MatchSolverInfo("Driver", "Adaptive",
                                     adaptive, false);
-        if (adaptive)
+        ios_base::openmode mode = ofstream::out;
+        if (m_outputBinary)
         {
-            m_outputStream.open(m_outputFile.c_str(), ofstream::app);
+            mode |= ofstream::binary;
         }
-        else
+        if (adaptive)
         {
-            m_outputStream.open(m_outputFile.c_str());
+            mode |= ofstream::app;
         }
+        m_outputStream.open(m_outputFile.c_str(), mode);
         m_outputStream << "# History data for variables (:";
 
         for (i = 0; i < pFields.num_elements(); ++i)
@@ -415,6 +549,13 @@ void FilterHistoryPoints::v_Initialise(
                 m_outputStream << "# (in Wavespace)" << endl;
             }
         }
+
+        if (m_outputBinary)
+        {
+            m_outputStream << "# Binary data: for each output, the time "
+                           << "followed by the variables at each point"
+                           << endl;
+        }
     }
     v_Update(pFields, time);
 }
@@ -431,170 +572,263 @@ void FilterHistoryPoints::v_Update(const Array<OneD, const MultiRegions::ExpList
         return;
     }
 
-    int j         = 0;
-    int k         = 0;
-    int numPoints = m_historyPoints.size();
     int numFields = pFields.num_elements();
-    LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
-    Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
-    std::list<std::pair<SpatialDomains::PointGeomSharedPtr, Array<OneD, NekDouble> > >::iterator x;
-
-    Array<OneD, NekDouble> physvals;
-    Array<OneD, NekDouble> locCoord;
-    int expId;
+    int nPlan     = m_planPoints.num_elements();
+    Array<OneD, NekDouble> values(nPlan * numFields);
+    Array<OneD, NekDouble> fieldValues(nPlan);
 
     // Pull out data values field by field
-    for (j = 0; j < numFields; ++j)
+    for (int j = 0; j < numFields; ++j)
     {
-        if(m_isHomogeneous1D)
+        bool fourier = false;
+        if (m_isHomogeneous1D)
         {
-            for (k = 0, x = m_historyList.begin(); x != m_historyList.end();
-                 ++x, ++k)
+            if (m_waveSpace)
             {
-                locCoord = (*x).second;
-                expId    = (*x).first->GetVid();
-                NekDouble value;
-                int plane = m_planeIDs[m_historyLocalPointMap[k]];
+                ASSERTL0(pFields[j]->GetWaveSpace() == true,
+                         "HistoryPoints in wavespace require that solution "
+                         "is in wavespace");
+            }
+            fourier = pFields[j]->GetWaveSpace() && !m_waveSpace;
+        }
 
-                if (m_waveSpace)
-                {
-                    ASSERTL0( pFields[j]->GetWaveSpace() == true,
-                        "HistoryPoints in wavespace require that solution is in wavespace");
-                }
-                if ( pFields[j]->GetWaveSpace() == false || m_waveSpace)
-                {
-                    if (plane != -1)
-                    {
-                        physvals = pFields[j]->GetPlane(plane)->
-                                   UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-
-                        // transform elemental data if required.
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetPlane(plane)->GetExp(expId)->
-                                      BwdTrans(pFields[j]->GetPlane(plane)->
-                                      GetCoeffs() + pFields[j]->
-                                      GetCoeff_Offset(expId),physvals);
-                        }
-                        // Interpolate data
-                        value = pFields[j]->GetPlane(plane)->GetExp(expId)->
-                                StdPhysEvaluate(locCoord,physvals);
-                    }
-                }
-                else
-                {
-                    // Create vector with eIDs across all planes
-                    std::vector<unsigned int> eIDs;
-                    int nPlanes = pFields[j]->GetZIDs().num_elements();
-                    int elmtsPerPlane = pFields[j]->GetExpSize()/nPlanes;
+        Array<OneD, const NekDouble> phys = pFields[j]->GetPhys();
 
-                    for ( int n = 0; n < nPlanes; n++)
-                    {
-                        eIDs.push_back(expId + n*elmtsPerPlane);
-                    }
+        // Transform the elements of the plan if required.
+        if (pFields[j]->GetPhysState() == false)
+        {
+            int nPlanes = m_isHomogeneous1D ?
+                pFields[j]->GetZIDs().num_elements() : 1;
+            int nppp    = m_isHomogeneous1D ?
+                pFields[j]->GetPlane(0)->GetTotPoints() : 0;
 
-                    // Create new 3DH1D expansion with one element per plane
-                    MultiRegions::ExpList3DHomogeneous1DSharedPtr tmp =
-                            boost::dynamic_pointer_cast<MultiRegions::
-                            ExpList3DHomogeneous1D>(pFields[j]);
-                    ASSERTL0(tmp,"Failed to type cast expansion");
-
-                    MultiRegions::ExpList3DHomogeneous1DSharedPtr exp =
-                            MemoryManager<MultiRegions::
-                                ExpList3DHomogeneous1D>::
-                                AllocateSharedPtr(*tmp, eIDs);
-                    // Fill phys array of new expansion and apply HomoBwdTrans
-                    for ( int n = 0; n < nPlanes; n++)
-                    {
-                        Array<OneD, NekDouble> toPhys =
-                                exp->GetPlane(n)->UpdatePhys();
-                        if(pFields[j]->GetPhysState())
-                        {
-                            int nq = exp->GetPlane(0)->GetTotPoints();
-                            Array<OneD, NekDouble> fromPhys =
-                                    pFields[j]->GetPlane(n)->GetPhys() +
-                                    pFields[j]->GetPhys_Offset(expId);
-                            Vmath::Vcopy(nq, fromPhys, 1, toPhys, 1);
-                        }
-                        else
-                        {
-                            Array<OneD, NekDouble> fromCoeffs =
-                                    pFields[j]->GetPlane(n)->GetCoeffs() +
-                                    pFields[j]->GetCoeff_Offset(expId);
-                            exp->GetPlane(n)->GetExp(0)->
-                                      BwdTrans(fromCoeffs, toPhys);
-                        }
-                    }
-                    exp->HomogeneousBwdTrans(exp->GetPhys(), exp->UpdatePhys());
-                    // Interpolate data
-                    if (plane != -1)
-                    {
-                        physvals = exp->GetPlane(plane)->UpdatePhys();
+            if (m_physWsp.num_elements() != pFields[j]->GetTotPoints())
+            {
+                m_physWsp = Array<OneD, NekDouble>(
+                    pFields[j]->GetTotPoints(), 0.0);
+            }
 
-                        value = exp->GetPlane(plane)->GetExp(0)->
-                            StdPhysEvaluate(locCoord,physvals);
-                    }
-                }
+            for (int n = 0; n < nPlanes; ++n)
+            {
+                MultiRegions::ExpListSharedPtr plane = m_isHomogeneous1D ?
+                    pFields[j]->GetPlane(n) : pFields[j];
 
-                // store data
-                if (plane != -1)
+                for (int e = 0; e < m_planElmts.num_elements(); ++e)
                 {
-                    data[m_historyLocalPointMap[k]*numFields+j] = value;
+                    int id = m_planElmts[e];
+                    Array<OneD, NekDouble> tmp = m_physWsp + n * nppp +
+                        plane->GetPhys_Offset(id);
+                    plane->GetExp(id)->BwdTrans(
+                        plane->GetCoeffs() + plane->GetCoeff_Offset(id), tmp);
                 }
             }
+            phys = m_physWsp;
         }
-        else
+
+        EvaluatePlan(pFields[j], phys, fourier, fieldValues);
+        Vmath::Vcopy(nPlan, fieldValues.get(), 1, values.get() + j,
+                     numFields);
+    }
+
+    OutputData(pFields[0]->GetComm(), time, numFields, values);
+}
+
+
+/**
+ *
+ */
+void FilterHistoryPoints::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+{
+    if (pFields[0]->GetComm()->GetRank() == 0)
+    {
+        WriteBuffer();
+        m_outputStream.close();
+    }
+}
+
+
+/**
+ * @brief Evaluate a field at the history points of the plan of this
+ * process.
+ *
+ * @param pField    Field on which the plan was built.
+ * @param pPhys     Values of the field at its quadrature points. For
+ *                  homogeneous expansions, the planes may be in wave space.
+ * @param pFourier  If true, the planes of @p pPhys are Fourier modes, which
+ *                  are summed with the Fourier weights of each point, so that
+ *                  the values of the processes holding the other modes must be
+ *                  added to obtain the value at the point. Otherwise, the
+ *                  point is evaluated on its own plane only.
+ * @param pValues   Value at each point of the plan.
+ */
+void FilterHistoryPoints::EvaluatePlan(
+    const MultiRegions::ExpListSharedPtr &pField,
+    const Array<OneD, const NekDouble>   &pPhys,
+    const bool                            pFourier,
+    Array<OneD, NekDouble>               &pValues)
+{
+    MultiRegions::ExpListSharedPtr exp = m_isHomogeneous1D ?
+        pField->GetPlane(0) : pField;
+    int nPlanes = m_isHomogeneous1D ? pField->GetZIDs().num_elements() : 1;
+    int nppp    = exp->GetTotPoints();
+    int nPlan   = m_planPoints.num_elements();
+
+    Array<OneD, NekDouble> wsp(nPlan);
+    Vmath::Zero(nPlan, pValues, 1);
+
+    for (int e = 0; e < m_planElmts.num_elements(); ++e)
+    {
+        int id     = m_planElmts[e];
+        int start  = m_planOffsets[e];
+        int n      = m_planOffsets[e + 1] - start;
+        int offset = exp->GetPhys_Offset(id);
+
+        for (int k = 0; k < nPlanes; ++k)
         {
-            for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); ++x, ++k)
+            if (!pFourier &&
+                find(&m_planPlanes[start], &m_planPlanes[start] + n, k) ==
+                    &m_planPlanes[start] + n)
             {
-                locCoord = (*x).second;
-                expId    = (*x).first->GetVid();
+                continue;
+            }
 
-                physvals = pFields[j]->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
+            exp->GetExp(id)->StdPhysEvaluate(
+                n, m_planWeights[e], pPhys + k * nppp + offset, wsp);
 
-                // transform elemental data if required.
-                if(pFields[j]->GetPhysState() == false)
+            for (int i = 0; i < n; ++i)
+            {
+                int p = start + i;
+                if (pFourier)
                 {
-                    pFields[j]->GetExp(expId)->BwdTrans(pFields[j]->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
+                    pValues[p] += m_planFourier[p][k] * wsp[i];
                 }
+                else if (m_planPlanes[p] == k)
+                {
+                    pValues[p] = wsp[i];
+                }
+            }
+        }
+    }
+}
+
 
-                // interpolate point
-                data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
+/**
+ * @brief Gather the values of the history points of all processes on the
+ * root process, and add them to the output buffer.
+ *
+ * @param pComm      Communicator on which the plan was built.
+ * @param time       Time of the output.
+ * @param numFields  Number of values at each point.
+ * @param pValues    Values at the points of the plan, with the values of each
+ *                   point stored contiguously.
+ */
+void FilterHistoryPoints::OutputData(
+    const LibUtilities::CommSharedPtr &pComm,
+    const NekDouble                    time,
+    const int                          numFields,
+    Array<OneD, NekDouble>            &pValues)
+{
+    int nProcs = pComm->GetSize();
+    int i, j;
+
+    Array<OneD, NekDouble> recvValues;
+    Array<OneD, int>       recvSizes, recvOffsets;
+
+    if (pComm->GetRank() == 0)
+    {
+        recvSizes   = Array<OneD, int>(nProcs);
+        recvOffsets = Array<OneD, int>(nProcs, 0);
+        for (i = 0; i < nProcs; ++i)
+        {
+            recvSizes[i] = m_gatherSizes[i] * numFields;
+            if (i > 0)
+            {
+                recvOffsets[i] = recvOffsets[i - 1] + recvSizes[i - 1];
             }
         }
+        recvValues = Array<OneD, NekDouble>(
+            m_gatherPoints.num_elements() * numFields);
     }
 
-    // Exchange history data
-    // This could be improved to reduce communication but works for now
-    vComm->AllReduce(data, LibUtilities::ReduceSum);
+    pComm->Gatherv(pValues, recvValues, recvSizes, recvOffsets, 0);
 
     // Only the root process writes out history data
-    if (vComm->GetRank() == 0)
+    if (pComm->GetRank() > 0)
     {
+        return;
+    }
+
+    // The value of a point of a homogeneous expansion may be the sum of the
+    // contributions of several processes.
+    int numPoints  = m_historyPoints.size();
+    int recordSize = 1 + numPoints * numFields;
+    int start      = m_outputBuffer.size();
+
+    m_outputNumFields = numFields;
+    m_outputBuffer.resize(start + recordSize, 0.0);
+    m_outputBuffer[start] = time;
 
-        // Write data values point by point
-        for (k = 0; k < m_historyPoints.size(); ++k)
+    NekDouble *data = &m_outputBuffer[start + 1];
+    for (i = 0; i < m_gatherPoints.num_elements(); ++i)
+    {
+        for (j = 0; j < numFields; ++j)
         {
-            m_outputStream << boost::format("%25.19e") % time;
-            for (int j = 0; j < numFields; ++j)
-            {
-                m_outputStream << " " << boost::format("%25.19e") % data[k*numFields+j];
-            }
-            m_outputStream << endl;
+            data[m_gatherPoints[i] * numFields + j] +=
+                recvValues[i * numFields + j];
         }
     }
+
+    if (m_outputBuffer.size() >= m_outputBufferSize * recordSize)
+    {
+        WriteBuffer();
+    }
 }
 
 
 /**
+ * @brief Write the buffered outputs to the output file.
  *
+ * In ascii format, a line is written for each output and point, containing
+ * the time followed by the variables. In binary format, each output is
+ * written as the time followed by the variables at each point.
  */
-void FilterHistoryPoints::v_Finalise(const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields, const NekDouble &time)
+void FilterHistoryPoints::WriteBuffer()
 {
-    if (pFields[0]->GetComm()->GetRank() == 0)
+    if (m_outputBuffer.empty())
     {
-        m_outputStream.close();
+        return;
+    }
+
+    if (m_outputBinary)
+    {
+        m_outputStream.write(
+            reinterpret_cast<const char *>(&m_outputBuffer[0]),
+            m_outputBuffer.size() * sizeof(NekDouble));
+    }
+    else
+    {
+        int numPoints  = m_historyPoints.size();
+        int recordSize = 1 + numPoints * m_outputNumFields;
+
+        for (int r = 0; r < m_outputBuffer.size(); r += recordSize)
+        {
+            // Write data values point by point
+            for (int k = 0; k < numPoints; ++k)
+            {
+                m_outputStream << boost::format("%25.19e")
+                                  % m_outputBuffer[r];
+                for (int j = 0; j < m_outputNumFields; ++j)
+                {
+                    m_outputStream << " " << boost::format("%25.19e")
+                        % m_outputBuffer[r + 1 + k * m_outputNumFields + j];
+                }
+                m_outputStream << "\n";
+            }
+        }
     }
+
+    m_outputStream.flush();
+    m_outputBuffer.clear();
 }
 
 
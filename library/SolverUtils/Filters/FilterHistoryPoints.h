@@ -77,6 +77,18 @@ class FilterHistoryPoints : public Filter
             const NekDouble &time);
         SOLVER_UTILS_EXPORT virtual bool v_IsTimeDependent();
 
+        SOLVER_UTILS_EXPORT void EvaluatePlan(
+            const MultiRegions::ExpListSharedPtr &pField,
+            const Array<OneD, const NekDouble>   &pPhys,
+            const bool                            pFourier,
+            Array<OneD, NekDouble>               &pValues);
+        SOLVER_UTILS_EXPORT void OutputData(
+            const LibUtilities::CommSharedPtr    &pComm,
+            const NekDouble                       time,
+            const int                             numFields,
+            Array<OneD, NekDouble>               &pValues);
+        SOLVER_UTILS_EXPORT void WriteBuffer();
+
         SpatialDomains::PointGeomVector         m_historyPoints;
         unsigned int                            m_index;
         unsigned int                            m_outputFrequency;
@@ -88,9 +100,33 @@ class FilterHistoryPoints : public Filter
         std::string                             m_outputFile;
         std::ofstream                           m_outputStream;
         std::stringstream                       m_historyPointStream;
-        std::list<std::pair<SpatialDomains::PointGeomSharedPtr,
-                            Array<OneD, NekDouble> > > m_historyList;
-        std::map<int, int >                     m_historyLocalPointMap;
+        /// Write the history data in binary rather than ascii format.
+        bool                                    m_outputBinary;
+        /// Number of outputs held in memory before writing to file.
+        unsigned int                            m_outputBufferSize;
+        /// Outputs not yet written, each the time followed by the data.
+        std::vector<NekDouble>                  m_outputBuffer;
+        /// Number of variables of each point in the output buffer.
+        int                                     m_outputNumFields;
+
+        /// Elements of this process containing history points.
+        Array<OneD, int>                        m_planElmts;
+        /// Offset of the points of each element in the plan.
+        Array<OneD, int>                        m_planOffsets;
+        /// Interpolation weights of the points of each element.
+        Array<OneD, Array<OneD, NekDouble> >    m_planWeights;
+        /// History point evaluated by each point of the plan.
+        Array<OneD, int>                        m_planPoints;
+        /// Local plane of each point of the plan, or -1 if not local.
+        Array<OneD, int>                        m_planPlanes;
+        /// Fourier weights of the local planes for each point of the plan.
+        Array<OneD, Array<OneD, NekDouble> >    m_planFourier;
+        /// Number of plan points of each process, on the root process.
+        Array<OneD, int>                        m_gatherSizes;
+        /// History point of each plan point gathered on the root process.
+        Array<OneD, int>                        m_gatherPoints;
+        /// Physical values of the elements of the plan.
+        Array<OneD, NekDouble>                  m_physWsp;
 };
 
 }
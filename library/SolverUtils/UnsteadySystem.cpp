@@ -38,6 +38,7 @@
 
 #include <LibUtilities/TimeIntegration/TimeIntegrationWrapper.h>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/UnsteadySystem.h>
 
@@ -281,13 +282,17 @@ namespace Nektar
                 
                 // Perform any solver-specific pre-integration steps
                 timer.Start();
-                if (v_PreIntegrate(step))
                 {
-                    break;
-                }
+                    LibUtilities::ProfileRegion region("TimeStep");
+
+                    if (v_PreIntegrate(step))
+                    {
+                        break;
+                    }
 
-                fields = m_intScheme->TimeIntegrate(
-                    step, m_timestep, m_intSoln, m_ode);
+                    fields = m_intScheme->TimeIntegrate(
+                        step, m_timestep, m_intSoln, m_ode);
+                }
                 timer.Stop();
 
                 m_time  += m_timestep;
@@ -352,16 +357,22 @@ namespace Nektar
                                 "NaN found during time integration.");
                 }
                 // Update filters
-                std::vector<FilterSharedPtr>::iterator x;
-                for (x = m_filters.begin(); x != m_filters.end(); ++x)
                 {
-                    (*x)->Update(m_fields, m_time);
+                    LibUtilities::ProfileRegion region("FilterUpdate");
+
+                    std::vector<FilterSharedPtr>::iterator x;
+                    for (x = m_filters.begin(); x != m_filters.end(); ++x)
+                    {
+                        (*x)->Update(m_fields, m_time);
+                    }
                 }
 
                 // Write out checkpoint files
                 if ((m_checksteps && !((step + 1) % m_checksteps)) ||
                      doCheckTime)
                 {
+                    LibUtilities::ProfileRegion region("Checkpoint");
+
                     if(m_HomogeneousType != eNotHomogeneous)
                     {
                         vector<bool> transformed(nfields, false);
@@ -416,6 +427,35 @@ namespace Nektar
                     cout << "Time-integration  : " << intTime  << "s"   << endl;
                 }
             }
+
+            // Report the time for which the communication of pipelined
+            // transpositions was overlapped with computation, averaged over
+            // the processes.
+            if (m_HomogeneousType == eHomogeneous1D &&
+                m_session->DefinesCmdLineArgument("verbose"))
+            {
+                LibUtilities::CommSharedPtr comm = m_session->GetComm();
+                LibUtilities::TranspositionSharedPtr trans =
+                    m_fields[0]->GetTransposition();
+
+                int       nTrans  = trans->GetNumPipelined();
+                NekDouble overlap = trans->GetOverlapTime();
+                NekDouble wait    = trans->GetWaitTime();
+
+                comm->AllReduce(nTrans,  LibUtilities::ReduceSum);
+                comm->AllReduce(overlap, LibUtilities::ReduceSum);
+                comm->AllReduce(wait,    LibUtilities::ReduceSum);
+
+                if (nTrans > 0 && comm->GetRank() == 0)
+                {
+                    int nProc = comm->GetSize();
+                    cout << "Transpositions    : " << nTrans / nProc
+                         << " pipelined, " << overlap / nProc
+                         << "s overlapped, " << wait / nProc
+                         << "s waiting (" << 100.0 * overlap / (overlap + wait)
+                         << "% overlap)" << endl;
+                }
+            }
             
             // If homogeneous, transform back into physical space if necessary.
             if(m_HomogeneousType != eNotHomogeneous)
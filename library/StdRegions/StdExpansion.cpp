@@ -970,6 +970,204 @@ namespace Nektar
             return v_StdPhysEvaluate(Lcoord,physvals);
         }
 
+        /**
+         * @brief Compute the Lagrange interpolation weights of a batch of
+         * points in the standard region.
+         *
+         * For each direction \f$ d \f$ of the expansion, the interpolants
+         * \f$ h_j(\eta_d) \f$ through the quadrature points of
+         * #m_base[d] are evaluated at the collapsed coordinates of all
+         * points with the barycentric formula, and stored in @p weights as
+         * a column-major \f$ npts \times Q_d \f$ block. The blocks of
+         * each direction follow each other, so that @p weights holds
+         * \f$ npts \sum_d Q_d \f$ values and is resized if it is too
+         * small.
+         *
+         * The weights only depend on the points, and can be applied to any
+         * number of fields with StdPhysEvaluate.
+         *
+         * @param npts     Number of points.
+         * @param Lcoords  Local Cartesian coordinates of the points, with
+         *                 the coordinate @p d of point @p i in
+         *                 Lcoords[d][i].
+         * @param weights  Interpolation weights of the points.
+         */
+        void StdExpansion::StdPhysEvaluateWeights(
+            const int                                         npts,
+            const Array<OneD, const Array<OneD, NekDouble> > &Lcoords,
+            Array<OneD, NekDouble>                           &weights)
+        {
+            const int dim = GetShapeDimension();
+            int i, j, d, nq, nweights = 0;
+
+            for (d = 0; d < dim; ++d)
+            {
+                nweights += npts * m_base[d]->GetNumPoints();
+            }
+
+            if (weights.num_elements() < nweights)
+            {
+                weights = Array<OneD, NekDouble>(nweights);
+            }
+
+            // Collapsed coordinates of all points, one row per direction.
+            Array<OneD, NekDouble> xi(3, 0.0), eta(3, 0.0);
+            Array<OneD, NekDouble> collapsed(dim * npts);
+
+            for (i = 0; i < npts; ++i)
+            {
+                for (d = 0; d < dim; ++d)
+                {
+                    xi[d] = Lcoords[d][i];
+                }
+
+                if (dim == 1)
+                {
+                    eta[0] = xi[0];
+                }
+                else
+                {
+                    LocCoordToLocCollapsed(xi, eta);
+                }
+
+                for (d = 0; d < dim; ++d)
+                {
+                    collapsed[d * npts + i] = eta[d];
+                }
+            }
+
+            NekDouble *w = weights.get();
+
+            for (d = 0; d < dim; ++d, w += npts * nq)
+            {
+                nq = m_base[d]->GetNumPoints();
+
+                const LibUtilities::PointsType ptype =
+                    m_base[d]->GetPointsType();
+
+                // Fourier points are not interpolated by polynomials.
+                if (ptype == LibUtilities::eFourierEvenlySpaced ||
+                    ptype == LibUtilities::eFourierSingleModeSpaced)
+                {
+                    for (i = 0; i < npts; ++i)
+                    {
+                        DNekMatSharedPtr I =
+                            m_base[d]->GetI(collapsed + d * npts + i);
+                        Vmath::Vcopy(nq, I->GetPtr().get(), 1, w + i, npts);
+                    }
+                    continue;
+                }
+
+                const NekDouble *z  = m_base[d]->GetZ().get();
+                const NekDouble *bw = m_base[d]->GetBaryWeights().get();
+
+                for (i = 0; i < npts; ++i)
+                {
+                    const NekDouble x = collapsed[d * npts + i];
+                    NekDouble       sum = 0.0;
+
+                    for (j = 0; j < nq; ++j)
+                    {
+                        if (x == z[j])
+                        {
+                            break;
+                        }
+                        w[i + j * npts] = bw[j] / (x - z[j]);
+                        sum += w[i + j * npts];
+                    }
+
+                    if (j < nq)
+                    {
+                        // The point coincides with a quadrature point.
+                        Vmath::Zero(nq, w + i, npts);
+                        w[i + j * npts] = 1.0;
+                    }
+                    else
+                    {
+                        Blas::Dscal(nq, 1.0 / sum, w + i, npts);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Evaluate the expansion at a batch of points from their
+         * interpolation weights.
+         *
+         * The interpolation is sum-factorised across all points: the
+         * weights of the first direction are applied to @p physvals by a
+         * single matrix-matrix multiplication, after which the weights of
+         * the remaining directions are applied point by point as vector
+         * operations over the points.
+         *
+         * @param npts      Number of points.
+         * @param weights   Weights computed by StdPhysEvaluateWeights.
+         * @param physvals  Values of the expansion at the quadrature points.
+         * @param outvals   Values of the expansion at the points.
+         */
+        void StdExpansion::StdPhysEvaluate(
+            const int                           npts,
+            const Array<OneD, const NekDouble> &weights,
+            const Array<OneD, const NekDouble> &physvals,
+            Array<OneD, NekDouble>             &outvals)
+        {
+            const int dim = GetShapeDimension();
+            const int nq0 = m_base[0]->GetNumPoints();
+            const int nq1 = dim > 1 ? m_base[1]->GetNumPoints() : 1;
+            const int nq2 = dim > 2 ? m_base[2]->GetNumPoints() : 1;
+
+            const NekDouble *w0 = weights.get();
+            const NekDouble *w1 = w0 + npts * nq0;
+            const NekDouble *w2 = w1 + npts * nq1;
+
+            if (dim == 1)
+            {
+                Blas::Dgemv('N', npts, nq0, 1.0, w0, npts,
+                            physvals.get(), 1, 0.0, outvals.get(), 1);
+                return;
+            }
+
+            // Interpolate in the first direction for all points.
+            Array<OneD, NekDouble> wsp(npts * nq1 * nq2);
+            Blas::Dgemm('N', 'N', npts, nq1 * nq2, nq0, 1.0, w0, npts,
+                        physvals.get(), nq0, 0.0, wsp.get(), npts);
+
+            if (dim == 3)
+            {
+                // Interpolate in the second direction, overwriting the
+                // first column of each plane of the workspace.
+                for (int k = 0; k < nq2; ++k)
+                {
+                    NekDouble *plane = wsp.get() + k * npts * nq1;
+
+                    Vmath::Vmul(npts, w1, 1, plane, 1, plane, 1);
+                    for (int j = 1; j < nq1; ++j)
+                    {
+                        Vmath::Vvtvp(npts, w1 + j * npts, 1,
+                                     plane + j * npts, 1, plane, 1, plane, 1);
+                    }
+                }
+
+                // Interpolate in the third direction.
+                Vmath::Vmul(npts, w2, 1, wsp.get(), 1, outvals.get(), 1);
+                for (int k = 1; k < nq2; ++k)
+                {
+                    Vmath::Vvtvp(npts, w2 + k * npts, 1,
+                                 wsp.get() + k * npts * nq1, 1,
+                                 outvals.get(), 1, outvals.get(), 1);
+                }
+                return;
+            }
+
+            // Interpolate in the second direction.
+            Vmath::Vmul(npts, w1, 1, wsp.get(), 1, outvals.get(), 1);
+            for (int j = 1; j < nq1; ++j)
+            {
+                Vmath::Vvtvp(npts, w1 + j * npts, 1, wsp.get() + j * npts, 1,
+                             outvals.get(), 1, outvals.get(), 1);
+            }
+        }
+
         int StdExpansion::v_GetElmtId(void)
         {
             return m_elmt_id;
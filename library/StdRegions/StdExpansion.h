@@ -805,6 +805,17 @@ namespace Nektar
                                             const Array<OneD, const NekDouble> &Lcoord,
                                             const Array<OneD, const NekDouble> &physvals);
 
+            STD_REGIONS_EXPORT void StdPhysEvaluateWeights(
+                const int                                         npts,
+                const Array<OneD, const Array<OneD, NekDouble> > &Lcoords,
+                Array<OneD, NekDouble>                           &weights);
+
+            STD_REGIONS_EXPORT void StdPhysEvaluate(
+                const int                           npts,
+                const Array<OneD, const NekDouble> &weights,
+                const Array<OneD, const NekDouble> &physvals,
+                Array<OneD, NekDouble>             &outvals);
+
 
             int GetCoordim()
             {
@@ -1276,6 +1276,224 @@ namespace Nektar
             }
         }
 
+        BOOST_AUTO_TEST_CASE(TestQuadBwdTransPhysDeriv_SumFac_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nc = Exp->GetNcoeffs();
+            const int nq = Exp->GetTotPoints();
+            Array<OneD, NekDouble> coeffs(nelmts*nc), tmp, tmp1, tmp2;
+            Array<OneD, NekDouble> phys1(nelmts*nq), phys2(nelmts*nq);
+            Array<OneD, NekDouble> diff1(2*nelmts*nq);
+            Array<OneD, NekDouble> diff2(2*nelmts*nq);
+
+            for(int i = 0; i < coeffs.num_elements(); ++i)
+            {
+                coeffs[i] = 1.0 / (NekDouble)(i % 7 + 1);
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->BwdTrans(coeffs + i*nc, tmp = phys1 + i*nq);
+                Exp->PhysDeriv(phys1 + i*nq, tmp1 = diff1 + i*nq,
+                               tmp2 = diff1 + (nelmts+i)*nq);
+            }
+
+            BOOST_CHECK(c.HasOperator(Collections::eBwdTransPhysDeriv));
+            c.ApplyOperator(Collections::eBwdTransPhysDeriv, coeffs, phys2,
+                            tmp = diff2, tmp1 = diff2 + nelmts*nq);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < phys1.num_elements(); ++i)
+            {
+                BOOST_CHECK_CLOSE(phys1[i],phys2[i], epsilon);
+            }
+            for(int i = 0; i < diff1.num_elements(); ++i)
+            {
+                diff1[i] = (fabs(diff1[i]) < 1e-14)? 0.0: diff1[i];
+                diff2[i] = (fabs(diff2[i]) < 1e-14)? 0.0: diff2[i];
+                BOOST_CHECK_CLOSE(diff1[i],diff2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadBwdTrans_SumFac_VariableP_MultiElmt_Blocked)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+
+            int nelmts = 10;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     cb(CollExp, impTypes, 3);
+
+            Array<OneD, NekDouble> coeffs(nelmts*Exp->GetNcoeffs()), tmp, tmp1;
+            Array<OneD, NekDouble> phys1(nelmts*Exp->GetTotPoints());
+            Array<OneD, NekDouble> phys2(nelmts*Exp->GetTotPoints());
+
+            for(int i = 0; i < coeffs.num_elements(); ++i)
+            {
+                coeffs[i] = (NekDouble)(i % 7) - 3.0;
+            }
+
+            cb.ApplyOperator(Collections::eBwdTrans, coeffs, phys2);
+
+            // The blocks are evaluated by separate operators, whether by one
+            // thread or several, so the result must be exactly that of
+            // applying a collection of the elements of each block in turn.
+            const int ncoeffs = Exp->GetNcoeffs();
+            const int nq      = Exp->GetTotPoints();
+            for(int e = 0; e < nelmts; e += 3)
+            {
+                std::vector<StdRegions::StdExpansionSharedPtr> BlockExp(
+                    CollExp.begin() + e,
+                    CollExp.begin() + std::min(e + 3, nelmts));
+                Collections::Collection c3(BlockExp, impTypes);
+
+                c3.ApplyOperator(Collections::eBwdTrans,
+                                 tmp = coeffs + e*ncoeffs, tmp1 = phys1 + e*nq);
+            }
+
+            for(int i = 0; i < phys1.num_elements(); ++i)
+            {
+                BOOST_CHECK_EQUAL(phys1[i], phys2[i]);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDeriv_SumFac_VariableP_MultiElmt_Blocked)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     cb(CollExp, impTypes, 4);
+
+            const int nq = Exp->GetTotPoints();
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+            Array<OneD, NekDouble> phys(nelmts*nq),tmp,tmp1,tmp2;
+            Array<OneD, NekDouble> diff1(2*nelmts*nq);
+            Array<OneD, NekDouble> diff2(2*nelmts*nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for (int i = 0; i < nq; ++i)
+            {
+                phys[i] = sin(xc[i])*cos(yc[i]);
+            }
+            for(int i = 1; i < nelmts; ++i)
+            {
+                Vmath::Smul(nq,(NekDouble)(i+1),phys,1,tmp = phys+i*nq,1);
+            }
+
+            cb.ApplyOperator(Collections::ePhysDeriv, phys, diff2, tmp = diff2 + nelmts*nq);
+
+            // Blocks of four elements evaluated in turn, as on one thread.
+            for(int e = 0; e < nelmts; e += 4)
+            {
+                std::vector<StdRegions::StdExpansionSharedPtr> BlockExp(
+                    CollExp.begin() + e,
+                    CollExp.begin() + std::min(e + 4, nelmts));
+                Collections::Collection c4(BlockExp, impTypes);
+
+                c4.ApplyOperator(Collections::ePhysDeriv, tmp = phys + e*nq,
+                                 tmp1 = diff1 + e*nq,
+                                 tmp2 = diff1 + (nelmts + e)*nq);
+            }
+
+            for(int i = 0; i < diff1.num_elements(); ++i)
+            {
+                BOOST_CHECK_EQUAL(diff1[i], diff2[i]);
+            }
+        }
+
         BOOST_AUTO_TEST_CASE(TestQuadIProductWRTDerivBase_IterPerExp_UniformP)
         {
             SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
@@ -1717,5 +1935,281 @@ namespace Nektar
                 BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
             }
         }
+
+        BOOST_AUTO_TEST_CASE(TestQuadBwdTrans_SumFacInterleaved_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(2u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(2u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            // Not a multiple of the interleaving width
+            int nelmts = 11;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacInterleaved);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nc = Exp->GetNcoeffs();
+            const int nq = Exp->GetTotPoints();
+            Array<OneD, NekDouble> coeffs(nelmts*nc), tmp;
+            Array<OneD, NekDouble> phys1(nelmts*nq);
+            Array<OneD, NekDouble> phys2(nelmts*nq);
+
+            for(int i = 0; i < coeffs.num_elements(); ++i)
+            {
+                coeffs[i] = 1.0 / (NekDouble)(i % 7 + 1);
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->BwdTrans(coeffs + i*nc, tmp = phys1 + i*nq);
+            }
+            c.ApplyOperator(Collections::eBwdTrans, coeffs, phys2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < phys1.num_elements(); ++i)
+            {
+                BOOST_CHECK_CLOSE(phys1[i],phys2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadIProductWRTBase_SumFacInterleaved_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(2u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(2u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            // Not a multiple of the interleaving width
+            int nelmts = 11;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacInterleaved);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for(int j = 0; j < nelmts; ++j)
+            {
+                for (int i = 0; i < nq; ++i)
+                {
+                    phys[j*nq+i] = sin(xc[i] + j)*cos(yc[i]);
+                }
+                Exp->IProductWRTBase(phys + j*nq, tmp = coeffs1 + j*nm);
+            }
+
+            c.ApplyOperator(Collections::eIProductWRTBase, phys, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.num_elements(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDeriv_SumFacInterleaved_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(2u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(2u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            // Not a multiple of the interleaving width
+            int nelmts = 11;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacInterleaved);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+            Array<OneD, NekDouble> phys(nelmts*nq),tmp,tmp1;
+            Array<OneD, NekDouble> diff1(2*nelmts*nq);
+            Array<OneD, NekDouble> diff2(2*nelmts*nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for(int j = 0; j < nelmts; ++j)
+            {
+                for (int i = 0; i < nq; ++i)
+                {
+                    phys[j*nq+i] = sin(xc[i] + j)*cos(yc[i]);
+                }
+                Exp->PhysDeriv(phys + j*nq, tmp = diff1 + j*nq,
+                               tmp1 = diff1 + (nelmts+j)*nq);
+            }
+
+            c.ApplyOperator(Collections::ePhysDeriv, phys, diff2, tmp = diff2 + nelmts*nq);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < diff1.num_elements(); ++i)
+            {
+                diff1[i] = (fabs(diff1[i]) < 1e-14)? 0.0: diff1[i];
+                diff2[i] = (fabs(diff2[i]) < 1e-14)? 0.0: diff2[i];
+                BOOST_CHECK_CLOSE(diff1[i],diff2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadIProductWRTDerivBase_SumFacInterleaved_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(2u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(2u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            // Not a multiple of the interleaving width
+            int nelmts = 11;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacInterleaved);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> phys1(nelmts*nq);
+            Array<OneD, NekDouble> phys2(nelmts*nq);
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+            Array<OneD, NekDouble> tmp;
+
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for(int j = 0; j < nelmts; ++j)
+            {
+                for (int i = 0; i < nq; ++i)
+                {
+                    phys1[j*nq+i] = sin(xc[i] + j)*cos(yc[i]);
+                    phys2[j*nq+i] = cos(xc[i])*sin(yc[i] + j);
+                }
+            }
+
+            // Standard routines
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->IProductWRTDerivBase(0, phys1 + i*nq, tmp = coeffs1 + i*nm);
+                Exp->IProductWRTDerivBase(1, phys2 + i*nq, tmp = coeffs2 + i*nm);
+                Vmath::Vadd(nm,coeffs1+i*nm ,1,coeffs2+i*nm ,1,tmp = coeffs1 + i*nm,1);
+            }
+
+            c.ApplyOperator(Collections::eIProductWRTDerivBase, phys1,
+                            phys2, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.num_elements(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
     }
 }
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestFieldIO.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests that the asynchronous output of FieldIO reproduces the
+// synchronous output.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/FieldIO.h>
+#include <LibUtilities/Communication/Comm.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+namespace Nektar
+{
+    namespace FieldIOUnitTests
+    {
+        using namespace LibUtilities;
+
+        /**
+         * Sets up the definition of a field of two variables on @p nElmt
+         * quadrilaterals of order @p nModes, with data depending on @p
+         * seed.
+         */
+        void SetUpField(const int nElmt, const int nModes, const int seed,
+                        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> >   &fielddata)
+        {
+            std::vector<unsigned int> elmtIds(nElmt);
+            for (int i = 0; i < nElmt; ++i)
+            {
+                elmtIds[i] = 2 * i + 1;
+            }
+
+            std::vector<BasisType> basis(2, eModified_A);
+            std::vector<unsigned int> numModes(2, nModes);
+            std::vector<std::string> fields;
+            fields.push_back("u");
+            fields.push_back("v");
+
+            fielddefs.assign(1, MemoryManager<FieldDefinitions>
+                ::AllocateSharedPtr(eQuadrilateral, elmtIds, basis, true,
+                                    numModes, fields));
+
+            fielddata.assign(1, std::vector<NekDouble>(
+                                 2 * nElmt * nModes * nModes));
+            for (int i = 0; i < fielddata[0].size(); ++i)
+            {
+                fielddata[0][i] = sin(0.1 * i + seed) / (1.0 + i);
+            }
+        }
+
+        /**
+         * Checks that the file @p filename holds the field set up by
+         * SetUpField with the same arguments.
+         */
+        void CheckField(FieldIOSharedPtr io, const std::string &filename,
+                        const int nElmt, const int nModes, const int seed)
+        {
+            std::vector<FieldDefinitionsSharedPtr> expDefs, defs;
+            std::vector<std::vector<NekDouble> >   expData, data;
+            SetUpField(nElmt, nModes, seed, expDefs, expData);
+
+            io->Import(filename, defs, data);
+
+            BOOST_REQUIRE_EQUAL(defs.size(), 1);
+            BOOST_CHECK(defs[0]->m_elementIDs == expDefs[0]->m_elementIDs);
+            BOOST_CHECK(defs[0]->m_numModes   == expDefs[0]->m_numModes);
+            BOOST_CHECK(defs[0]->m_fields     == expDefs[0]->m_fields);
+
+            BOOST_REQUIRE_EQUAL(data.size(), 1);
+            BOOST_REQUIRE_EQUAL(data[0].size(), expData[0].size());
+            for (int i = 0; i < data[0].size(); ++i)
+            {
+                BOOST_CHECK_EQUAL(data[0][i], expData[0][i]);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestWriteAsyncMatchesWrite)
+        {
+            CommSharedPtr comm = GetCommFactory().CreateInstance(
+                "Serial", 0, 0);
+            FieldIOSharedPtr io = GetFieldIOFactory().CreateInstance(
+                "Xml", comm, true);
+
+            std::vector<FieldDefinitionsSharedPtr> defs;
+            std::vector<std::vector<NekDouble> >   data;
+
+            SetUpField(5, 4, 0, defs, data);
+            io->Write("TestFieldIO_sync.fld", defs, data);
+
+            // The data is handed over to the output thread.
+            SetUpField(5, 4, 0, defs, data);
+            io->WriteAsync("TestFieldIO_async.fld", defs, data);
+            BOOST_CHECK(data.empty());
+            io->WaitForWrite();
+
+            CheckField(io, "TestFieldIO_sync.fld",  5, 4, 0);
+            CheckField(io, "TestFieldIO_async.fld", 5, 4, 0);
+
+            boost::filesystem::remove("TestFieldIO_sync.fld");
+            boost::filesystem::remove("TestFieldIO_async.fld");
+        }
+
+        BOOST_AUTO_TEST_CASE(TestWriteAsyncSeveralWriters)
+        {
+            CommSharedPtr comm = GetCommFactory().CreateInstance(
+                "Serial", 0, 0);
+            FieldIOSharedPtr io1 = GetFieldIOFactory().CreateInstance(
+                "Xml", comm, true);
+            FieldIOSharedPtr io2 = GetFieldIOFactory().CreateInstance(
+                "Xml", comm, true);
+
+            std::vector<FieldDefinitionsSharedPtr> defs;
+            std::vector<std::vector<NekDouble> >   data;
+
+            // Interleave the output of two writers, as for the field output
+            // of an equation system and a checkpoint filter, each writer
+            // staging its next output while the previous one is in progress.
+            for (int i = 0; i < 3; ++i)
+            {
+                std::string n = boost::lexical_cast<std::string>(i);
+
+                SetUpField(3 + i, 3, i, defs, data);
+                io1->WriteAsync("TestFieldIO_1_" + n + ".fld", defs, data);
+
+                SetUpField(4 + i, 5, 10 + i, defs, data);
+                io2->WriteAsync("TestFieldIO_2_" + n + ".fld", defs, data);
+            }
+            io1->WaitForWrite();
+            io2->WaitForWrite();
+
+            for (int i = 0; i < 3; ++i)
+            {
+                std::string n = boost::lexical_cast<std::string>(i);
+
+                CheckField(io1, "TestFieldIO_1_" + n + ".fld", 3 + i, 3, i);
+                CheckField(io2, "TestFieldIO_2_" + n + ".fld",
+                           4 + i, 5, 10 + i);
+
+                boost::filesystem::remove("TestFieldIO_1_" + n + ".fld");
+                boost::filesystem::remove("TestFieldIO_2_" + n + ".fld");
+            }
+        }
+    }
+}
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestNekFFTW.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests the transformation of several lines at once by NekFFTW
+// against a direct evaluation of the discrete Fourier transform.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+namespace Nektar
+{
+    namespace NekFFTWUnitTests
+    {
+        /**
+         * Evaluates the discrete Fourier transform of the line of @p n points
+         * starting at @p phys, with entries @p stride apart, in the Nektar++
+         * coefficient ordering: the mean, the (discarded) Nyquist mode, then
+         * the cosine and sine coefficients of each wavenumber.
+         */
+        void ReferenceFwd(const int n, const int stride,
+                          const NekDouble *phys, NekDouble *coef)
+        {
+            coef[0]      = 0.0;
+            coef[stride] = 0.0;
+            for (int j = 0; j < n; ++j)
+            {
+                coef[0] += phys[j*stride] / n;
+            }
+
+            for (int k = 1; k < n/2; ++k)
+            {
+                NekDouble a = 0.0, b = 0.0;
+                for (int j = 0; j < n; ++j)
+                {
+                    a += phys[j*stride] * cos(2.0*M_PI*k*j/n);
+                    b -= phys[j*stride] * sin(2.0*M_PI*k*j/n);
+                }
+                coef[(2*k)  *stride] = 2.0*a/n;
+                coef[(2*k+1)*stride] = 2.0*b/n;
+            }
+        }
+
+        /// Inverse of ReferenceFwd for coefficients without a Nyquist mode.
+        void ReferenceBwd(const int n, const int stride,
+                          const NekDouble *coef, NekDouble *phys)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                NekDouble v = coef[0];
+                for (int k = 1; k < n/2; ++k)
+                {
+                    v += coef[(2*k)  *stride] * cos(2.0*M_PI*k*j/n)
+                       - coef[(2*k+1)*stride] * sin(2.0*M_PI*k*j/n);
+                }
+                phys[j*stride] = v;
+            }
+        }
+
+        /**
+         * Transforms @p howmany lines of @p n points, stored @p stride and
+         * @p dist apart, forwards and backwards, and compares the results
+         * with the reference transforms of each line.
+         */
+        void CheckMany(const int n, const int howmany,
+                       const int stride, const int dist)
+        {
+            LibUtilities::NektarFFTSharedPtr fft =
+                LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", n);
+
+            const int size = (howmany-1)*dist + (n-1)*stride + 1;
+            Array<OneD, NekDouble> phys(size), coef1(size), coef2(size);
+            Array<OneD, NekDouble> phys1(size), phys2(size);
+
+            for (int i = 0; i < size; ++i)
+            {
+                phys[i] = sin(0.3*i + 1.0) + 0.1*i;
+            }
+
+            fft->FFTFwdTransMany(howmany, stride, dist, phys, coef1);
+            for (int i = 0; i < howmany; ++i)
+            {
+                ReferenceFwd(n, stride, &phys[i*dist], &coef2[i*dist]);
+            }
+
+            double epsilon = 1.0e-8;
+            for (int i = 0; i < howmany; ++i)
+            {
+                for (int j = 0; j < n; ++j)
+                {
+                    int idx = i*dist + j*stride;
+                    coef1[idx] = (fabs(coef1[idx]) < 1e-14)? 0.0: coef1[idx];
+                    coef2[idx] = (fabs(coef2[idx]) < 1e-14)? 0.0: coef2[idx];
+                    BOOST_CHECK_CLOSE(coef1[idx], coef2[idx], epsilon);
+                }
+            }
+
+            fft->FFTBwdTransMany(howmany, stride, dist, coef2, phys1);
+            for (int i = 0; i < howmany; ++i)
+            {
+                ReferenceBwd(n, stride, &coef2[i*dist], &phys2[i*dist]);
+            }
+
+            for (int i = 0; i < howmany; ++i)
+            {
+                for (int j = 0; j < n; ++j)
+                {
+                    int idx = i*dist + j*stride;
+                    BOOST_CHECK_CLOSE(phys1[idx], phys2[idx], epsilon);
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekFFTWManyContiguousLines)
+        {
+            // Consecutive entries of a line are adjacent, as for the
+            // transposed pencils.
+            CheckMany(16, 5, 1, 16);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekFFTWManyInterleavedLines)
+        {
+            // Consecutive lines are adjacent, as for the plane ordering.
+            CheckMany(8, 7, 7, 1);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekFFTWManyPaddedLines)
+        {
+            // Lines with a gap between them.
+            CheckMany(12, 3, 2, 25);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNekFFTWManyMatchesSingleLine)
+        {
+            const int n = 10, howmany = 4;
+
+            LibUtilities::NektarFFTSharedPtr fft =
+                LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", n);
+
+            Array<OneD, NekDouble> phys(n*howmany), coef1(n*howmany);
+            Array<OneD, NekDouble> line(n), coef2(n);
+
+            for (int i = 0; i < n*howmany; ++i)
+            {
+                phys[i] = cos(0.7*i) - 0.05*i;
+            }
+
+            fft->FFTFwdTransMany(howmany, 1, n, phys, coef1);
+
+            for (int i = 0; i < howmany; ++i)
+            {
+                Vmath::Vcopy(n, &phys[i*n], 1, &line[0], 1);
+                fft->FFTFwdTrans(line, coef2);
+
+                double epsilon = 1.0e-8;
+                for (int j = 0; j < n; ++j)
+                {
+                    coef1[i*n+j] = (fabs(coef1[i*n+j]) < 1e-14)? 0.0:
+                                                                 coef1[i*n+j];
+                    coef2[j]     = (fabs(coef2[j]) < 1e-14)? 0.0: coef2[j];
+                    BOOST_CHECK_CLOSE(coef1[i*n+j], coef2[j], epsilon);
+                }
+            }
+        }
+    }
+}
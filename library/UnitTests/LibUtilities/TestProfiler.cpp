@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestProfiler.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests of the regions recorded and reported by the Profiler.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <LibUtilities/Communication/Comm.h>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Nektar
+{
+    namespace ProfilerUnitTests
+    {
+        using namespace LibUtilities;
+
+        /// Opens a region on a thread other than the one which enabled the
+        /// profiler, which must not be recorded.
+        void OpenWorkerRegion(bool &active)
+        {
+            ProfileRegion region("Worker");
+            active = region.IsActive();
+        }
+
+        /// Opens the regions of a solve: two nested "CG" regions, a region
+        /// of the same name as the top-level one, and an "Assemble" region
+        /// of 1 MB.
+        void Solve()
+        {
+            ProfileRegion solve("Solve");
+            {
+                ProfileRegion assemble("Assemble");
+                assemble.AddBytes(1048576);
+            }
+            for (int i = 0; i < 2; ++i)
+            {
+                ProfileRegion cg("CG");
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestProfilerReport)
+        {
+            CommSharedPtr comm = GetCommFactory().CreateInstance(
+                "Serial", 0, 0);
+
+            // Regions are not recorded until the profiler is enabled.
+            {
+                ProfileRegion region("Disabled");
+                BOOST_CHECK(!region.IsActive());
+            }
+
+            Profiler::Enable();
+            BOOST_CHECK(Profiler::IsEnabled());
+
+            {
+                ProfileRegion cg("CG");
+                BOOST_CHECK(cg.IsActive());
+            }
+
+            for (int i = 0; i < 3; ++i)
+            {
+                Solve();
+            }
+
+            {
+                ProfileRegion post("Solve-Post");
+                bool active = true;
+                boost::thread worker(OpenWorkerRegion, boost::ref(active));
+                worker.join();
+                BOOST_CHECK(!active);
+            }
+
+            std::ostringstream out;
+            Profiler::Report(comm, out);
+
+            // The profiler is disabled by the report.
+            BOOST_CHECK(!Profiler::IsEnabled());
+
+            // Regions are sorted by name, with the children of each region
+            // following it directly, indented, even though "Solve-Post" comes
+            // before "Solve/Assemble" in character order.
+            const char *expLabel[] = {"CG", "Solve", "  Assemble", "  CG",
+                                      "Solve-Post"};
+            const int   expCalls[] = {1, 3, 3, 6, 1};
+            const int   nRegions   = 5;
+
+            std::istringstream in(out.str());
+            std::vector<std::string> lines;
+            std::string line;
+            while (std::getline(in, line))
+            {
+                lines.push_back(line);
+            }
+
+            BOOST_REQUIRE_EQUAL(lines.size(), nRegions + 2);
+            BOOST_CHECK_EQUAL(lines[0],
+                              "Profile of 1 process (times in seconds)");
+            BOOST_CHECK_EQUAL(lines[1].substr(0, 6), "Region");
+
+            for (int i = 0; i < nRegions; ++i)
+            {
+                const std::string &l = lines[i + 2];
+
+                // Columns: label (40), calls, min, avg and max time (12
+                // each), max/avg (10), and MB (12) if any bytes were added.
+                BOOST_CHECK_EQUAL(boost::trim_right_copy(l.substr(0, 40)),
+                                  expLabel[i]);
+                BOOST_CHECK_EQUAL(boost::lexical_cast<int>(
+                                      boost::trim_copy(l.substr(40, 12))),
+                                  expCalls[i]);
+
+                // On a single process the minimum, average and maximum
+                // times are equal.
+                BOOST_CHECK_EQUAL(l.substr(52, 12), l.substr(64, 12));
+                BOOST_CHECK_EQUAL(l.substr(64, 12), l.substr(76, 12));
+
+                if (i == 2)
+                {
+                    BOOST_REQUIRE_EQUAL(l.size(), 110);
+                    BOOST_CHECK_EQUAL(boost::trim_copy(l.substr(98, 12)),
+                                      "3.000");
+                }
+                else
+                {
+                    BOOST_CHECK_EQUAL(l.size(), 98);
+                }
+            }
+        }
+    }
+}
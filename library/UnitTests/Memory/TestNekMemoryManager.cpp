@@ -41,6 +41,9 @@
 
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
 
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
 namespace Nektar
 {
     namespace MemManagerUnitTests
@@ -138,6 +141,42 @@ namespace Nektar
         }
 
 
+        BOOST_AUTO_TEST_CASE(testPoolStatistics)
+        {
+            detail::ThreadSpecificPool pool(24);
+
+            void* a = pool.Allocate();
+            void* b = pool.Allocate();
+            MemPoolStatistics stats = pool.GetStatistics();
+            BOOST_CHECK_EQUAL(stats.m_allocations,   2u);
+            BOOST_CHECK_EQUAL(stats.m_bytesInUse,    48u);
+            BOOST_CHECK_EQUAL(stats.m_highWaterMark, 48u);
+
+            pool.Deallocate(a);
+            stats = pool.GetStatistics();
+            BOOST_CHECK_EQUAL(stats.m_bytesInUse,    24u);
+            BOOST_CHECK_EQUAL(stats.m_highWaterMark, 48u);
+
+            // Release a block from a different thread, which returns it to
+            // this thread for reuse.
+            boost::thread t(boost::bind(
+                &detail::ThreadSpecificPool::Deallocate, &pool, b));
+            t.join();
+
+            void* c = pool.Allocate();
+            void* d = pool.Allocate();
+            BOOST_CHECK(c == a);
+            BOOST_CHECK(d == b);
+
+            stats = pool.GetStatistics();
+            BOOST_CHECK_EQUAL(stats.m_allocations,   4u);
+            BOOST_CHECK_EQUAL(stats.m_bytesInUse,    48u);
+            BOOST_CHECK_EQUAL(stats.m_highWaterMark, 48u);
+
+            pool.Deallocate(c);
+            pool.Deallocate(d);
+        }
+
         BOOST_AUTO_TEST_CASE(ReproduceMemoryErrors)
         {
             boost::shared_ptr<int> m = MemoryManager<int>::AllocateSharedPtr();
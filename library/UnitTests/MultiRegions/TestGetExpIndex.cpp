@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestGetExpIndex.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests of the location of points in an expansion list.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ExpList2D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+namespace Nektar
+{
+    namespace GetExpIndexTests
+    {
+        /// Writes a session with a mesh of 2x2 unit quadrilaterals covering
+        /// [0,2]x[0,2], numbered from left to right and bottom to top.
+        void WriteQuadSession(const std::string &filename)
+        {
+            std::ofstream f(filename.c_str());
+            f << "<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n"
+              << "<NEKTAR>\n"
+              << "  <GEOMETRY DIM=\"2\" SPACE=\"2\">\n"
+              << "    <VERTEX>\n"
+              << "      <V ID=\"0\"> 0.0 0.0 0.0 </V>\n"
+              << "      <V ID=\"1\"> 1.0 0.0 0.0 </V>\n"
+              << "      <V ID=\"2\"> 2.0 0.0 0.0 </V>\n"
+              << "      <V ID=\"3\"> 0.0 1.0 0.0 </V>\n"
+              << "      <V ID=\"4\"> 1.0 1.0 0.0 </V>\n"
+              << "      <V ID=\"5\"> 2.0 1.0 0.0 </V>\n"
+              << "      <V ID=\"6\"> 0.0 2.0 0.0 </V>\n"
+              << "      <V ID=\"7\"> 1.0 2.0 0.0 </V>\n"
+              << "      <V ID=\"8\"> 2.0 2.0 0.0 </V>\n"
+              << "    </VERTEX>\n"
+              << "    <EDGE>\n"
+              << "      <E ID=\"0\">  0 1 </E>\n"
+              << "      <E ID=\"1\">  1 2 </E>\n"
+              << "      <E ID=\"2\">  3 4 </E>\n"
+              << "      <E ID=\"3\">  4 5 </E>\n"
+              << "      <E ID=\"4\">  6 7 </E>\n"
+              << "      <E ID=\"5\">  7 8 </E>\n"
+              << "      <E ID=\"6\">  0 3 </E>\n"
+              << "      <E ID=\"7\">  1 4 </E>\n"
+              << "      <E ID=\"8\">  2 5 </E>\n"
+              << "      <E ID=\"9\">  3 6 </E>\n"
+              << "      <E ID=\"10\"> 4 7 </E>\n"
+              << "      <E ID=\"11\"> 5 8 </E>\n"
+              << "    </EDGE>\n"
+              << "    <ELEMENT>\n"
+              << "      <Q ID=\"0\"> 0 7 2 6 </Q>\n"
+              << "      <Q ID=\"1\"> 1 8 3 7 </Q>\n"
+              << "      <Q ID=\"2\"> 2 10 4 9 </Q>\n"
+              << "      <Q ID=\"3\"> 3 11 5 10 </Q>\n"
+              << "    </ELEMENT>\n"
+              << "    <COMPOSITE>\n"
+              << "      <C ID=\"0\"> Q[0-3] </C>\n"
+              << "    </COMPOSITE>\n"
+              << "    <DOMAIN> C[0] </DOMAIN>\n"
+              << "  </GEOMETRY>\n"
+              << "  <EXPANSIONS>\n"
+              << "    <E COMPOSITE=\"C[0]\" NUMMODES=\"4\" TYPE=\"MODIFIED\" "
+              << "FIELDS=\"u\" />\n"
+              << "  </EXPANSIONS>\n"
+              << "</NEKTAR>\n";
+        }
+
+        MultiRegions::ExpListSharedPtr CreateQuadExpList(
+            LibUtilities::SessionReaderSharedPtr &session)
+        {
+            std::string filename = "TestGetExpIndex.xml";
+            WriteQuadSession(filename);
+
+            char  arg0[] = "MultiRegionsUnitTests";
+            char *argv[] = {arg0, NULL};
+            std::vector<std::string> filenames(1, filename);
+            session = LibUtilities::SessionReader::CreateInstance(
+                1, argv, filenames);
+
+            SpatialDomains::MeshGraphSharedPtr graph =
+                SpatialDomains::MeshGraph::Read(session);
+            MultiRegions::ExpListSharedPtr exp =
+                MemoryManager<MultiRegions::ExpList2D>::AllocateSharedPtr(
+                    session, graph, true, "u");
+
+            boost::filesystem::remove(filename);
+            return exp;
+        }
+
+        BOOST_AUTO_TEST_CASE(TestGetExpIndexBatch)
+        {
+            LibUtilities::SessionReaderSharedPtr session;
+            MultiRegions::ExpListSharedPtr exp = CreateQuadExpList(session);
+
+            // Points given with a third coordinate, as for the planes of a
+            // homogeneous expansion, which is ignored. The second and third
+            // points lie in the same element, and the last one is outside
+            // the mesh.
+            const int  npts       = 6;
+            NekDouble  x[npts]     = {0.25, 1.4,  1.75, 0.6,  1.6,  3.0};
+            NekDouble  y[npts]     = {0.25, 0.6,  0.25, 1.3,  1.9,  3.0};
+            int        expId[npts] = {0,    1,    1,    2,    3,    -1};
+
+            Array<OneD, Array<OneD, NekDouble> > gloCoords(3);
+            gloCoords[0] = Array<OneD, NekDouble>(npts, x);
+            gloCoords[1] = Array<OneD, NekDouble>(npts, y);
+            gloCoords[2] = Array<OneD, NekDouble>(npts, 0.7);
+
+            Array<OneD, int>                     elmtIds;
+            Array<OneD, Array<OneD, NekDouble> > locCoords;
+            exp->GetExpIndex(gloCoords, elmtIds, locCoords,
+                             NekConstants::kNekZeroTol);
+
+            BOOST_REQUIRE_EQUAL(elmtIds.num_elements(),   npts);
+            BOOST_REQUIRE_EQUAL(locCoords.num_elements(), 2);
+
+            Array<OneD, NekDouble> pt(2), xi(2);
+            for (int i = 0; i < npts; ++i)
+            {
+                BOOST_CHECK_EQUAL(elmtIds[i], expId[i]);
+
+                if (expId[i] < 0)
+                {
+                    continue;
+                }
+
+                // The local coordinates are those of the single point query
+                // and map back to the point.
+                pt[0] = x[i];
+                pt[1] = y[i];
+                BOOST_CHECK_EQUAL(exp->GetExpIndex(
+                    pt, xi, NekConstants::kNekZeroTol), expId[i]);
+
+                for (int j = 0; j < 2; ++j)
+                {
+                    BOOST_CHECK_CLOSE(locCoords[j][i], xi[j], 1e-8);
+                }
+
+                xi[0] = locCoords[0][i];
+                xi[1] = locCoords[1][i];
+                exp->GetExp(elmtIds[i])->GetCoord(xi, pt);
+                BOOST_CHECK_CLOSE(pt[0], x[i], 1e-8);
+                BOOST_CHECK_CLOSE(pt[1], y[i], 1e-8);
+            }
+
+            session->Finalise();
+        }
+    }
+}
@@ -0,0 +1,492 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestFilterHistoryPoints.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests of the output of the HistoryPoints filter.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3DHomogeneous1D.h>
+#include <SolverUtils/Filters/Filter.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace Nektar
+{
+    namespace FilterHistoryPointsTests
+    {
+        /// History points, in three elements of the mesh. The third
+        /// coordinate lies on the planes of a homogeneous expansion of
+        /// length one with four planes.
+        const int       npts      = 3;
+        const NekDouble px[npts]  = {0.25, 1.4, 0.6};
+        const NekDouble py[npts]  = {0.25, 0.6, 1.3};
+        const NekDouble pz[npts]  = {0.25, 0.5, 0.0};
+        const int       nfields   = 2;
+
+        /// Fields u and v in the plane, which are represented exactly by the
+        /// expansion.
+        NekDouble FieldXY(const int field, const NekDouble x,
+                          const NekDouble y)
+        {
+            return field == 0 ? x + 2.0 * y : x * y;
+        }
+
+        /// Variation of the fields of the homogeneous expansion along z,
+        /// which is represented exactly by four Fourier planes.
+        NekDouble FieldZ(const NekDouble z)
+        {
+            NekDouble twoPi = 2.0 * boost::math::constants::pi<NekDouble>();
+            return 1.0 + 0.5 * cos(twoPi * z) + 0.25 * sin(twoPi * z);
+        }
+
+        /// Creates a session of variables u and v on a mesh of 2x2 unit
+        /// quadrilaterals covering [0,2]x[0,2], homogeneous in z if @p
+        /// homogeneous is true.
+        LibUtilities::SessionReaderSharedPtr CreateSession(
+            const bool homogeneous)
+        {
+            std::string filename = "TestFilterHistoryPoints.xml";
+            std::ofstream f(filename.c_str());
+            f << "<?xml version=\"1.0\" encoding=\"utf-8\" ?>\n"
+              << "<NEKTAR>\n"
+              << "  <GEOMETRY DIM=\"2\" SPACE=\"2\">\n"
+              << "    <VERTEX>\n";
+            for (int i = 0; i < 9; ++i)
+            {
+                f << "      <V ID=\"" << i << "\"> " << i % 3 << ".0 "
+                  << i / 3 << ".0 0.0 </V>\n";
+            }
+            f << "    </VERTEX>\n"
+              << "    <EDGE>\n"
+              << "      <E ID=\"0\">  0 1 </E>\n"
+              << "      <E ID=\"1\">  1 2 </E>\n"
+              << "      <E ID=\"2\">  3 4 </E>\n"
+              << "      <E ID=\"3\">  4 5 </E>\n"
+              << "      <E ID=\"4\">  6 7 </E>\n"
+              << "      <E ID=\"5\">  7 8 </E>\n"
+              << "      <E ID=\"6\">  0 3 </E>\n"
+              << "      <E ID=\"7\">  1 4 </E>\n"
+              << "      <E ID=\"8\">  2 5 </E>\n"
+              << "      <E ID=\"9\">  3 6 </E>\n"
+              << "      <E ID=\"10\"> 4 7 </E>\n"
+              << "      <E ID=\"11\"> 5 8 </E>\n"
+              << "    </EDGE>\n"
+              << "    <ELEMENT>\n"
+              << "      <Q ID=\"0\"> 0 7 2 6 </Q>\n"
+              << "      <Q ID=\"1\"> 1 8 3 7 </Q>\n"
+              << "      <Q ID=\"2\"> 2 10 4 9 </Q>\n"
+              << "      <Q ID=\"3\"> 3 11 5 10 </Q>\n"
+              << "    </ELEMENT>\n"
+              << "    <COMPOSITE>\n"
+              << "      <C ID=\"0\"> Q[0-3] </C>\n"
+              << "    </COMPOSITE>\n"
+              << "    <DOMAIN> C[0] </DOMAIN>\n"
+              << "  </GEOMETRY>\n"
+              << "  <EXPANSIONS>\n"
+              << "    <E COMPOSITE=\"C[0]\" NUMMODES=\"4\" TYPE=\"MODIFIED\" "
+              << "FIELDS=\"u,v\" />\n"
+              << "  </EXPANSIONS>\n"
+              << "  <CONDITIONS>\n"
+              << "    <SOLVERINFO>\n";
+            if (homogeneous)
+            {
+                f << "      <I PROPERTY=\"Homogeneous\" VALUE=\"1D\" />\n";
+            }
+            f << "    </SOLVERINFO>\n"
+              << "    <VARIABLES>\n"
+              << "      <V ID=\"0\"> u </V>\n"
+              << "      <V ID=\"1\"> v </V>\n"
+              << "    </VARIABLES>\n"
+              << "  </CONDITIONS>\n"
+              << "</NEKTAR>\n";
+            f.close();
+
+            char  arg0[] = "SolverUtilsUnitTests";
+            char *argv[] = {arg0, NULL};
+            std::vector<std::string> filenames(1, filename);
+            LibUtilities::SessionReaderSharedPtr session =
+                LibUtilities::SessionReader::CreateInstance(
+                    1, argv, filenames);
+
+            boost::filesystem::remove(filename);
+            return session;
+        }
+
+        /// Creates a HistoryPoints filter at the history points, writing to
+        /// @p filename, with the additional parameters @p params.
+        SolverUtils::FilterSharedPtr CreateFilter(
+            const LibUtilities::SessionReaderSharedPtr &session,
+            const std::string                          &filename,
+            SolverUtils::Filter::ParamMap               params)
+        {
+            std::stringstream points;
+            for (int i = 0; i < npts; ++i)
+            {
+                points << px[i] << " " << py[i] << " " << pz[i] << "\n";
+            }
+
+            params["OutputFile"] = filename;
+            params["Points"]     = points.str();
+
+            return SolverUtils::GetFilterFactory().CreateInstance(
+                "HistoryPoints", session, params);
+        }
+
+        /// Reads the header of the history file @p in and checks that it
+        /// lists the variables and the history points, and is followed by
+        /// @p nextra comment lines.
+        void CheckHeader(std::istream &in, const int nextra)
+        {
+            std::string line;
+            std::getline(in, line);
+            BOOST_CHECK_EQUAL(line,
+                "# History data for variables (:u,v,) at points:");
+
+            for (int i = 0; i < npts; ++i)
+            {
+                std::getline(in, line);
+                std::istringstream pt(line.substr(1));
+                int       id;
+                NekDouble x, y;
+                pt >> id >> x >> y;
+                BOOST_CHECK_EQUAL(id, i);
+                BOOST_CHECK_CLOSE(x, px[i], 1e-12);
+                BOOST_CHECK_CLOSE(y, py[i], 1e-12);
+            }
+
+            for (int i = 0; i < nextra; ++i)
+            {
+                std::getline(in, line);
+                BOOST_CHECK_EQUAL(line.substr(0, 2), "# ");
+            }
+        }
+
+        /// Reads the records of the ascii history file @p filename into @p
+        /// data, as the time followed by the variables at each point.
+        void ReadAscii(const std::string      &filename,
+                       const int               nextra,
+                       std::vector<NekDouble> &data)
+        {
+            std::ifstream in(filename.c_str());
+            BOOST_REQUIRE(in.good());
+            CheckHeader(in, nextra);
+
+            std::string line;
+            NekDouble   time = 0.0, val;
+            int         pt   = 0;
+            while (std::getline(in, line))
+            {
+                std::istringstream values(line);
+                values >> val;
+
+                // Each line holds the time and the variables at a point.
+                if (pt == 0)
+                {
+                    time = val;
+                    data.push_back(time);
+                }
+                BOOST_CHECK_EQUAL(val, time);
+
+                for (int j = 0; j < nfields; ++j)
+                {
+                    values >> val;
+                    data.push_back(val);
+                }
+                BOOST_CHECK(!values.fail());
+
+                pt = (pt + 1) % npts;
+            }
+            BOOST_CHECK_EQUAL(pt, 0);
+        }
+
+        /// Reads the records of the binary history file @p filename into @p
+        /// data.
+        void ReadBinary(const std::string      &filename,
+                        std::vector<NekDouble> &data)
+        {
+            std::ifstream in(filename.c_str(), std::ios::binary);
+            BOOST_REQUIRE(in.good());
+            CheckHeader(in, 1);
+
+            NekDouble val;
+            while (in.read(reinterpret_cast<char *>(&val), sizeof(val)))
+            {
+                data.push_back(val);
+            }
+        }
+
+        /// Checks that @p data holds the values of @p expected at the
+        /// history points, multiplied by the factor (1 + t) of each of the
+        /// @p nout outputs at times t = 0, 0.1, ...
+        void CheckRecords(const std::vector<NekDouble> &data,
+                          const NekDouble expected[npts][nfields],
+                          const int nout)
+        {
+            const int recordSize = 1 + npts * nfields;
+            BOOST_REQUIRE_EQUAL(data.size(), nout * recordSize);
+
+            for (int r = 0; r < nout; ++r)
+            {
+                NekDouble time = 0.1 * r;
+                BOOST_CHECK_SMALL(data[r * recordSize] - time, 1e-15);
+
+                for (int i = 0; i < npts; ++i)
+                {
+                    for (int j = 0; j < nfields; ++j)
+                    {
+                        BOOST_CHECK_SMALL(
+                            data[r * recordSize + 1 + i * nfields + j] -
+                                (1.0 + time) * expected[i][j], 1e-11);
+                    }
+                }
+            }
+        }
+
+        /// Sets the physical values of @p fields to @p phys multiplied by
+        /// (1 + @p time).
+        void SetFields(
+            Array<OneD, MultiRegions::ExpListSharedPtr>  &fields,
+            const Array<OneD, Array<OneD, NekDouble> >   &phys,
+            const NekDouble                               time)
+        {
+            for (int j = 0; j < nfields; ++j)
+            {
+                Vmath::Smul(phys[j].num_elements(), 1.0 + time, phys[j], 1,
+                            fields[j]->UpdatePhys(), 1);
+                fields[j]->SetPhysState(true);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestHistoryPointsAsciiBinary)
+        {
+            LibUtilities::SessionReaderSharedPtr session =
+                CreateSession(false);
+            SpatialDomains::MeshGraphSharedPtr graph =
+                SpatialDomains::MeshGraph::Read(session);
+
+            Array<OneD, MultiRegions::ExpListSharedPtr> fields(nfields);
+            Array<OneD, Array<OneD, NekDouble> >        phys(nfields);
+            for (int j = 0; j < nfields; ++j)
+            {
+                fields[j] = MemoryManager<MultiRegions::ExpList2D>
+                    ::AllocateSharedPtr(session, graph, true,
+                                        session->GetVariable(j));
+            }
+
+            int nq = fields[0]->GetTotPoints();
+            Array<OneD, NekDouble> x(nq), y(nq);
+            fields[0]->GetCoords(x, y);
+            for (int j = 0; j < nfields; ++j)
+            {
+                phys[j] = Array<OneD, NekDouble>(nq);
+                for (int i = 0; i < nq; ++i)
+                {
+                    phys[j][i] = FieldXY(j, x[i], y[i]);
+                }
+            }
+
+            NekDouble expected[npts][nfields];
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int j = 0; j < nfields; ++j)
+                {
+                    expected[i][j] = FieldXY(j, px[i], py[i]);
+                }
+            }
+
+            // Ascii output, and binary output buffered over two outputs.
+            SolverUtils::Filter::ParamMap binParams;
+            binParams["OutputFormat"]     = "Binary";
+            binParams["OutputBufferSize"] = "2";
+
+            SolverUtils::FilterSharedPtr ascii = CreateFilter(
+                session, "TestHistoryPoints_ascii",
+                SolverUtils::Filter::ParamMap());
+            SolverUtils::FilterSharedPtr binary = CreateFilter(
+                session, "TestHistoryPoints_binary", binParams);
+
+            const int nout = 3;
+            for (int r = 0; r < nout; ++r)
+            {
+                NekDouble time = 0.1 * r;
+                SetFields(fields, phys, time);
+
+                if (r == 0)
+                {
+                    ascii ->Initialise(fields, time);
+                    binary->Initialise(fields, time);
+                }
+                else
+                {
+                    ascii ->Update(fields, time);
+                    binary->Update(fields, time);
+                }
+            }
+
+            // The third output of the binary file is still buffered.
+            std::vector<NekDouble> data;
+            ReadBinary("TestHistoryPoints_binary.his", data);
+            CheckRecords(data, expected, 2);
+
+            ascii ->Finalise(fields, 0.1 * (nout - 1));
+            binary->Finalise(fields, 0.1 * (nout - 1));
+
+            data.clear();
+            ReadAscii("TestHistoryPoints_ascii.his", 0, data);
+            CheckRecords(data, expected, nout);
+
+            data.clear();
+            ReadBinary("TestHistoryPoints_binary.his", data);
+            CheckRecords(data, expected, nout);
+
+            boost::filesystem::remove("TestHistoryPoints_ascii.his");
+            boost::filesystem::remove("TestHistoryPoints_binary.his");
+            session->Finalise();
+        }
+
+        BOOST_AUTO_TEST_CASE(TestHistoryPointsHomogeneous1D)
+        {
+            LibUtilities::SessionReaderSharedPtr session =
+                CreateSession(true);
+            SpatialDomains::MeshGraphSharedPtr graph =
+                SpatialDomains::MeshGraph::Read(session);
+
+            const int nz = 4;
+            LibUtilities::BasisKey homBasis(
+                LibUtilities::eFourier, nz,
+                LibUtilities::PointsKey(
+                    nz, LibUtilities::eFourierEvenlySpaced));
+
+            Array<OneD, MultiRegions::ExpListSharedPtr> fields(nfields);
+            Array<OneD, Array<OneD, NekDouble> >        phys(nfields);
+            for (int j = 0; j < nfields; ++j)
+            {
+                fields[j] = MemoryManager<MultiRegions::ExpList3DHomogeneous1D>
+                    ::AllocateSharedPtr(session, homBasis, 1.0, false, false,
+                                        graph, session->GetVariable(j));
+            }
+
+            // Fields in wave space, as for the solvers which advance the
+            // Fourier modes.
+            int nq = fields[0]->GetTotPoints();
+            Array<OneD, NekDouble> x(nq), y(nq), z(nq), tmp(nq);
+            fields[0]->GetCoords(x, y, z);
+            for (int j = 0; j < nfields; ++j)
+            {
+                for (int i = 0; i < nq; ++i)
+                {
+                    tmp[i] = FieldXY(j, x[i], y[i]) * FieldZ(z[i]);
+                }
+                phys[j] = Array<OneD, NekDouble>(nq);
+                fields[j]->HomogeneousFwdTrans(tmp, phys[j]);
+                fields[j]->SetWaveSpace(true);
+            }
+
+            // In physical space, the value at each point, and in wave space
+            // the Fourier mode of the plane of the point, evaluated
+            // independently of the filter.
+            MultiRegions::ExpListSharedPtr plane = fields[0]->GetPlane(0);
+            int nppp = plane->GetTotPoints();
+
+            NekDouble expPhys[npts][nfields], expWave[npts][nfields];
+            for (int i = 0; i < npts; ++i)
+            {
+                Array<OneD, NekDouble> coord(2);
+                coord[0] = px[i];
+                coord[1] = py[i];
+
+                int id = plane->GetExpIndex(coord, NekConstants::kNekZeroTol);
+                int k  = (int)(pz[i] * nz + 0.5);
+                BOOST_REQUIRE(id >= 0);
+
+                for (int j = 0; j < nfields; ++j)
+                {
+                    expPhys[i][j] = FieldXY(j, px[i], py[i]) * FieldZ(pz[i]);
+                    expWave[i][j] = plane->GetExp(id)->PhysEvaluate(
+                        coord, phys[j] + k * nppp + plane->GetPhys_Offset(id));
+                }
+            }
+
+            SolverUtils::Filter::ParamMap waveParams;
+            waveParams["WaveSpace"] = "True";
+
+            SolverUtils::FilterSharedPtr physFilter = CreateFilter(
+                session, "TestHistoryPoints_phys",
+                SolverUtils::Filter::ParamMap());
+            SolverUtils::FilterSharedPtr waveFilter = CreateFilter(
+                session, "TestHistoryPoints_wave", waveParams);
+
+            const int nout = 2;
+            for (int r = 0; r < nout; ++r)
+            {
+                NekDouble time = 0.1 * r;
+                SetFields(fields, phys, time);
+
+                if (r == 0)
+                {
+                    physFilter->Initialise(fields, time);
+                    waveFilter->Initialise(fields, time);
+                }
+                else
+                {
+                    physFilter->Update(fields, time);
+                    waveFilter->Update(fields, time);
+                }
+            }
+
+            physFilter->Finalise(fields, 0.1 * (nout - 1));
+            waveFilter->Finalise(fields, 0.1 * (nout - 1));
+
+            std::vector<NekDouble> data;
+            ReadAscii("TestHistoryPoints_phys.his", 0, data);
+            CheckRecords(data, expPhys, nout);
+
+            // The wave space output is marked as such in the header.
+            data.clear();
+            ReadAscii("TestHistoryPoints_wave.his", 1, data);
+            CheckRecords(data, expWave, nout);
+
+            boost::filesystem::remove("TestHistoryPoints_phys.his");
+            boost::filesystem::remove("TestHistoryPoints_wave.his");
+            session->Finalise();
+        }
+    }
+}
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestStdPhysEvaluate.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests the batch evaluation of standard expansions at
+// arbitrary points against the evaluation point by point.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <StdRegions/StdSegExp.h>
+#include <StdRegions/StdTriExp.h>
+#include <StdRegions/StdHexExp.h>
+#include <StdRegions/StdTetExp.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace StdPhysEvaluateUnitTests
+    {
+        /// Points with local coordinates in [-1, -0.7], which lie inside
+        /// every standard region, including the vertex (-1,-1,-1) which
+        /// coincides with a quadrature point.
+        Array<OneD, Array<OneD, NekDouble> > TestPoints(int dim, int npts)
+        {
+            Array<OneD, Array<OneD, NekDouble> > coords(dim);
+            for (int d = 0; d < dim; ++d)
+            {
+                coords[d] = Array<OneD, NekDouble>(npts);
+                for (int i = 0; i < npts; ++i)
+                {
+                    coords[d][i] = i == 0 ? -1.0 :
+                        -0.95 + 0.25 * std::fabs(std::sin(1.3 * i + 0.7 * d));
+                }
+            }
+            return coords;
+        }
+
+        void CheckPhysEvaluate(StdRegions::StdExpansion &exp)
+        {
+            const int dim  = exp.GetShapeDimension();
+            const int nq   = exp.GetTotPoints();
+            const int npts = 23;
+
+            Array<OneD, NekDouble> x(nq), y(nq), z(nq), phys(nq);
+            exp.GetCoords(x, y, z);
+            for (int i = 0; i < nq; ++i)
+            {
+                phys[i] = std::sin(x[i]) * std::cos(dim > 1 ? y[i] : 0.0) +
+                    (dim > 2 ? z[i] * z[i] : 0.0);
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > coords =
+                TestPoints(dim, npts);
+
+            Array<OneD, NekDouble> weights, values(npts);
+            exp.StdPhysEvaluateWeights(npts, coords, weights);
+            exp.StdPhysEvaluate(npts, weights, phys, values);
+
+            Array<OneD, NekDouble> Lcoord(dim);
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int d = 0; d < dim; ++d)
+                {
+                    Lcoord[d] = coords[d][i];
+                }
+
+                NekDouble exact = exp.PhysEvaluate(Lcoord, phys);
+                BOOST_CHECK_SMALL(values[i] - exact, 1e-12);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestStdSegExpPhysEvaluate)
+        {
+            LibUtilities::PointsKey pkey(
+                7, LibUtilities::eGaussLobattoLegendre);
+            LibUtilities::BasisKey bkey(
+                LibUtilities::eModified_A, 6, pkey);
+
+            StdRegions::StdSegExp exp(bkey);
+            CheckPhysEvaluate(exp);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestStdTriExpPhysEvaluate)
+        {
+            LibUtilities::PointsKey pkey0(
+                7, LibUtilities::eGaussLobattoLegendre);
+            LibUtilities::PointsKey pkey1(
+                6, LibUtilities::eGaussRadauMAlpha1Beta0);
+            LibUtilities::BasisKey bkey0(
+                LibUtilities::eModified_A, 6, pkey0);
+            LibUtilities::BasisKey bkey1(
+                LibUtilities::eModified_B, 6, pkey1);
+
+            StdRegions::StdTriExp exp(bkey0, bkey1);
+            CheckPhysEvaluate(exp);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestStdHexExpPhysEvaluate)
+        {
+            LibUtilities::PointsKey pkey(
+                6, LibUtilities::eGaussLobattoLegendre);
+            LibUtilities::BasisKey bkey(
+                LibUtilities::eModified_A, 5, pkey);
+
+            StdRegions::StdHexExp exp(bkey, bkey, bkey);
+            CheckPhysEvaluate(exp);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestStdTetExpPhysEvaluate)
+        {
+            LibUtilities::PointsKey pkey0(
+                6, LibUtilities::eGaussLobattoLegendre);
+            LibUtilities::PointsKey pkey1(
+                5, LibUtilities::eGaussRadauMAlpha1Beta0);
+            LibUtilities::PointsKey pkey2(
+                5, LibUtilities::eGaussRadauMAlpha2Beta0);
+            LibUtilities::BasisKey bkey0(
+                LibUtilities::eModified_A, 5, pkey0);
+            LibUtilities::BasisKey bkey1(
+                LibUtilities::eModified_B, 5, pkey1);
+            LibUtilities::BasisKey bkey2(
+                LibUtilities::eModified_C, 5, pkey2);
+
+            StdRegions::StdTetExp exp(bkey0, bkey1, bkey2);
+            CheckPhysEvaluate(exp);
+        }
+    }
+}
@@ -320,5 +320,45 @@ namespace Nektar
             BOOST_CHECK_CLOSE(xt[2], -5.0, epsilon);
             
         }
+
+        BOOST_AUTO_TEST_CASE(TestSolveMultiple)
+        {
+            NekMatrix<double, StandardMatrixTag> spd(3, 3,
+                                        ePOSITIVE_DEFINITE_SYMMETRIC);
+            spd.SetValue(0,0, 4.0);
+            spd.SetValue(0,1, 1.0);
+            spd.SetValue(0,2, 0.0);
+            spd.SetValue(1,1, 3.0);
+            spd.SetValue(1,2, 1.0);
+            spd.SetValue(2,2, 2.0);
+
+            double full_buf[] = {4.0, 1.0, 2.0,
+                                 1.0, 5.0, 1.0,
+                                 3.0, 0.0, 6.0};
+            NekMatrix<double> full(3, 3, full_buf);
+
+            double b_buf[] = {1.0, 2.0, 3.0,
+                              -4.0, 0.5, 7.0};
+
+            LinearSystem linsys[2] = {LinearSystem(spd), LinearSystem(full)};
+
+            double epsilon = 1e-11;
+            for (int n = 0; n < 2; ++n)
+            {
+                Array<OneD, double> x(6, b_buf);
+                linsys[n].SolveMultiple(2, x);
+
+                for (int j = 0; j < 2; ++j)
+                {
+                    NekVector<double> b(3, b_buf + 3*j);
+                    NekVector<double> xj = linsys[n].Solve(b);
+
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        BOOST_CHECK_CLOSE(x[3*j+i], xj[i], epsilon);
+                    }
+                }
+            }
+        }
     }
 }
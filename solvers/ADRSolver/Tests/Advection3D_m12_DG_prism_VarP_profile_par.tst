@@ -0,0 +1,31 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>3D unsteady DG advection, prisms, order 4, P=Variable, profiled in parallel</description>
+    <executable>ADRSolver</executable>
+    <parameters>--use-metis --profile Advection3D_m12_DG_prism_VarP.xml</parameters>
+    <processes>3</processes>
+    <files>
+        <file description="Session File">Advection3D_m12_DG_prism_VarP.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-12">1.74811e-05</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-12">0.00323074</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^\s*(TimeStep|Advection)\s+(\d+)\s.*</regex>
+            <matches>
+                <match>
+                    <field>TimeStep</field>
+                    <field intTolerance="0">10</field>
+                </match>
+                <match>
+                    <field>Advection</field>
+                    <field intTolerance="0">40</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
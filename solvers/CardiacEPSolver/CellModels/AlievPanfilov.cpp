@@ -67,117 +67,122 @@ namespace Nektar
         m_tmp2 = Array<OneD, NekDouble>(m_nq, 0.0);
 
         m_nvar = 2;
+        m_blockUpdate = true;
         m_concentrations.push_back(1);
     }
 
 
-    void CellModelAlievPanfilov::v_Update(
+    void CellModelAlievPanfilov::v_UpdatePoints(
                     const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                           Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                    const NekDouble time)
+                    const NekDouble time,
+                    const int start,
+                    const int end)
     {
+        int n = end - start;
+
         // inarray[0] holds initial physical u values throughout
         // inarray[1] holds initial physical v values throughout
 
         // compute u^2: m_u = u*u
-        Vmath::Vmul(m_nq, &inarray[0][0], 1, &inarray[0][0], 1, &m_uu[0], 1);
+        Vmath::Vmul(n, &inarray[0][start], 1, &inarray[0][start], 1, &m_uu[start], 1);
 
         // compute u^3: m_u = u*u*u
-        Vmath::Vmul(m_nq, &inarray[0][0], 1, &m_uu[0], 1, &m_uuu[0], 1);
+        Vmath::Vmul(n, &inarray[0][start], 1, &m_uu[start], 1, &m_uuu[start], 1);
 
         // --------------------------------------
         // Compute reaction term f(u,v)
         // --------------------------------------
 //        if (m_spatialParameters->Exists("a"))
 //        {
-//          Vmath::Vmul(m_nq,  &m_spatialParameters->GetData("a")->GetPhys()[0], 1,
-//                           &inarray[0][0], 1, &m_tmp1[0], 1);
+//          Vmath::Vmul(n,  &m_spatialParameters->GetData("a")->GetPhys()[start], 1,
+//                           &inarray[0][start], 1, &m_tmp1[start], 1);
 //
-//          Vmath::Vvtvm(m_nq, &m_spatialParameters->GetData("a")->GetPhys()[0], 1,
-//                           &m_uu[0], 1, &m_tmp1[0], 1, &m_tmp1[0], 1);
+//          Vmath::Vvtvm(n, &m_spatialParameters->GetData("a")->GetPhys()[start], 1,
+//                           &m_uu[start], 1, &m_tmp1[start], 1, &m_tmp1[start], 1);
 //
-//          Vmath::Svtvm(m_nq, -1.0, &m_uu[0], 1, &m_tmp1[0], 1, &m_tmp1[0], 1);
+//          Vmath::Svtvm(n, -1.0, &m_uu[start], 1, &m_tmp1[start], 1, &m_tmp1[start], 1);
 //        }
 //        else
 //        {
           // Ru = au
-          Vmath::Smul(m_nq, m_a, &inarray[0][0], 1, &m_tmp1[0], 1);
+          Vmath::Smul(n, m_a, &inarray[0][start], 1, &m_tmp1[start], 1);
           // Ru = (-1-a)u*u + au
-          Vmath::Svtvp(m_nq, (-1.0-m_a), &m_uu[0], 1, &m_tmp1[0], 1,
-                                       &m_tmp1[0], 1);
+          Vmath::Svtvp(n, (-1.0-m_a), &m_uu[start], 1, &m_tmp1[start], 1,
+                                       &m_tmp1[start], 1);
 //        }
         // Ru = u*u*u - (1+a)u*u + au
-        Vmath::Vadd(m_nq, &m_uuu[0], 1, &m_tmp1[0], 1, &m_tmp1[0], 1);
+        Vmath::Vadd(n, &m_uuu[start], 1, &m_tmp1[start], 1, &m_tmp1[start], 1);
         // Ru = k(u*u*u - (1+a)u*u + au)
 //        if (m_spatialParameters->Exists("k"))
 //        {
-//          Vmath::Vmul(m_nq, &m_spatialParameters->GetData("k")->GetPhys()[0], 1,
-//                          &m_tmp1[0], 1, &m_tmp1[0], 1);
+//          Vmath::Vmul(n, &m_spatialParameters->GetData("k")->GetPhys()[start], 1,
+//                          &m_tmp1[start], 1, &m_tmp1[start], 1);
 //        }
 //        else
 //        {
-          Vmath::Smul(m_nq, m_k, &m_tmp1[0], 1, &m_tmp1[0], 1);
+          Vmath::Smul(n, m_k, &m_tmp1[start], 1, &m_tmp1[start], 1);
 //        }
 
         // Ru = k(u*u*u - (1+a)u*u + au) + I_stim
-        Vmath::Vadd(m_nq, &outarray[0][0], 1, &m_tmp1[0], 1, &outarray[0][0], 1);
+        Vmath::Vadd(n, &outarray[0][start], 1, &m_tmp1[start], 1, &outarray[0][start], 1);
 
         // Ru = k(u*u*u - (1+a)u*u + au) + uv + I_stim
-        Vmath::Vvtvp(m_nq, &inarray[0][0], 1, &inarray[1][0], 1, &m_tmp1[0], 1,
-                         &outarray[0][0], 1);
+        Vmath::Vvtvp(n, &inarray[0][start], 1, &inarray[1][start], 1, &m_tmp1[start], 1,
+                         &outarray[0][start], 1);
         // Ru = -k(u*u*u - (1+a)u*u + au) - uv - I_stim
-        Vmath::Neg(m_nq, &outarray[0][0], 1);
+        Vmath::Neg(n, &outarray[0][start], 1);
 
 
         // --------------------------------------
         // Compute reaction term g(u,v)
         // --------------------------------------
         // tmp2 = mu2 + u
-        Vmath::Sadd(m_nq, m_mu2, &inarray[0][0], 1, &m_tmp2[0], 1);
+        Vmath::Sadd(n, m_mu2, &inarray[0][start], 1, &m_tmp2[start], 1);
 
         // tmp2 = v/(mu2 + u)
-        Vmath::Vdiv(m_nq, &inarray[1][0], 1, &m_tmp2[0], 1, &m_tmp2[0], 1);
+        Vmath::Vdiv(n, &inarray[1][start], 1, &m_tmp2[start], 1, &m_tmp2[start], 1);
 
         // tmp2 = mu1*v/(mu2 + u)
-        Vmath::Smul(m_nq, m_mu1, &m_tmp2[0], 1, &m_tmp2[0], 1);
+        Vmath::Smul(n, m_mu1, &m_tmp2[start], 1, &m_tmp2[start], 1);
 
         // tmp1 = Eps + mu1*v/(mu2+u)
-        Vmath::Sadd(m_nq, m_eps, &m_tmp2[0], 1, &m_tmp2[0], 1);
+        Vmath::Sadd(n, m_eps, &m_tmp2[start], 1, &m_tmp2[start], 1);
 
         // tmp1 = (-a-1) + u
 //        if (m_spatialParameters->Exists("a"))
 //        {
-//          Vmath::Vsub(m_nq, &inarray[0][0], 1,
-//                          &m_spatialParameters->GetData("a")->GetPhys()[0], 1,
-//                          &m_tmp1[0], 1);
+//          Vmath::Vsub(n, &inarray[0][start], 1,
+//                          &m_spatialParameters->GetData("a")->GetPhys()[start], 1,
+//                          &m_tmp1[start], 1);
 //
-//          Vmath::Sadd(m_nq, -1.0, &inarray[0][0], 1, &m_tmp1[0], 1);
+//          Vmath::Sadd(n, -1.0, &inarray[0][start], 1, &m_tmp1[start], 1);
 //        }
 //        else
 //        {
-          Vmath::Sadd(m_nq, (-m_a-1), &inarray[0][0], 1, &m_tmp1[0], 1);
+          Vmath::Sadd(n, (-m_a-1), &inarray[0][start], 1, &m_tmp1[start], 1);
 //        }
 
         // tmp1 = k(u-a-1)
 //        if (m_spatialParameters->Exists("k"))
 //        {
-//          Vmath::Vmul(m_nq, &m_spatialParameters->GetData("k")->GetPhys()[0], 1,
-//                          &m_tmp1[0], 1, &m_tmp1[0], 1);
+//          Vmath::Vmul(n, &m_spatialParameters->GetData("k")->GetPhys()[start], 1,
+//                          &m_tmp1[start], 1, &m_tmp1[start], 1);
 //        }
 //        else
 //        {
-          Vmath::Smul(m_nq, m_k, &m_tmp1[0], 1, &m_tmp1[0], 1);
+          Vmath::Smul(n, m_k, &m_tmp1[start], 1, &m_tmp1[start], 1);
 //        }
 
         // tmp1 = ku(u-a-1) + v
-        Vmath::Vvtvp(m_nq, &inarray[0][0], 1, &m_tmp1[0], 1, &inarray[1][0], 1,
-                         &m_tmp1[0], 1);
+        Vmath::Vvtvp(n, &inarray[0][start], 1, &m_tmp1[start], 1, &inarray[1][start], 1,
+                         &m_tmp1[start], 1);
 
         // tmp1 = -ku(u-a-1)-v
-        Vmath::Neg(m_nq, &m_tmp1[0], 1);
+        Vmath::Neg(n, &m_tmp1[start], 1);
 
         // outarray = [Eps + mu1*v/(mu2+u)] * [-ku(u-a-1)-v]
-        Vmath::Vmul(m_nq, &m_tmp1[0], 1, &m_tmp2[0], 1, &outarray[1][0], 1);
+        Vmath::Vmul(n, &m_tmp1[start], 1, &m_tmp2[start], 1, &outarray[1][start], 1);
     }
 
     /**
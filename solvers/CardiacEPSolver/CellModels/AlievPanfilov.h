@@ -61,10 +61,12 @@ namespace Nektar
         virtual ~CellModelAlievPanfilov() {}
 
     protected:
-        virtual void v_Update(
+        virtual void v_UpdatePoints(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                const NekDouble time);
+                const NekDouble time,
+                const int start,
+                const int end);
 
         virtual void v_GenerateSummary(SummaryList& s);
 
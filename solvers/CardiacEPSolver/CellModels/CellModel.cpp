@@ -35,10 +35,12 @@
 
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 
+#include <LibUtilities/BasicUtils/Thread.h>
+
 #include <CardiacEPSolver/CellModels/CellModel.h>
 
 #include <StdRegions/StdNodalTriExp.h>
-//#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
 
 using namespace std;
 
@@ -61,8 +63,72 @@ namespace Nektar
      * time-integrated using the Rush-Larsen method and for each variable y,
      * the corresponding y_inf and tau_y value is computed by Update(). The tau
      * values are stored in separate storage to inarray/outarray, #m_gates_tau.
+     *
+     * The time integration is applied to blocks of #m_blockSize points, set
+     * by the parameter CellModelBlockSize, which are dispatched to the session
+     * thread pool if it has been started. Models whose rates are computed
+     * independently at each point implement v_UpdatePoints and set
+     * #m_blockUpdate, so that all substeps of a block, including the rate
+     * evaluation, are taken while the block is in cache. Other models
+     * implement v_Update for all points at once.
+     *
+     * Models may register the functions of the membrane potential alone, such
+     * as the steady states and time constants of most gates, with
+     * SetVoltageFunction. If the parameter CellModelLookupStep is positive,
+     * the functions are tabulated on [CellModelLookupVmin,
+     * CellModelLookupVmax] when the model is initialised, and
+     * LookupVoltageFunction interpolates them linearly from the table. The
+     * models evaluate the functions directly if there is no table or the
+     * membrane potential lies outside this range.
+     *
+     * For these models, substepping may also be restricted to the points
+     * where the cell is active. If the parameter CellModelActiveDVdt is
+     * positive, points where |dV/dt| exceeds it are active. If the parameter
+     * CellModelActiveGateChange is positive, points where a gate would change
+     * by more than it over a PDE timestep are active. Other points take a
+     * single step over the PDE timestep. The points are classified after
+     * each timestep from the final rates, and all points are initially
+     * active.
      */
 
+    /**
+     * @brief Job integrating the cell model on a single block of points.
+     */
+    class CellModel::BlockJob : public Thread::ThreadJob
+    {
+    public:
+        BlockJob(CellModel      *model,
+                 const int       start,
+                 const int       end,
+                 const NekDouble delta_t,
+                 const NekDouble time,
+                 const int       nSteps,
+                 const bool      lastVoltage)
+            : m_model(model), m_start(start), m_end(end), m_delta_t(delta_t),
+              m_time(time), m_nSteps(nSteps), m_lastVoltage(lastVoltage)
+        {
+        }
+
+        virtual ~BlockJob()
+        {
+        }
+
+        virtual void Run()
+        {
+            m_model->IntegratePoints(m_start, m_end, m_delta_t, m_time,
+                                     m_nSteps, m_lastVoltage);
+        }
+
+    private:
+        CellModel *m_model;
+        int        m_start;
+        int        m_end;
+        NekDouble  m_delta_t;
+        NekDouble  m_time;
+        int        m_nSteps;
+        bool       m_lastVoltage;
+    };
+
     /**
      * Cell model base class constructor.
      */
@@ -75,6 +141,16 @@ namespace Nektar
         m_substeps = pSession->GetParameter("Substeps");
         m_nvar = 0;
         m_useNodal = false;
+        m_blockUpdate = false;
+        m_voltageNumValues = 0;
+        m_lookupVmin = 0.0;
+        m_lookupInvStep = 0.0;
+        m_lookupNumSteps = 0;
+        pSession->LoadParameter("CellModelBlockSize", m_blockSize, 256);
+        ASSERTL0(m_blockSize > 0, "CellModelBlockSize must be positive.");
+        pSession->LoadParameter("CellModelActiveDVdt", m_activeDVdt, 0.0);
+        pSession->LoadParameter("CellModelActiveGateChange",
+                                m_activeGateChange, 0.0);
 
         // Number of points in nodal space is the number of coefficients
         // in modified basis
@@ -84,12 +160,16 @@ namespace Nektar
             s.insert(m_field->GetExp(i)->DetShapeType());
         }
 
-        // Use nodal projection if only triangles
-        if (s.size() == 1 && (s.count(LibUtilities::eTriangle) == 1 || 
-                              s.count(LibUtilities::eTetrahedron) == 1))
+        // Use nodal projection if only triangles. This is only enabled on
+        // request, as it causes problems at high order.
+        bool useNodal;
+        pSession->MatchSolverInfo("CellModelProjection", "Nodal",
+                                  useNodal, false);
+        if (useNodal && s.size() == 1 &&
+                (s.count(LibUtilities::eTriangle) == 1 ||
+                 s.count(LibUtilities::eTetrahedron) == 1))
         {
-            // This is disabled for now as it causes problems at high order.
-            // m_useNodal = true;
+            m_useNodal = true;
         }
 
         // ---------------------------
@@ -131,10 +211,11 @@ namespace Nektar
         
         m_cellSol = Array<OneD, Array<OneD, NekDouble> >(m_nvar);
         m_wsp = Array<OneD, Array<OneD, NekDouble> >(m_nvar);
+        m_wspData = Array<OneD, NekDouble>(m_nvar * m_nq);
         for (unsigned int i = 0; i < m_nvar; ++i)
         {
             m_cellSol[i] = Array<OneD, NekDouble>(m_nq);
-            m_wsp[i] = Array<OneD, NekDouble>(m_nq);
+            m_wsp[i] = Array<OneD, NekDouble>(m_nq, m_wspData + i * m_nq);
         }
         m_gates_tau = Array<OneD, Array<OneD, NekDouble> >(m_gates.size());
         for (unsigned int i = 0; i < m_gates.size(); ++i)
@@ -142,6 +223,13 @@ namespace Nektar
             m_gates_tau[i] = Array<OneD, NekDouble>(m_nq);
         }
 
+        BuildLookupTable();
+
+        if (m_blockUpdate && (m_activeDVdt > 0.0 || m_activeGateChange > 0.0))
+        {
+            m_active = Array<OneD, int>(m_nq, 1);
+        }
+
         if (m_session->DefinesFunction("CellModelInitialConditions"))
         {
             LoadCellModel();
@@ -152,6 +240,50 @@ namespace Nektar
         }
     }
 
+    /**
+     * Registers @p func, which computes @p nValues values from the membrane
+     * potential, to be tabulated when the model is initialised. This is
+     * typically called from the constructor of the model.
+     */
+    void CellModel::SetVoltageFunction(
+            const int nValues, VoltageFunction func)
+    {
+        ASSERTL0(nValues > 0, "Voltage function must compute a value.");
+        m_voltageNumValues = nValues;
+        m_voltageFunction  = func;
+    }
+
+    /**
+     * Samples the registered voltage function at the nodes of the lookup
+     * table, if a positive CellModelLookupStep is given.
+     */
+    void CellModel::BuildLookupTable()
+    {
+        NekDouble step, vmax;
+        m_session->LoadParameter("CellModelLookupStep", step, 0.0);
+        m_session->LoadParameter("CellModelLookupVmin", m_lookupVmin, -100.0);
+        m_session->LoadParameter("CellModelLookupVmax", vmax, 100.0);
+
+        m_lookupTable.clear();
+        if (!m_voltageFunction || step <= 0.0)
+        {
+            return;
+        }
+
+        ASSERTL0(vmax > m_lookupVmin,
+                 "CellModelLookupVmax must exceed CellModelLookupVmin.");
+
+        m_lookupNumSteps = (int) ceil((vmax - m_lookupVmin) / step);
+        m_lookupInvStep  = 1.0 / step;
+        m_lookupTable.resize((m_lookupNumSteps + 1) * m_voltageNumValues);
+
+        for (int k = 0; k <= m_lookupNumSteps; ++k)
+        {
+            m_voltageFunction(m_lookupVmin + k * step,
+                              &m_lookupTable[k * m_voltageNumValues]);
+        }
+    }
+
     /**
      * Integrates the cell model for one PDE time-step. Cell model is
      * sub-stepped.
@@ -165,9 +297,8 @@ namespace Nektar
                   Array<OneD,       Array<OneD, NekDouble> > &outarray,
             const NekDouble time)
     {
-        int phys_offset = 0;
-        int coef_offset = 0;
-        int nvar = inarray.num_elements();
+        int nvar  = inarray.num_elements();
+        int nPhys = m_field->GetTotPoints();
         Array<OneD, NekDouble> tmp;
 
         // ---------------------------
@@ -176,36 +307,33 @@ namespace Nektar
         {
             if (!m_nodalTmp.num_elements())
             {
-                m_nodalTmp = Array<OneD, Array<OneD, NekDouble> >(nvar);
-                for (unsigned int k = 0; k < nvar; ++k)
+                m_nodalTmp = Array<OneD, NekDouble>(nvar * m_nq);
+                if (nvar > 1)
                 {
-                    m_nodalTmp[k] = Array<OneD, NekDouble>(m_nq);
+                    m_nodalPhys = Array<OneD, NekDouble>(nvar * nPhys);
                 }
+                SetUpNodalTransforms();
             }
 
-            // Move to nodal points
-            Array<OneD, NekDouble> tmpCoeffs(max(m_nodalTri->GetNcoeffs(), m_nodalTet->GetNcoeffs()));
-
-            for (unsigned int k = 0; k < nvar; ++k)
+            // Move to nodal points. The variables are gathered so that they
+            // are transformed together.
+            if (nvar > 1)
             {
-                for (unsigned int i = 0; i < m_field->GetNumElmts(); ++i)
+                for (unsigned int k = 0; k < nvar; ++k)
                 {
-                    phys_offset = m_field->GetPhys_Offset(i);
-                    coef_offset = m_field->GetCoeff_Offset(i);
-                    if (m_field->GetExp(0)->DetShapeType() == LibUtilities::eTriangle)
-                    {
-                        m_field->GetExp(0)->FwdTrans(inarray[k] + phys_offset, tmpCoeffs);
-                        m_nodalTri->ModalToNodal(tmpCoeffs, tmp=m_nodalTmp[k]+coef_offset);
-                    }
-                    else
-                    {
-                        m_field->GetExp(0)->FwdTrans(inarray[k] + phys_offset, tmpCoeffs);
-                        m_nodalTet->ModalToNodal(tmpCoeffs, tmp=m_nodalTmp[k]+coef_offset);
-                    }
+                    Vmath::Vcopy(nPhys, inarray[k], 1,
+                                 tmp = m_nodalPhys + k * nPhys, 1);
                 }
+                ApplyNodalTransform(m_physToNodal, nvar, m_nodalPhys,
+                                    m_nodalTmp);
+            }
+            else
+            {
+                ApplyNodalTransform(m_physToNodal, nvar, inarray[0],
+                                    m_nodalTmp);
             }
             // Copy new transmembrane potential into cell model
-            Vmath::Vcopy(m_nq, m_nodalTmp[0], 1, m_cellSol[0], 1);
+            Vmath::Vcopy(m_nq, m_nodalTmp, 1, m_cellSol[0], 1);
         }
         else
         {
@@ -216,77 +344,337 @@ namespace Nektar
 
         NekDouble delta_t = (time - m_lastTime)/m_substeps;
 
-
-        // Perform substepping
-        for (unsigned int i = 0; i < m_substeps - 1; ++i)
+        // Perform substepping. The membrane potential is not integrated in
+        // the final step, since dV/dt is returned to the PDE system.
+        if (m_blockUpdate)
         {
-            Update(m_cellSol, m_wsp, time);
-            // Voltage
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
-            // Ion concentrations
-            for (unsigned int j = 0; j < m_concentrations.size(); ++j)
-            {
-                Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
-            }
-            // Gating variables: Rush-Larsen scheme
-            for (unsigned int j = 0; j < m_gates.size(); ++j)
+            IntegrateBlocks(delta_t, time, m_substeps, false);
+        }
+        else
+        {
+            for (unsigned int i = 0; i < m_substeps - 1; ++i)
             {
-                Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-                Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-                Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-                Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                Update(m_cellSol, m_wsp, time);
+                IntegrateBlocks(delta_t, time, 1, true);
             }
-        }
 
-        // Perform final cell model step
-        Update(m_cellSol, m_wsp, time);
+            Update(m_cellSol, m_wsp, time);
+            IntegrateBlocks(delta_t, time, 1, false);
+        }
 
         // Output dV/dt from last step but integrate remaining cell model vars
         // Transform cell model I_total from nodal to modal space
         if (m_useNodal)
         {
-            Array<OneD, NekDouble> tmpCoeffs(max(m_nodalTri->GetNcoeffs(), m_nodalTet->GetNcoeffs()));
-
-            for (unsigned int k = 0; k < nvar; ++k)
+            // The rates of the variables are consecutive in #m_wspData.
+            if (nvar > 1)
             {
-                for (unsigned int i = 0; i < m_field->GetNumElmts(); ++i)
+                ApplyNodalTransform(m_nodalToPhys, nvar, m_wspData,
+                                    m_nodalPhys);
+                for (unsigned int k = 0; k < nvar; ++k)
                 {
-                    int phys_offset = m_field->GetPhys_Offset(i);
-                    int coef_offset = m_field->GetCoeff_Offset(i);
-                    if (m_field->GetExp(0)->DetShapeType() == LibUtilities::eTriangle)
-                    {
-                        m_nodalTri->NodalToModal(m_wsp[k]+coef_offset, tmpCoeffs);
-                        m_field->GetExp(0)->BwdTrans(tmpCoeffs, tmp=outarray[k] + phys_offset);
-                    }
-                    else
-                    {
-                        m_nodalTet->NodalToModal(m_wsp[k]+coef_offset, tmpCoeffs);
-                        m_field->GetExp(0)->BwdTrans(tmpCoeffs, tmp=outarray[k] + phys_offset);
-                    }
+                    Vmath::Vcopy(nPhys, m_nodalPhys + k * nPhys, 1,
+                                 outarray[k], 1);
                 }
             }
+            else
+            {
+                ApplyNodalTransform(m_nodalToPhys, nvar, m_wspData,
+                                    outarray[0]);
+            }
         }
         else
         {
             Vmath::Vcopy(m_nq, m_wsp[0], 1, outarray[0], 1);
         }
 
-        // Ion concentrations
-        for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+        m_lastTime = time;
+    }
+
+    /**
+     * Sets up the matrices mapping the physical values of an element to the
+     * values at the nodal points of #m_nodalTri or #m_nodalTet and back,
+     * which combine the forward or backward transform of the element with
+     * the modal to nodal transform or its inverse. Nodal projection requires
+     * all elements to have the same shape and order, so the same matrices
+     * apply to every element.
+     */
+    void CellModel::SetUpNodalTransforms()
+    {
+        StdRegions::StdExpansionSharedPtr exp = m_field->GetExp(0);
+        bool tri = exp->DetShapeType() == LibUtilities::eTriangle;
+
+        int nPhys   = exp->GetTotPoints();
+        int nCoeffs = exp->GetNcoeffs();
+        int nNodal  = tri ? m_nodalTri->GetNcoeffs()
+                          : m_nodalTet->GetNcoeffs();
+        int nElmt   = m_field->GetNumElmts();
+
+        ASSERTL0(nNodal == nCoeffs,
+                 "Nodal expansion does not match the field expansion.");
+        ASSERTL0(m_field->GetTotPoints() == nElmt * nPhys &&
+                 m_nq == nElmt * nNodal,
+                 "Nodal projection requires elements of the same order.");
+
+        m_physToNodal = MemoryManager<DNekMat>::AllocateSharedPtr(
+            nNodal, nPhys, 0.0);
+        m_nodalToPhys = MemoryManager<DNekMat>::AllocateSharedPtr(
+            nPhys, nNodal, 0.0);
+
+        Array<OneD, NekDouble> unit(max(nPhys, nNodal), 0.0);
+        Array<OneD, NekDouble> coeffs(nCoeffs), tmp(max(nPhys, nNodal));
+        int i, j;
+
+        for (j = 0; j < nPhys; ++j)
+        {
+            unit[j] = 1.0;
+            exp->FwdTrans(unit, coeffs);
+            if (tri)
+            {
+                m_nodalTri->ModalToNodal(coeffs, tmp);
+            }
+            else
+            {
+                m_nodalTet->ModalToNodal(coeffs, tmp);
+            }
+            unit[j] = 0.0;
+
+            for (i = 0; i < nNodal; ++i)
+            {
+                (*m_physToNodal)(i, j) = tmp[i];
+            }
+        }
+
+        for (j = 0; j < nNodal; ++j)
+        {
+            unit[j] = 1.0;
+            if (tri)
+            {
+                m_nodalTri->NodalToModal(unit, coeffs);
+            }
+            else
+            {
+                m_nodalTet->NodalToModal(unit, coeffs);
+            }
+            exp->BwdTrans(coeffs, tmp);
+            unit[j] = 0.0;
+
+            for (i = 0; i < nPhys; ++i)
+            {
+                (*m_nodalToPhys)(i, j) = tmp[i];
+            }
+        }
+    }
+
+    /**
+     * Applies the element matrix @p mat to all elements of the @p nvar
+     * variables stored one after the other in @p in at once. Since the
+     * elements have the same size, their values form the columns of a
+     * matrix, and the transform is a single matrix-matrix product.
+     */
+    void CellModel::ApplyNodalTransform(
+            const DNekMatSharedPtr             &mat,
+            const int                           nvar,
+            const Array<OneD, const NekDouble> &in,
+                  Array<OneD,       NekDouble> &out)
+    {
+        int nRows = mat->GetRows();
+        int nCols = mat->GetColumns();
+        int nElmt = m_field->GetNumElmts();
+
+        Blas::Dgemm('N', 'N', nRows, nvar * nElmt, nCols, 1.0,
+                    mat->GetRawPtr(), nRows, in.get(), nCols,
+                    0.0, out.get(), nRows);
+    }
+
+    /**
+     * Rates are computed for all points at once by the model.
+     */
+    void CellModel::v_Update(
+            const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                  Array<OneD,        Array<OneD, NekDouble> >&outarray,
+            const NekDouble time)
+    {
+        v_UpdatePoints(inarray, outarray, time, 0, m_nq);
+    }
+
+    /**
+     * Computes the derivatives, or for gates the y_inf and tau_y values, of
+     * the points [start, end) only. This may be called concurrently on
+     * disjoint ranges of points and must therefore not modify any other
+     * state of the model.
+     */
+    void CellModel::v_UpdatePoints(
+            const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                  Array<OneD,        Array<OneD, NekDouble> >&outarray,
+            const NekDouble time,
+            const int start,
+            const int end)
+    {
+        NEKERROR(ErrorUtil::efatal,
+                 "Cell model does not implement v_Update or v_UpdatePoints.");
+    }
+
+    /**
+     * Integrates all points of the cell model in blocks of #m_blockSize
+     * points, one job per block, using Thread::RunSessionJobs. The points of
+     * a cell model are independent, and each block only updates its own range
+     * of the cell states, gates and rates.
+     */
+    void CellModel::IntegrateBlocks(
+            const NekDouble delta_t,
+            const NekDouble time,
+            const int       nSteps,
+            const bool      lastVoltage)
+    {
+        vector<Thread::ThreadJob*> jobs;
+        for (int i = 0; i < m_nq; i += m_blockSize)
         {
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+            jobs.push_back(new BlockJob(this, i, min(i + m_blockSize, m_nq),
+                                        delta_t, time, nSteps, lastVoltage));
         }
 
-        // Gating variables: Rush-Larsen scheme
-        for (unsigned int j = 0; j < m_gates.size(); ++j)
+        Thread::RunSessionJobs(jobs);
+    }
+
+    /**
+     * Takes @p nSteps steps of the points [start, end). If adaptive
+     * substepping is enabled, the runs of consecutive active points take the
+     * substeps while the runs of resting points take a single step, and the
+     * points are then reclassified.
+     */
+    void CellModel::IntegratePoints(
+            const int       start,
+            const int       end,
+            const NekDouble delta_t,
+            const NekDouble time,
+            const int       nSteps,
+            const bool      lastVoltage)
+    {
+        if (m_active.num_elements() == 0 || nSteps < 2)
         {
-            Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-            Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+            StepPoints(start, end, delta_t, time, nSteps, lastVoltage);
+            return;
         }
 
-        m_lastTime = time;
+        // Active points are typically clustered around the wavefront, so
+        // that the runs of points in the same state are long.
+        int i = start;
+        while (i < end)
+        {
+            int j = i + 1;
+            while (j < end && m_active[j] == m_active[i])
+            {
+                ++j;
+            }
+
+            if (m_active[i])
+            {
+                StepPoints(i, j, delta_t, time, nSteps, lastVoltage);
+            }
+            else
+            {
+                StepPoints(i, j, delta_t * nSteps, time, 1, lastVoltage);
+            }
+
+            i = j;
+        }
+
+        ClassifyPoints(start, end, delta_t * nSteps);
+    }
+
+    /**
+     * Marks the points [start, end) as active if, with the rates of the last
+     * step, |dV/dt| exceeds #m_activeDVdt or a gate changes by more than
+     * #m_activeGateChange over a step of @p delta_t.
+     */
+    void CellModel::ClassifyPoints(
+            const int       start,
+            const int       end,
+            const NekDouble delta_t)
+    {
+        int i, j;
+
+        for (i = start; i < end; ++i)
+        {
+            m_active[i] = m_activeDVdt > 0.0 &&
+                fabs(m_wsp[0][i]) > m_activeDVdt;
+        }
+
+        if (m_activeGateChange <= 0.0)
+        {
+            return;
+        }
+
+        for (j = 0; j < m_gates.size(); ++j)
+        {
+            const NekDouble *y    = &m_cellSol[m_gates[j]][0];
+            const NekDouble *yinf = &m_wsp[m_gates[j]][0];
+            const NekDouble *tau  = &m_gates_tau[j][0];
+
+            for (i = start; i < end; ++i)
+            {
+                NekDouble change = fabs(y[i] - yinf[i]) *
+                    (1.0 - exp(-delta_t / tau[i]));
+                m_active[i] |= change > m_activeGateChange;
+            }
+        }
+    }
+
+    /**
+     * Takes @p nSteps steps of the points [start, end). If #m_blockUpdate is
+     * set, the rates of the block are evaluated before each step, otherwise
+     * the rates in #m_wsp are used. The membrane potential is not integrated
+     * in the last step unless @p lastVoltage is set.
+     *
+     * Each variable of the block is updated in a single pass, which the
+     * compiler can vectorise, while the block remains in cache.
+     */
+    void CellModel::StepPoints(
+            const int       start,
+            const int       end,
+            const NekDouble delta_t,
+            const NekDouble time,
+            const int       nSteps,
+            const bool      lastVoltage)
+    {
+        const int n = end - start;
+        int i, j, k;
+
+        for (k = 0; k < nSteps; ++k)
+        {
+            if (m_blockUpdate)
+            {
+                v_UpdatePoints(m_cellSol, m_wsp, time, start, end);
+            }
+
+            // Voltage and ion concentrations: forward Euler
+            for (j = (k < nSteps - 1 || lastVoltage) ? -1 : 0;
+                 j < (int)m_concentrations.size(); ++j)
+            {
+                int var = j < 0 ? 0 : m_concentrations[j];
+                NekDouble       *y    = &m_cellSol[var][start];
+                const NekDouble *dydt = &m_wsp[var][start];
+
+                for (i = 0; i < n; ++i)
+                {
+                    y[i] += delta_t * dydt[i];
+                }
+            }
+
+            // Gating variables: Rush-Larsen scheme
+            for (j = 0; j < m_gates.size(); ++j)
+            {
+                NekDouble       *y    = &m_cellSol[m_gates[j]][start];
+                const NekDouble *yinf = &m_wsp[m_gates[j]][start];
+                const NekDouble *tau  = &m_gates_tau[j][start];
+
+                for (i = 0; i < n; ++i)
+                {
+                    y[i] = yinf[i] + (y[i] - yinf[i]) * exp(-delta_t / tau[i]);
+                }
+            }
+        }
     }
 
     Array<OneD, NekDouble> CellModel::GetCellSolutionCoeffs(unsigned int idx)
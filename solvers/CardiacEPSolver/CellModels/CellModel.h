@@ -36,6 +36,10 @@
 #ifndef NEKTAR_SOLVERS_ADRSOLVER_CELLMODELS_CELLMODEL
 #define NEKTAR_SOLVERS_ADRSOLVER_CELLMODELS_CELLMODEL
 
+#include <vector>
+
+#include <boost/function.hpp>
+
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
@@ -61,6 +65,10 @@ namespace Nektar
                 const MultiRegions::ExpListSharedPtr&> CellModelFactory;
     CellModelFactory& GetCellModelFactory();
 
+    /// Function computing several values from the membrane potential.
+    typedef boost::function<void (const NekDouble, NekDouble *)>
+        VoltageFunction;
+
     /// Cell model base class.
     class CellModel
     {
@@ -121,19 +129,39 @@ namespace Nektar
         NekDouble m_lastTime;
         /// Number of substeps to take
         int m_substeps;
+        /// Number of points integrated together by a block job
+        int m_blockSize;
+        /// Flag indicating whether the model implements v_UpdatePoints, so
+        /// that rates are evaluated block by block
+        bool m_blockUpdate;
+        /// Threshold of |dV/dt| above which a point is active, or zero
+        NekDouble m_activeDVdt;
+        /// Threshold of the change of a gate over a PDE timestep above which
+        /// a point is active, or zero
+        NekDouble m_activeGateChange;
+        /// Flag indicating, for each point, whether it takes substeps
+        Array<OneD, int> m_active;
 
         /// Cell model solution variables
         Array<OneD, Array<OneD, NekDouble> > m_cellSol;
         /// Cell model integration workspace
         Array<OneD, Array<OneD, NekDouble> > m_wsp;
+        /// Storage of #m_wsp, in which the variables are consecutive
+        Array<OneD, NekDouble> m_wspData;
 
         /// Flag indicating whether nodal projection in use
         bool m_useNodal;
         /// StdNodalTri for cell model calculations
         StdRegions::StdNodalTriExpSharedPtr m_nodalTri;
         StdRegions::StdNodalTetExpSharedPtr m_nodalTet;
-        /// Temporary array for nodal projection
-        Array<OneD, Array<OneD, NekDouble> > m_nodalTmp;
+        /// Nodal values of the PDE variables, one after the other
+        Array<OneD, NekDouble> m_nodalTmp;
+        /// Physical values of the PDE variables, one after the other
+        Array<OneD, NekDouble> m_nodalPhys;
+        /// Transform from physical values to nodal values of an element
+        DNekMatSharedPtr m_physToNodal;
+        /// Transform from nodal values to physical values of an element
+        DNekMatSharedPtr m_nodalToPhys;
 
         /// Indices of cell model variables which are concentrations
         std::vector<int> m_concentrations;
@@ -142,10 +170,62 @@ namespace Nektar
         /// Storage for gate tau values
         Array<OneD, Array<OneD, NekDouble> > m_gates_tau;
 
+        /// Function of the membrane potential registered by the model, which
+        /// is sampled to build the lookup table
+        VoltageFunction m_voltageFunction;
+        /// Number of values computed by #m_voltageFunction
+        int m_voltageNumValues;
+        /// Lower bound of the membrane potential in the lookup table
+        NekDouble m_lookupVmin;
+        /// Inverse of the membrane potential step of the lookup table
+        NekDouble m_lookupInvStep;
+        /// Number of intervals of the lookup table
+        int m_lookupNumSteps;
+        /// Values of #m_voltageFunction, stored by membrane potential
+        std::vector<NekDouble> m_lookupTable;
+
+        void SetVoltageFunction(const int nValues, VoltageFunction func);
+
+        /// Interpolate the function registered by SetVoltageFunction from
+        /// the lookup table, returning false if there is no table or @p V
+        /// lies outside it.
+        inline bool LookupVoltageFunction(
+                const NekDouble V, NekDouble *values) const
+        {
+            if (m_lookupTable.size() == 0)
+            {
+                return false;
+            }
+
+            NekDouble x = (V - m_lookupVmin) * m_lookupInvStep;
+            if (x < 0.0 || x >= m_lookupNumSteps)
+            {
+                return false;
+            }
+
+            int       k = (int) x;
+            NekDouble w = x - k;
+            const NekDouble *lo = &m_lookupTable[k * m_voltageNumValues];
+            const NekDouble *hi = lo + m_voltageNumValues;
+
+            for (int j = 0; j < m_voltageNumValues; ++j)
+            {
+                values[j] = lo[j] + w * (hi[j] - lo[j]);
+            }
+            return true;
+        }
+
         virtual void v_Update(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                const NekDouble time) = 0;
+                const NekDouble time);
+
+        virtual void v_UpdatePoints(
+                const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                      Array<OneD,        Array<OneD, NekDouble> >&outarray,
+                const NekDouble time,
+                const int start,
+                const int end);
 
         virtual void v_GenerateSummary(SummaryList& s) = 0;
 
@@ -157,6 +237,46 @@ namespace Nektar
         virtual void v_SetInitialConditions() = 0;
 
         void LoadCellModel();
+
+    private:
+        class BlockJob;
+
+        void BuildLookupTable();
+
+        void SetUpNodalTransforms();
+
+        void ApplyNodalTransform(
+                const DNekMatSharedPtr             &mat,
+                const int                           nvar,
+                const Array<OneD, const NekDouble> &in,
+                      Array<OneD,       NekDouble> &out);
+
+        void IntegrateBlocks(
+                const NekDouble delta_t,
+                const NekDouble time,
+                const int       nSteps,
+                const bool      lastVoltage);
+
+        void IntegratePoints(
+                const int       start,
+                const int       end,
+                const NekDouble delta_t,
+                const NekDouble time,
+                const int       nSteps,
+                const bool      lastVoltage);
+
+        void StepPoints(
+                const int       start,
+                const int       end,
+                const NekDouble delta_t,
+                const NekDouble time,
+                const int       nSteps,
+                const bool      lastVoltage);
+
+        void ClassifyPoints(
+                const int       start,
+                const int       end,
+                const NekDouble delta_t);
     };
 
 }
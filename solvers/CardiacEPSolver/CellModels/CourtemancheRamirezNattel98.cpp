@@ -127,6 +127,7 @@ namespace Nektar
         }
 
         m_nvar = 21;
+        m_blockUpdate = true;
 
         // List gates and concentrations
         m_gates.push_back(1);
@@ -163,14 +164,35 @@ namespace Nektar
     
     
     
-    void CourtemancheRamirezNattel98::v_Update(
-                     const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
-                           Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                     const NekDouble time)
+    /**
+     * The rates are computed by whole-array operations, which are applied
+     * to views of the points [start, end) of the variables, rates and gate
+     * time constants.
+     */
+    void CourtemancheRamirezNattel98::v_UpdatePoints(
+                     const Array<OneD, const  Array<OneD, NekDouble> >&pInarray,
+                           Array<OneD,        Array<OneD, NekDouble> >&pOutarray,
+                     const NekDouble time,
+                     const int start,
+                     const int end)
     {
-        ASSERTL0(inarray.get() != outarray.get(),
+        ASSERTL0(pInarray.get() != pOutarray.get(),
                 "Must have different arrays for input and output.");
 
+        int nvar = pInarray.num_elements();
+        Array<OneD, Array<OneD, NekDouble> > inarray  (nvar);
+        Array<OneD, Array<OneD, NekDouble> > outarray (nvar);
+        Array<OneD, Array<OneD, NekDouble> > gates_tau(m_gates.size());
+        for (int k = 0; k < nvar; ++k)
+        {
+            inarray [k] = pInarray [k] + start;
+            outarray[k] = pOutarray[k] + start;
+        }
+        for (int k = 0; k < m_gates.size(); ++k)
+        {
+            gates_tau[k] = m_gates_tau[k] + start;
+        }
+
         // Variables
         //  0   V    membrane potential
         //  2   m    fast sodium current m gate
@@ -193,7 +215,7 @@ namespace Nektar
         //  19  K_i  Potassium
         //  20  Ca_rel Calcium Rel
         //  21  Ca_up  Calcium up
-        int n = m_nq;
+        int n = end - start;
         int i = 0;
         NekDouble alpha, beta;
         Vmath::Zero(n, outarray[0], 1);
@@ -432,7 +454,7 @@ namespace Nektar
         NekDouble * x_tau;
         NekDouble * x_new;
         // m
-        for (i = 0, v = &inarray[0][0], x = &inarray[1][0], x_new = &outarray[1][0], x_tau = &m_gates_tau[0][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[1][0], x_new = &outarray[1][0], x_tau = &gates_tau[0][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = (*v == (-47.13)) ? 3.2 : (0.32*(*v+47.13))/(1.0-exp((-0.1)*(*v + 47.13)));
@@ -441,7 +463,7 @@ namespace Nektar
             *x_new = alpha*(*x_tau);
         }
         // h
-        for (i = 0, v = &inarray[0][0], x = &inarray[2][0], x_new = &outarray[2][0], x_tau = &m_gates_tau[1][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[2][0], x_new = &outarray[2][0], x_tau = &gates_tau[1][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = (*v >= -40.0) ? 0.0 : 0.135*exp(-((*v)+80.0)/6.8);
@@ -451,7 +473,7 @@ namespace Nektar
             *x_new = alpha*(*x_tau);
         }
         // j
-        for (i = 0, v = &inarray[0][0], x = &inarray[3][0], x_new = &outarray[3][0], x_tau = &m_gates_tau[2][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[3][0], x_new = &outarray[3][0], x_tau = &gates_tau[2][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = (*v >= -40.0) ? 0.0
@@ -462,7 +484,7 @@ namespace Nektar
             *x_new = alpha*(*x_tau);
         }
         // oa
-        for (i = 0, v = &inarray[0][0], x = &inarray[4][0], x_new = &outarray[4][0], x_tau = &m_gates_tau[3][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[4][0], x_new = &outarray[4][0], x_tau = &gates_tau[3][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 0.65/(exp(-(*v+10.0)/8.5) + exp(-(*v-30.0)/59.0));
@@ -471,7 +493,7 @@ namespace Nektar
             *x_new = (1.0/(1.0+exp(-(*v+20.47)/17.54)));
         }
         // oi
-        for (i = 0, v = &inarray[0][0], x = &inarray[5][0], x_new = &outarray[5][0], x_tau = &m_gates_tau[4][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[5][0], x_new = &outarray[5][0], x_tau = &gates_tau[4][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 1.0/(18.53 + exp((*v+113.7)/10.95));
@@ -480,7 +502,7 @@ namespace Nektar
             *x_new = (1.0/(1.0+exp((*v+43.1)/5.3)));
         }
         // ua
-        for (i = 0, v = &inarray[0][0], x = &inarray[6][0], x_new = &outarray[6][0], x_tau = &m_gates_tau[5][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[6][0], x_new = &outarray[6][0], x_tau = &gates_tau[5][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 0.65/(exp(-(*v+10.0)/8.5)+exp(-(*v-30.0)/59.0));
@@ -489,7 +511,7 @@ namespace Nektar
             *x_new = 1.0/(1.0+exp(-(*v+30.3)/9.6));
         }
         // ui
-        for (i = 0, v = &inarray[0][0], x = &inarray[7][0], x_new = &outarray[7][0], x_tau = &m_gates_tau[6][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[7][0], x_new = &outarray[7][0], x_tau = &gates_tau[6][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 1.0/(21.0 + exp(-(*v-185.0)/28.0));
@@ -498,7 +520,7 @@ namespace Nektar
             *x_new = 1.0/(1.0+exp((*v-99.45)/27.48));
         }
         // xr
-        for (i = 0, v = &inarray[0][0], x = &inarray[8][0], x_new = &outarray[8][0], x_tau = &m_gates_tau[7][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[8][0], x_new = &outarray[8][0], x_tau = &gates_tau[7][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 0.0003*(*v+14.1)/(1-exp(-(*v+14.1)/5.0));
@@ -507,7 +529,7 @@ namespace Nektar
             *x_new = 1.0/(1+exp(-(*v+14.1)/6.5));
         }
         // xs
-        for (i = 0, v = &inarray[0][0], x = &inarray[9][0], x_new = &outarray[9][0], x_tau = &m_gates_tau[8][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[9][0], x_new = &outarray[9][0], x_tau = &gates_tau[8][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             alpha = 4e-5*(*v-19.9)/(1.0-exp(-(*v-19.9)/17.0));
@@ -516,14 +538,14 @@ namespace Nektar
             *x_new = 1.0/sqrt(1.0+exp(-(*v-19.9)/12.7));
         }
         // d
-        for (i = 0, v = &inarray[0][0], x = &inarray[10][0], x_new = &outarray[10][0], x_tau = &m_gates_tau[9][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[10][0], x_new = &outarray[10][0], x_tau = &gates_tau[9][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             *x_tau  = (1-exp(-(*v+10.0)/6.24))/(0.035*(*v+10.0)*(1+exp(-(*v+10.0)/6.24)));
             *x_new = 1.0/(1.0 + exp(-(*v+10)/8.0));
         }
         // f
-        for (i = 0, v = &inarray[0][0], x = &inarray[11][0], x_new = &outarray[11][0], x_tau = &m_gates_tau[10][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[11][0], x_new = &outarray[11][0], x_tau = &gates_tau[10][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             //alpha = 1.0/(1.0 + exp((*v+28.0)/6.9));
@@ -531,7 +553,7 @@ namespace Nektar
             *x_new = exp((-(*v + 28.0)) / 6.9) / (1.0 + exp((-(*v + 28.0)) / 6.9));
         }
         // f_Ca
-        for (i = 0, v = &inarray[0][0], x = &inarray[12][0], x_new = &outarray[12][0], x_tau = &m_gates_tau[11][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[12][0], x_new = &outarray[12][0], x_tau = &gates_tau[11][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             *x_tau  = 2.0;
@@ -543,21 +565,21 @@ namespace Nektar
         Vmath::Svtvm(n, 1e-12*JSR_V_rel, tmp_I_rel, 1, tmp_Fn, 1, tmp_Fn, 1);
 
         // u
-        for (i = 0, v = &tmp_Fn[0], x = &inarray[13][0], x_new = &outarray[13][0], x_tau = &m_gates_tau[12][0];
+        for (i = 0, v = &tmp_Fn[0], x = &inarray[13][0], x_new = &outarray[13][0], x_tau = &gates_tau[12][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             *x_tau  = 8.0;
             *x_new = 1.0/(1.0 + exp(-(*v - 3.4175e-13)/1.367e-15));
         }
         // v
-        for (i = 0, v = &tmp_Fn[0], x = &inarray[14][0], x_new = &outarray[14][0], x_tau = &m_gates_tau[13][0];
+        for (i = 0, v = &tmp_Fn[0], x = &inarray[14][0], x_new = &outarray[14][0], x_tau = &gates_tau[13][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             *x_tau  = 1.91 + 2.09/(1.0+exp(-(*v - 3.4175e-13)/13.67e-16));
             *x_new = 1.0 - 1.0/(1.0 + exp(-(*v - 6.835e-14)/13.67e-16));
         }
         // w
-        for (i = 0, v = &inarray[0][0], x = &inarray[15][0], x_new = &outarray[15][0], x_tau = &m_gates_tau[14][0];
+        for (i = 0, v = &inarray[0][0], x = &inarray[15][0], x_new = &outarray[15][0], x_tau = &gates_tau[14][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
         {
             *x_tau  = 6.0*(1.0-exp(-(*v-7.9)/5.0))/(1.0+0.3*exp(-(*v-7.9)/5.0))/(*v-7.9);
@@ -291,6 +291,7 @@ namespace Nektar
         m_gates.push_back(1);
         m_gates.push_back(2);
         m_nvar = 3;
+        m_blockUpdate = true;
 
         // Cherry-Fenton 2004 Model 3 has extra gating variable
         if (isCF3)
@@ -314,10 +315,12 @@ namespace Nektar
     
     
     
-    void FentonKarma::v_Update(
+    void FentonKarma::v_UpdatePoints(
                                  const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                                  Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                                 const NekDouble time )
+                                 const NekDouble time,
+                                 const int start,
+                                 const int end)
     {
         ASSERTL0(inarray.get() != outarray.get(),
                  "Must have different arrays for input and output.");
@@ -326,20 +329,20 @@ namespace Nektar
         //  0   u    membrane potential
         //  1   v    v gate
         //  2   w    w gate
-        int n = m_nq;
+        int n = end - start;
         int i = 0;
 
         // Declare pointers
-        const NekDouble *u = &inarray[0][0];
-        const NekDouble *v = &inarray[1][0];
-        const NekDouble *w = &inarray[2][0];
-        const NekDouble *y = isCF3 ? &inarray[3][0] : 0;
-        NekDouble *u_new   = &outarray[0][0];
-        NekDouble *v_new   = &outarray[1][0];
-        NekDouble *w_new   = &outarray[2][0];
+        const NekDouble *u = &inarray[0][start];
+        const NekDouble *v = &inarray[1][start];
+        const NekDouble *w = &inarray[2][start];
+        const NekDouble *y = isCF3 ? &inarray[3][start] : 0;
+        NekDouble *u_new   = &outarray[0][start];
+        NekDouble *v_new   = &outarray[1][start];
+        NekDouble *w_new   = &outarray[2][start];
         //NekDouble *y_new   = isCF3 ? &outarray[3][0] : 0;
-        NekDouble *v_tau   = &m_gates_tau[0][0];
-        NekDouble *w_tau   = &m_gates_tau[1][0];
+        NekDouble *v_tau   = &m_gates_tau[0][start];
+        NekDouble *w_tau   = &m_gates_tau[1][start];
         //NekDouble *y_tau   = isCF3 ? &m_gates_tau[2][0] : 0;
 
         // Temporary variables
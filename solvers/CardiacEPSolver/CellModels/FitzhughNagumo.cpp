@@ -61,34 +61,39 @@ namespace Nektar
         m_uuu  = Array<OneD, NekDouble>(m_nq, 0.0);
 
         m_nvar = 2;
+        m_blockUpdate = true;
         m_concentrations.push_back(1);
     }
 
 
-    void CellModelFitzHughNagumo::v_Update(
+    void CellModelFitzHughNagumo::v_UpdatePoints(
                     const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                           Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                    const NekDouble time)
+                    const NekDouble time,
+                    const int start,
+                    const int end)
     {
+        int n = end - start;
+
         NekDouble m_gamma = 0.5;
 
         // compute u^2: m_u = u*u
-        Vmath::Vmul(m_nq, &inarray[0][0], 1, &inarray[0][0], 1, &m_uuu[0], 1);
+        Vmath::Vmul(n, &inarray[0][start], 1, &inarray[0][start], 1, &m_uuu[start], 1);
 
         // compute u^3: m_u = u*u*u
-        Vmath::Vmul(m_nq, &inarray[0][0], 1, &m_uuu[0], 1, &m_uuu[0], 1);
+        Vmath::Vmul(n, &inarray[0][start], 1, &m_uuu[start], 1, &m_uuu[start], 1);
 
         // For u: (1/m_epsilon)*( u*-u*u*u/3 - v )
         // physfield = u - (1.0/3.0)*u*u*u
-        Vmath::Svtvp(m_nq, (-1.0/3.0), &m_uuu[0], 1, &inarray[0][0], 1, &outarray[0][0], 1);
+        Vmath::Svtvp(n, (-1.0/3.0), &m_uuu[start], 1, &inarray[0][start], 1, &outarray[0][start], 1);
 
-        Vmath::Vsub(m_nq, &inarray[1][0], 1, &outarray[0][0], 1, &outarray[0][0], 1);
-        Vmath::Smul(m_nq, -1.0/m_epsilon, &outarray[0][0], 1, &outarray[0][0], 1);
+        Vmath::Vsub(n, &inarray[1][start], 1, &outarray[0][start], 1, &outarray[0][start], 1);
+        Vmath::Smul(n, -1.0/m_epsilon, &outarray[0][start], 1, &outarray[0][start], 1);
 
         // For v: m_epsilon*( u + m_beta - m_gamma*v )
-        Vmath::Svtvp(m_nq, -1.0*m_gamma, &inarray[1][0], 1, &inarray[0][0], 1, &outarray[1][0], 1);
-        Vmath::Sadd(m_nq, m_beta, &outarray[1][0], 1, &outarray[1][0], 1);
-        Vmath::Smul(m_nq, m_epsilon, &outarray[1][0], 1, &outarray[1][0], 1);
+        Vmath::Svtvp(n, -1.0*m_gamma, &inarray[1][start], 1, &inarray[0][start], 1, &outarray[1][start], 1);
+        Vmath::Sadd(n, m_beta, &outarray[1][start], 1, &outarray[1][start], 1);
+        Vmath::Smul(n, m_epsilon, &outarray[1][start], 1, &outarray[1][start], 1);
     }
 
     /**
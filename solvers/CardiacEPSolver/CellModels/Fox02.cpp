@@ -35,6 +35,9 @@
 
 #include <iostream>
 #include <string>
+
+#include <boost/bind.hpp>
+
 //#include <LibUtilities/BasicUtils/Vmath.hpp>
 #include <CardiacEPSolver/CellModels/Fox02.h>
 
@@ -59,6 +62,10 @@ namespace Nektar
         pSession->LoadParameter("sigmai",    m_sigmai);
 
         m_nvar = 13;
+        m_blockUpdate = true;
+
+        SetVoltageFunction(19, boost::bind(&Fox02::GateKinetics,
+                                            this, _1, _2));
 
         m_gates.push_back(1);
         m_gates.push_back(2);
@@ -78,12 +85,74 @@ namespace Nektar
     
     
     
-    void Fox02::v_Update(
+    /**
+     * Computes the rates of the gates whose kinetics depend on the membrane
+     * potential @p V only.
+     */
+    void Fox02::GateKinetics(const NekDouble V, NekDouble *k) const
+    {
+        const NekDouble var_fast_sodium_current_m_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_m_gate__E0_m = var_fast_sodium_current_m_gate__V + 47.13; // millivolt
+        const NekDouble var_fast_sodium_current_m_gate__alpha_m = (0.32 * var_fast_sodium_current_m_gate__E0_m) / (1.0 - exp((-0.1) * var_fast_sodium_current_m_gate__E0_m)); // per_millisecond
+        const NekDouble var_fast_sodium_current_m_gate__beta_m = 0.08 * exp((-var_fast_sodium_current_m_gate__V) / 11.0); // per_millisecond
+        const NekDouble var_fast_sodium_current_h_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_h_gate__beta_h = 7.5 / (1.0 + exp((-0.1) * (var_fast_sodium_current_h_gate__V + 11.0))); // per_millisecond
+        const NekDouble var_fast_sodium_current_h_gate__alpha_h = 0.135 * exp((var_fast_sodium_current_h_gate__V + 80.0) / (-6.8)); // per_millisecond
+        const NekDouble var_fast_sodium_current_j_gate__V = V; // millivolt
+        const NekDouble var_fast_sodium_current_j_gate__alpha_j = (0.175 * exp((var_fast_sodium_current_j_gate__V + 100.0) / (-23.0))) / (1.0 + exp(0.15 * (var_fast_sodium_current_j_gate__V + 79.0))); // per_millisecond
+        const NekDouble var_fast_sodium_current_j_gate__beta_j = 0.3 / (1.0 + exp((-0.1) * (var_fast_sodium_current_j_gate__V + 32.0))); // per_millisecond
+        const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V = V; // millivolt
+        const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__tau_X_kr = 43.0 + (1.0 / (exp((-5.495) + (0.1691 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V)) + exp((-7.677) - (0.0128 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V)))); // millisecond
+        const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr_inf = 1.0 / (1.0 + exp((-2.182) - (0.1819 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V))); // dimensionless
+        const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V = V; // millivolt
+        const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__tau_X_ks = 1.0 / (((7.19e-05 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) / (1.0 - exp((-0.148) * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)))) + ((0.000131 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) / (exp(0.0687 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) - 1.0))); // millisecond
+        const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks_infinity = 1.0 / (1.0 + exp((var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 16.0) / (-13.6))); // dimensionless
+        const NekDouble var_transient_outward_potassium_current_X_to_gate__V = V; // millivolt
+        const NekDouble var_transient_outward_potassium_current_X_to_gate__alpha_X_to = 0.04516 * exp(0.03577 * var_transient_outward_potassium_current_X_to_gate__V); // per_millisecond
+        const NekDouble var_transient_outward_potassium_current_X_to_gate__beta_X_to = 0.0989 * exp((-0.06237) * var_transient_outward_potassium_current_X_to_gate__V); // per_millisecond
+        const NekDouble var_transient_outward_potassium_current_Y_to_gate__V = V; // millivolt
+        const NekDouble var_transient_outward_potassium_current_Y_to_gate__beta_Y_to = (0.005415 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / 5.0)) / (1.0 + (0.051335 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / 5.0))); // per_millisecond
+        const NekDouble var_transient_outward_potassium_current_Y_to_gate__alpha_Y_to = (0.005415 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / (-5.0))) / (1.0 + (0.051335 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / (-5.0)))); // per_millisecond
+        const NekDouble var_L_type_Ca_current_f_gate__V = V; // millivolt
+        const NekDouble var_L_type_Ca_current_f_gate__tau_f = 30.0 + (200.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 20.0) / 9.5))); // millisecond
+        const NekDouble var_L_type_Ca_current_f_gate__f_infinity = 1.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 12.5) / 5.0)); // dimensionless
+        const NekDouble var_L_type_Ca_current_d_gate__V = V; // millivolt
+        const NekDouble var_L_type_Ca_current_d_gate__E0_m = var_L_type_Ca_current_d_gate__V + 40.0; // millivolt
+        const NekDouble var_L_type_Ca_current_d_gate__tau_d = 1.0 / (((0.25 * exp((-0.01) * var_L_type_Ca_current_d_gate__V)) / (1.0 + exp((-0.07) * var_L_type_Ca_current_d_gate__V))) + ((0.07 * exp((-0.05) * var_L_type_Ca_current_d_gate__E0_m)) / (1.0 + exp(0.05 * var_L_type_Ca_current_d_gate__E0_m)))); // millisecond
+        const NekDouble var_L_type_Ca_current_d_gate__d_infinity = 1.0 / (1.0 + exp((var_L_type_Ca_current_d_gate__V + 10.0) / (-6.24))); // dimensionless
+        const NekDouble var_plateau_potassium_current_Kp_gate__V = V; // millivolt
+        const NekDouble var_plateau_potassium_current_Kp_gate__Kp_V = 1.0 / (1.0 + exp((7.488 - var_plateau_potassium_current_Kp_gate__V) / 5.98)); // dimensionless
+        const NekDouble var_plateau_potassium_current__Kp_V = var_plateau_potassium_current_Kp_gate__Kp_V; // dimensionless
+        k[0] = var_fast_sodium_current_m_gate__alpha_m;
+        k[1] = var_fast_sodium_current_m_gate__beta_m;
+        k[2] = var_fast_sodium_current_h_gate__beta_h;
+        k[3] = var_fast_sodium_current_h_gate__alpha_h;
+        k[4] = var_fast_sodium_current_j_gate__alpha_j;
+        k[5] = var_fast_sodium_current_j_gate__beta_j;
+        k[6] = var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__tau_X_kr;
+        k[7] = var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr_inf;
+        k[8] = var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__tau_X_ks;
+        k[9] = var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks_infinity;
+        k[10] = var_transient_outward_potassium_current_X_to_gate__alpha_X_to;
+        k[11] = var_transient_outward_potassium_current_X_to_gate__beta_X_to;
+        k[12] = var_transient_outward_potassium_current_Y_to_gate__beta_Y_to;
+        k[13] = var_transient_outward_potassium_current_Y_to_gate__alpha_Y_to;
+        k[14] = var_L_type_Ca_current_f_gate__tau_f;
+        k[15] = var_L_type_Ca_current_f_gate__f_infinity;
+        k[16] = var_L_type_Ca_current_d_gate__tau_d;
+        k[17] = var_L_type_Ca_current_d_gate__d_infinity;
+        k[18] = var_plateau_potassium_current__Kp_V;
+    }
+
+
+    void Fox02::v_UpdatePoints(
                      const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                            Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                     const NekDouble time)
+                     const NekDouble time,
+                     const int start,
+                     const int end)
     {
-        for (unsigned int i = 0; i < m_nq; ++i)
+        for (unsigned int i = start; i < end; ++i)
         {
             
             // Inputs:
@@ -176,59 +245,55 @@ namespace Nektar
             const NekDouble var_calcium_background_current__V = var_chaste_interface__membrane__V; // millivolt
             const NekDouble var_calcium_background_current__i_Ca_b = var_calcium_background_current__g_Cab * (var_calcium_background_current__V - var_calcium_background_current__E_Ca); // microA_per_microF
             const NekDouble var_fast_sodium_current_m_gate__m = var_fast_sodium_current__m; // dimensionless
-            const NekDouble var_fast_sodium_current_m_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_m_gate__E0_m = var_fast_sodium_current_m_gate__V + 47.13; // millivolt
-            const NekDouble var_fast_sodium_current_m_gate__alpha_m = (0.32 * var_fast_sodium_current_m_gate__E0_m) / (1.0 - exp((-0.1) * var_fast_sodium_current_m_gate__E0_m)); // per_millisecond
-            const NekDouble var_fast_sodium_current_m_gate__beta_m = 0.08 * exp((-var_fast_sodium_current_m_gate__V) / 11.0); // per_millisecond
+            // Gate kinetics, which depend on the membrane potential only
+            NekDouble kinetics[19];
+            if (!LookupVoltageFunction(var_chaste_interface__membrane__V, kinetics))
+            {
+                GateKinetics(var_chaste_interface__membrane__V, kinetics);
+            }
+            const NekDouble var_fast_sodium_current_m_gate__alpha_m = kinetics[0];
+            const NekDouble var_fast_sodium_current_m_gate__beta_m = kinetics[1];
+            const NekDouble var_fast_sodium_current_h_gate__beta_h = kinetics[2];
+            const NekDouble var_fast_sodium_current_h_gate__alpha_h = kinetics[3];
+            const NekDouble var_fast_sodium_current_j_gate__alpha_j = kinetics[4];
+            const NekDouble var_fast_sodium_current_j_gate__beta_j = kinetics[5];
+            const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__tau_X_kr = kinetics[6];
+            const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr_inf = kinetics[7];
+            const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__tau_X_ks = kinetics[8];
+            const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks_infinity = kinetics[9];
+            const NekDouble var_transient_outward_potassium_current_X_to_gate__alpha_X_to = kinetics[10];
+            const NekDouble var_transient_outward_potassium_current_X_to_gate__beta_X_to = kinetics[11];
+            const NekDouble var_transient_outward_potassium_current_Y_to_gate__beta_Y_to = kinetics[12];
+            const NekDouble var_transient_outward_potassium_current_Y_to_gate__alpha_Y_to = kinetics[13];
+            const NekDouble var_L_type_Ca_current_f_gate__tau_f = kinetics[14];
+            const NekDouble var_L_type_Ca_current_f_gate__f_infinity = kinetics[15];
+            const NekDouble var_L_type_Ca_current_d_gate__tau_d = kinetics[16];
+            const NekDouble var_L_type_Ca_current_d_gate__d_infinity = kinetics[17];
+            const NekDouble var_plateau_potassium_current__Kp_V = kinetics[18];
             const NekDouble var_fast_sodium_current_m_gate__d_m_d_environment__time = (var_fast_sodium_current_m_gate__alpha_m * (1.0 - var_fast_sodium_current_m_gate__m)) - (var_fast_sodium_current_m_gate__beta_m * var_fast_sodium_current_m_gate__m); // per_millisecond
             const NekDouble var_fast_sodium_current__fast_sodium_current_m_gate__d_m_d_environment__time = var_fast_sodium_current_m_gate__d_m_d_environment__time; // per_millisecond
-            const NekDouble var_fast_sodium_current_h_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_h_gate__beta_h = 7.5 / (1.0 + exp((-0.1) * (var_fast_sodium_current_h_gate__V + 11.0))); // per_millisecond
-            const NekDouble var_fast_sodium_current_h_gate__alpha_h = 0.135 * exp((var_fast_sodium_current_h_gate__V + 80.0) / (-6.8)); // per_millisecond
             const NekDouble var_fast_sodium_current_h_gate__h = var_fast_sodium_current__h; // dimensionless
             const NekDouble var_fast_sodium_current_h_gate__d_h_d_environment__time = (var_fast_sodium_current_h_gate__alpha_h * (1.0 - var_fast_sodium_current_h_gate__h)) - (var_fast_sodium_current_h_gate__beta_h * var_fast_sodium_current_h_gate__h); // per_millisecond
             const NekDouble var_fast_sodium_current__fast_sodium_current_h_gate__d_h_d_environment__time = var_fast_sodium_current_h_gate__d_h_d_environment__time; // per_millisecond
-            const NekDouble var_fast_sodium_current_j_gate__V = var_fast_sodium_current__V; // millivolt
-            const NekDouble var_fast_sodium_current_j_gate__alpha_j = (0.175 * exp((var_fast_sodium_current_j_gate__V + 100.0) / (-23.0))) / (1.0 + exp(0.15 * (var_fast_sodium_current_j_gate__V + 79.0))); // per_millisecond
-            const NekDouble var_fast_sodium_current_j_gate__beta_j = 0.3 / (1.0 + exp((-0.1) * (var_fast_sodium_current_j_gate__V + 32.0))); // per_millisecond
             const NekDouble var_fast_sodium_current_j_gate__j = var_fast_sodium_current__j; // dimensionless
             const NekDouble var_fast_sodium_current_j_gate__d_j_d_environment__time = (var_fast_sodium_current_j_gate__alpha_j * (1.0 - var_fast_sodium_current_j_gate__j)) - (var_fast_sodium_current_j_gate__beta_j * var_fast_sodium_current_j_gate__j); // per_millisecond
             const NekDouble var_fast_sodium_current__fast_sodium_current_j_gate__d_j_d_environment__time = var_fast_sodium_current_j_gate__d_j_d_environment__time; // per_millisecond
-            const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V = var_rapid_activating_delayed_rectifiyer_K_current__V; // millivolt
-            const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__tau_X_kr = 43.0 + (1.0 / (exp((-5.495) + (0.1691 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V)) + exp((-7.677) - (0.0128 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V)))); // millisecond
             const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr = var_rapid_activating_delayed_rectifiyer_K_current__X_kr; // dimensionless
-            const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr_inf = 1.0 / (1.0 + exp((-2.182) - (0.1819 * var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__V))); // dimensionless
             const NekDouble var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__d_X_kr_d_environment__time = (var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr_inf - var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__X_kr) / var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__tau_X_kr; // per_millisecond
             const NekDouble var_rapid_activating_delayed_rectifiyer_K_current__rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__d_X_kr_d_environment__time = var_rapid_activating_delayed_rectifiyer_K_current_X_kr_gate__d_X_kr_d_environment__time; // per_millisecond
-            const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V = var_slow_activating_delayed_rectifiyer_K_current__V; // millivolt
-            const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__tau_X_ks = 1.0 / (((7.19e-05 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) / (1.0 - exp((-0.148) * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)))) + ((0.000131 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) / (exp(0.0687 * (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 10.0)) - 1.0))); // millisecond
-            const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks_infinity = 1.0 / (1.0 + exp((var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__V - 16.0) / (-13.6))); // dimensionless
             const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks = var_slow_activating_delayed_rectifiyer_K_current__X_ks; // dimensionless
             const NekDouble var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__d_X_ks_d_environment__time = (var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks_infinity - var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__X_ks) / var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__tau_X_ks; // per_millisecond
             const NekDouble var_slow_activating_delayed_rectifiyer_K_current__slow_activating_delayed_rectifiyer_K_current_X_ks_gate__d_X_ks_d_environment__time = var_slow_activating_delayed_rectifiyer_K_current_X_ks_gate__d_X_ks_d_environment__time; // per_millisecond
-            const NekDouble var_transient_outward_potassium_current_X_to_gate__V = var_transient_outward_potassium_current__V; // millivolt
-            const NekDouble var_transient_outward_potassium_current_X_to_gate__alpha_X_to = 0.04516 * exp(0.03577 * var_transient_outward_potassium_current_X_to_gate__V); // per_millisecond
             const NekDouble var_transient_outward_potassium_current_X_to_gate__X_to = var_transient_outward_potassium_current__X_to; // dimensionless
-            const NekDouble var_transient_outward_potassium_current_X_to_gate__beta_X_to = 0.0989 * exp((-0.06237) * var_transient_outward_potassium_current_X_to_gate__V); // per_millisecond
             const NekDouble var_transient_outward_potassium_current_X_to_gate__d_X_to_d_environment__time = (var_transient_outward_potassium_current_X_to_gate__alpha_X_to * (1.0 - var_transient_outward_potassium_current_X_to_gate__X_to)) - (var_transient_outward_potassium_current_X_to_gate__beta_X_to * var_transient_outward_potassium_current_X_to_gate__X_to); // per_millisecond
             const NekDouble var_transient_outward_potassium_current__transient_outward_potassium_current_X_to_gate__d_X_to_d_environment__time = var_transient_outward_potassium_current_X_to_gate__d_X_to_d_environment__time; // per_millisecond
-            const NekDouble var_transient_outward_potassium_current_Y_to_gate__V = var_transient_outward_potassium_current__V; // millivolt
-            const NekDouble var_transient_outward_potassium_current_Y_to_gate__beta_Y_to = (0.005415 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / 5.0)) / (1.0 + (0.051335 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / 5.0))); // per_millisecond
-            const NekDouble var_transient_outward_potassium_current_Y_to_gate__alpha_Y_to = (0.005415 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / (-5.0))) / (1.0 + (0.051335 * exp((var_transient_outward_potassium_current_Y_to_gate__V + 33.5) / (-5.0)))); // per_millisecond
             const NekDouble var_transient_outward_potassium_current_Y_to_gate__Y_to = var_transient_outward_potassium_current__Y_to; // dimensionless
             const NekDouble var_transient_outward_potassium_current_Y_to_gate__d_Y_to_d_environment__time = (var_transient_outward_potassium_current_Y_to_gate__alpha_Y_to * (1.0 - var_transient_outward_potassium_current_Y_to_gate__Y_to)) - (var_transient_outward_potassium_current_Y_to_gate__beta_Y_to * var_transient_outward_potassium_current_Y_to_gate__Y_to); // per_millisecond
             const NekDouble var_transient_outward_potassium_current__transient_outward_potassium_current_Y_to_gate__d_Y_to_d_environment__time = var_transient_outward_potassium_current_Y_to_gate__d_Y_to_d_environment__time; // per_millisecond
-            const NekDouble var_L_type_Ca_current_f_gate__V = var_L_type_Ca_current__V; // millivolt
-            const NekDouble var_L_type_Ca_current_f_gate__tau_f = 30.0 + (200.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 20.0) / 9.5))); // millisecond
             const NekDouble var_L_type_Ca_current_f_gate__f = var_L_type_Ca_current__f; // dimensionless
-            const NekDouble var_L_type_Ca_current_f_gate__f_infinity = 1.0 / (1.0 + exp((var_L_type_Ca_current_f_gate__V + 12.5) / 5.0)); // dimensionless
             const NekDouble var_L_type_Ca_current_f_gate__d_f_d_environment__time = (var_L_type_Ca_current_f_gate__f_infinity - var_L_type_Ca_current_f_gate__f) / var_L_type_Ca_current_f_gate__tau_f; // per_millisecond
             const NekDouble var_L_type_Ca_current__L_type_Ca_current_f_gate__d_f_d_environment__time = var_L_type_Ca_current_f_gate__d_f_d_environment__time; // per_millisecond
-            const NekDouble var_L_type_Ca_current_d_gate__V = var_L_type_Ca_current__V; // millivolt
-            const NekDouble var_L_type_Ca_current_d_gate__E0_m = var_L_type_Ca_current_d_gate__V + 40.0; // millivolt
-            const NekDouble var_L_type_Ca_current_d_gate__tau_d = 1.0 / (((0.25 * exp((-0.01) * var_L_type_Ca_current_d_gate__V)) / (1.0 + exp((-0.07) * var_L_type_Ca_current_d_gate__V))) + ((0.07 * exp((-0.05) * var_L_type_Ca_current_d_gate__E0_m)) / (1.0 + exp(0.05 * var_L_type_Ca_current_d_gate__E0_m)))); // millisecond
             const NekDouble var_L_type_Ca_current_d_gate__d = var_L_type_Ca_current__d; // dimensionless
-            const NekDouble var_L_type_Ca_current_d_gate__d_infinity = 1.0 / (1.0 + exp((var_L_type_Ca_current_d_gate__V + 10.0) / (-6.24))); // dimensionless
             const NekDouble var_L_type_Ca_current_d_gate__d_d_d_environment__time = (var_L_type_Ca_current_d_gate__d_infinity - var_L_type_Ca_current_d_gate__d) / var_L_type_Ca_current_d_gate__tau_d; // per_millisecond
             const NekDouble var_L_type_Ca_current__L_type_Ca_current_d_gate__d_d_d_environment__time = var_L_type_Ca_current_d_gate__d_d_d_environment__time; // per_millisecond
             const NekDouble var_L_type_Ca_current_f_Ca_gate__f_Ca = var_L_type_Ca_current__f_Ca; // dimensionless
@@ -356,9 +421,6 @@ namespace Nektar
             const NekDouble var_membrane__i_K1 = var_time_independent_potassium_current__i_K1; // microA_per_microF
             const NekDouble var_plateau_potassium_current__g_Kp = 0.002216; // milliS_per_microF
             const NekDouble var_plateau_potassium_current__V = var_chaste_interface__membrane__V; // millivolt
-            const NekDouble var_plateau_potassium_current_Kp_gate__V = var_plateau_potassium_current__V; // millivolt
-            const NekDouble var_plateau_potassium_current_Kp_gate__Kp_V = 1.0 / (1.0 + exp((7.488 - var_plateau_potassium_current_Kp_gate__V) / 5.98)); // dimensionless
-            const NekDouble var_plateau_potassium_current__Kp_V = var_plateau_potassium_current_Kp_gate__Kp_V; // dimensionless
             const NekDouble var_plateau_potassium_current__E_K = var_rapid_activating_delayed_rectifiyer_K_current__E_K; // millivolt
             const NekDouble var_plateau_potassium_current__i_Kp = var_plateau_potassium_current__g_Kp * var_plateau_potassium_current__Kp_V * (var_plateau_potassium_current__V - var_plateau_potassium_current__E_K); // microA_per_microF
             const NekDouble var_membrane__i_Kp = var_plateau_potassium_current__i_Kp; // microA_per_microF
@@ -35,6 +35,7 @@ namespace Nektar
         m_nq   = pField->GetNpoints();
 
         m_nvar = 8;
+        m_blockUpdate = true;
         m_gates.push_back(1);
         m_gates.push_back(2);
         m_gates.push_back(3);
@@ -48,12 +49,14 @@ namespace Nektar
     
     
     
-    void LuoRudy91::v_Update(
+    void LuoRudy91::v_UpdatePoints(
                      const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                            Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                                                           const NekDouble time)
+                                                           const NekDouble time,
+                                                           const int start,
+                                                           const int end)
     {
-        for (unsigned int i = 0; i < m_nq; ++i)
+        for (unsigned int i = start; i < end; ++i)
         {
             // Inputs:
             // Time units: millisecond
@@ -63,10 +63,12 @@ namespace Nektar
 
     protected:
         /// Computes the reaction terms $f(u,v)$ and $g(u,v)$.
-        virtual void v_Update(
+        virtual void v_UpdatePoints(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                const NekDouble time);
+                const NekDouble time,
+                const int start,
+                const int end);
 
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
@@ -54,17 +54,18 @@ namespace Nektar
                 const int nq): CellModel(pSession, nq)
     {
         m_nq   = nq;
+        m_blockUpdate = true;
     }
     
     
-    void PanditGilesDemir03::v_Update(
+    void PanditGilesDemir03::v_UpdatePoints(
                      const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                            Array<OneD,        Array<OneD, NekDouble> >&outarray,
-                     const NekDouble time)
+                     const NekDouble time,
+                     const int start,
+                     const int end)
     {
-        int nvariables  = inarray.num_elements();
-        int nq = m_nq;
-        for (unsigned int i = 0; i < nq; ++i)
+        for (unsigned int i = start; i < end; ++i)
         {
             // Inputs:
             // Time units: millisecond
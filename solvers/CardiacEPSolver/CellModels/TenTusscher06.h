@@ -62,16 +62,20 @@ namespace Nektar
         virtual ~TenTusscher06() {}
 
     protected:
-        virtual void v_Update(
+        virtual void v_UpdatePoints(
                const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                      Array<OneD,        Array<OneD, NekDouble> >&outarray,
-               const NekDouble time);
+               const NekDouble time,
+               const int start,
+               const int end);
 
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
 
         virtual void v_SetInitialConditions();
 
+        void GateKinetics(const NekDouble V, NekDouble *k) const;
+
         NekDouble g_to;
         NekDouble g_Ks;
         NekDouble s_inf_factor;
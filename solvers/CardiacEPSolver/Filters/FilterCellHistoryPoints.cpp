@@ -34,7 +34,6 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
-#include <iomanip>
 #include <CardiacEPSolver/Filters/FilterCellHistoryPoints.h>
 
 using namespace std;
@@ -79,84 +78,22 @@ void FilterCellHistoryPoints::v_Update(
         return;
     }
 
-    int j         = 0;
-    int k         = 0;
-    int numPoints = m_historyPoints.size();
     int numFields = m_cell->GetNumCellVariables();
-    LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
-    Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
-    Array<OneD, NekDouble> gloCoord(3, 0.0);
-    std::list<std::pair<SpatialDomains::PointGeomSharedPtr,
-                        Array<OneD, NekDouble> > >::iterator x;
+    int nPlan     = m_planPoints.num_elements();
+    Array<OneD, NekDouble> values(nPlan * numFields);
+    Array<OneD, NekDouble> fieldValues(nPlan);
 
-    Array<OneD, NekDouble> physvals;
-    Array<OneD, NekDouble> locCoord;
-    int expId;
-    int nppp = 0; // Number of points per plane
-
-    // Pull out data values field by field
-    for (j = 0; j < numFields; ++j)
+    // Pull out data values field by field, from the plane of each point
+    // for homogeneous expansions.
+    for (int j = 0; j < numFields; ++j)
     {
-        if(m_isHomogeneous1D)
-        {
-            for (k = 0, x = m_historyList.begin(); x != m_historyList.end();
-                 ++x, ++k)
-            {
-                locCoord = (*x).second;
-                expId    = (*x).first->GetVid();
-                nppp     = pFields[0]->GetPlane(0)->GetTotPoints();
-
-                physvals = m_cell->GetCellSolution(j) + m_outputPlane*nppp
-                            + pFields[j]->GetPhys_Offset(expId);
-
-                // interpolate point can do with zero plane methods
-                data[m_historyLocalPointMap[k]*numFields+j]
-                    = pFields[0]->GetExp(expId)->StdPhysEvaluate(
-                                                    locCoord,physvals);
-
-            }
-        }
-        else
-        {
-            for (k = 0, x = m_historyList.begin();
-                 x != m_historyList.end();
-                 ++x, ++k)
-            {
-                locCoord = (*x).second;
-                expId    = (*x).first->GetVid();
-
-                physvals = m_cell->GetCellSolution(j)
-                            + pFields[0]->GetPhys_Offset(expId);
-
-                // interpolate point
-                data[m_historyLocalPointMap[k]*numFields+j]
-                    = pFields[0]->GetExp(expId)->StdPhysEvaluate(
-                                                    locCoord,physvals);
-            }
-        }
+        EvaluatePlan(pFields[0], m_cell->GetCellSolution(j), false,
+                     fieldValues);
+        Vmath::Vcopy(nPlan, fieldValues.get(), 1, values.get() + j,
+                     numFields);
     }
 
-    // Exchange history data
-    // This could be improved to reduce communication but works for now
-    vComm->AllReduce(data, LibUtilities::ReduceSum);
-
-    // Only the root process writes out history data
-    if (vComm->GetRank() == 0)
-    {
-
-        // Write data values point by point
-        for (k = 0; k < m_historyPoints.size(); ++k)
-        {
-            m_outputStream.width(8);
-            m_outputStream << setprecision(6) << time;
-            for (int j = 0; j < numFields; ++j)
-            {
-                m_outputStream.width(25);
-                m_outputStream << setprecision(16) << data[k*numFields+j];
-            }
-            m_outputStream << endl;
-        }
-    }
+    OutputData(pFields[0]->GetComm(), time, numFields, values);
 }
 
 }
@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File CellModelCompare.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compare a cell model, integrated with the blocking, lookup
+// table and adaptive substepping settings of the session, against the same
+// model integrated in a single block without these optimisations.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <SpatialDomains/MeshGraph.h>
+#include <MultiRegions/ExpList1D.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <StdRegions/StdNodalTriExp.h>
+#include <StdRegions/StdNodalTetExp.h>
+#include <CardiacEPSolver/CellModels/CellModel.h>
+
+using namespace std;
+using namespace Nektar;
+
+/**
+ * @brief Integrates @p cell for @p nSteps timesteps of @p delta_t with
+ * forward Euler, starting from the membrane potential @p sol, and returns
+ * the time taken.
+ */
+NekDouble IntegrateCellModel(
+    CellModelSharedPtr                    &cell,
+    Array<OneD, Array<OneD, NekDouble> > &sol,
+    const NekDouble                       delta_t,
+    const int                             nSteps)
+{
+    int nq = sol[0].num_elements();
+    Array<OneD, Array<OneD, NekDouble> > wsp(1);
+    wsp[0] = Array<OneD, NekDouble>(nq, 0.0);
+
+    Timer     timer;
+    NekDouble time = 0.0;
+
+    timer.Start();
+    for (int i = 0; i < nSteps; ++i)
+    {
+        cell->TimeIntegrate(sol, wsp, time);
+        Vmath::Svtvp(nq, delta_t, wsp[0], 1, sol[0], 1, sol[0], 1);
+        time += delta_t;
+    }
+    timer.Stop();
+
+    return timer.TimePerTest(1);
+}
+
+/**
+ * @brief Returns the largest difference, relative to the magnitude of
+ * @p sol, between the membrane potential of a cell model using nodal
+ * projection after a single step from @p sol and the projection of @p sol
+ * onto the nodal points of each element in turn.
+ *
+ * With a single substep the membrane potential is not integrated, so the
+ * model holds the nodal values of its input.
+ */
+NekDouble CompareNodalProjection(
+    const LibUtilities::SessionReaderSharedPtr &session,
+    const MultiRegions::ExpListSharedPtr       &field,
+    const string                               &cellModel,
+    const Array<OneD, const NekDouble>         &sol)
+{
+    NekDouble substeps = session->GetParameter("Substeps"), one = 1.0;
+    session->SetParameter("Substeps", one);
+    CellModelSharedPtr cell = GetCellModelFactory().CreateInstance(
+        cellModel, session, field);
+    cell->Initialise();
+    session->SetParameter("Substeps", substeps);
+
+    int nq = field->GetTotPoints();
+    Array<OneD, Array<OneD, NekDouble> > in(1), out(1);
+    in [0] = Array<OneD, NekDouble>(nq);
+    out[0] = Array<OneD, NekDouble>(nq, 0.0);
+    Vmath::Vcopy(nq, sol, 1, in[0], 1);
+    cell->TimeIntegrate(in, out, 0.0);
+
+    Array<OneD, NekDouble> nodal = cell->GetCellSolution(0);
+
+    // Project each element onto the nodal points used by the cell model.
+    int order = field->GetExp(0)->GetBasis(0)->GetNumModes();
+    LibUtilities::BasisKey B0(
+        LibUtilities::eModified_A, order,
+        LibUtilities::PointsKey(order, LibUtilities::eGaussLobattoLegendre));
+    LibUtilities::BasisKey B1(
+        LibUtilities::eModified_B, order,
+        LibUtilities::PointsKey(order, LibUtilities::eGaussRadauMAlpha1Beta0));
+    LibUtilities::BasisKey B2(
+        LibUtilities::eModified_C, order,
+        LibUtilities::PointsKey(order, LibUtilities::eGaussRadauMAlpha2Beta0));
+
+    StdRegions::StdNodalTriExpSharedPtr nodalTri =
+        MemoryManager<StdRegions::StdNodalTriExp>::AllocateSharedPtr(
+            B0, B1, LibUtilities::eNodalTriEvenlySpaced);
+    StdRegions::StdNodalTetExpSharedPtr nodalTet =
+        MemoryManager<StdRegions::StdNodalTetExp>::AllocateSharedPtr(
+            B0, B1, B2, LibUtilities::eNodalTetEvenlySpaced);
+
+    Array<OneD, NekDouble> coeffs(field->GetExp(0)->GetNcoeffs()), tmp;
+    Array<OneD, NekDouble> ref(field->GetNcoeffs());
+    for (int i = 0; i < field->GetNumElmts(); ++i)
+    {
+        int phys_offset = field->GetPhys_Offset(i);
+        int coef_offset = field->GetCoeff_Offset(i);
+
+        field->GetExp(i)->FwdTrans(sol + phys_offset, coeffs);
+        if (field->GetExp(i)->DetShapeType() == LibUtilities::eTriangle)
+        {
+            nodalTri->ModalToNodal(coeffs, tmp = ref + coef_offset);
+        }
+        else
+        {
+            nodalTet->ModalToNodal(coeffs, tmp = ref + coef_offset);
+        }
+    }
+
+    NekDouble diff = 0.0, scale = 0.0;
+    for (int j = 0; j < ref.num_elements(); ++j)
+    {
+        diff  = max(diff,  fabs(ref[j] - nodal[j]));
+        scale = max(scale, fabs(ref[j]));
+    }
+
+    return diff / max(scale, 1e-12);
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr session =
+        LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+    MultiRegions::ExpListSharedPtr field;
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            field = MemoryManager<MultiRegions::ExpList1D>
+                ::AllocateSharedPtr(session, graph);
+            break;
+        case 2:
+            field = MemoryManager<MultiRegions::ExpList2D>
+                ::AllocateSharedPtr(session, graph);
+            break;
+        case 3:
+            field = MemoryManager<MultiRegions::ExpList3D>
+                ::AllocateSharedPtr(session, graph);
+            break;
+        default:
+            ASSERTL0(false, "Unsupported mesh dimension.");
+    }
+
+    string cellModel;
+    session->LoadSolverInfo("CELLMODEL", cellModel, "");
+    ASSERTL0(cellModel != "", "Cell Model not specified.");
+
+    int       nq      = field->GetTotPoints();
+    NekDouble delta_t = session->GetParameter("TimeStep");
+    int       nSteps  = session->GetParameter("NumSteps");
+
+    // The reference model integrates all points in a single block, without
+    // a lookup table, and substeps every point.
+    int       blockSize, refBlockSize = nq;
+    NekDouble lookupStep, activeDVdt, activeGateChange, zero = 0.0;
+    session->LoadParameter("CellModelBlockSize", blockSize, 256);
+    session->LoadParameter("CellModelLookupStep", lookupStep, 0.0);
+    session->LoadParameter("CellModelActiveDVdt", activeDVdt, 0.0);
+    session->LoadParameter("CellModelActiveGateChange",
+                           activeGateChange, 0.0);
+
+    session->SetParameter("CellModelBlockSize", refBlockSize);
+    session->SetParameter("CellModelLookupStep", zero);
+    session->SetParameter("CellModelActiveDVdt", zero);
+    session->SetParameter("CellModelActiveGateChange", zero);
+
+    CellModelSharedPtr refCell = GetCellModelFactory().CreateInstance(
+        cellModel, session, field);
+    refCell->Initialise();
+
+    session->SetParameter("CellModelBlockSize", blockSize);
+    session->SetParameter("CellModelLookupStep", lookupStep);
+    session->SetParameter("CellModelActiveDVdt", activeDVdt);
+    session->SetParameter("CellModelActiveGateChange", activeGateChange);
+
+    CellModelSharedPtr cell = GetCellModelFactory().CreateInstance(
+        cellModel, session, field);
+    cell->Initialise();
+
+    // Both models start from the same membrane potential.
+    Array<OneD, NekDouble> x(nq), y(nq), z(nq);
+    field->GetCoords(x, y, z);
+
+    Array<OneD, Array<OneD, NekDouble> > refSol(1), sol(1);
+    refSol[0] = Array<OneD, NekDouble>(nq);
+    sol   [0] = Array<OneD, NekDouble>(nq);
+    session->GetFunction("InitialConditions", "u")->Evaluate(
+        x, y, z, 0.0, refSol[0]);
+    Vmath::Vcopy(nq, refSol[0], 1, sol[0], 1);
+
+    NekDouble refTime = IntegrateCellModel(refCell, refSol, delta_t, nSteps);
+    NekDouble time    = IntegrateCellModel(cell,    sol,    delta_t, nSteps);
+
+    // Differences are relative to the magnitude of each variable, which
+    // range from the membrane potential to ion concentrations.
+    NekDouble maxDiff = 0.0;
+    for (int i = 0; i < cell->GetNumCellVariables(); ++i)
+    {
+        Array<OneD, NekDouble> a = refCell->GetCellSolution(i);
+        Array<OneD, NekDouble> b = cell->GetCellSolution(i);
+
+        NekDouble diff = 0.0, scale = 0.0;
+        for (int j = 0; j < a.num_elements(); ++j)
+        {
+            diff  = max(diff,  fabs(a[j] - b[j]));
+            scale = max(scale, fabs(a[j]));
+        }
+        maxDiff = max(maxDiff, diff / max(scale, 1e-12));
+    }
+
+    cout << "Cell model     : " << cellModel << endl;
+    cout << "Points         : " << nq << endl;
+    cout << "Block size     : " << blockSize << endl;
+    cout << "Reference      : " << setw(12) << refTime << " s" << endl;
+    cout << "Session        : " << setw(12) << time << " s" << endl;
+    cout << "Max difference : " << setw(12) << maxDiff << endl;
+
+    if (session->MatchSolverInfo("CellModelProjection", "Nodal"))
+    {
+        cout << "Nodal difference : " << setw(12)
+             << CompareNodalProjection(session, field, cellModel, sol[0])
+             << endl;
+    }
+
+    session->Finalise();
+
+    return 0;
+}
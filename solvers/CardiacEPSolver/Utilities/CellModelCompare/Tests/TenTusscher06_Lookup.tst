@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>ten Tusscher 2006 cell model, lookup table against exact gate kinetics</description>
+    <executable>CellModelCompare</executable>
+    <parameters>-P CellModelLookupStep=0.01 TenTusscher06.xml</parameters>
+    <files>
+        <file description="Session File">TenTusscher06.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Max difference :\s*(\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-3">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
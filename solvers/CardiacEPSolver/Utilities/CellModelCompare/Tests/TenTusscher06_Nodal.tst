@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>ten Tusscher 2006 cell model on triangles with nodal projection, against the element by element projection</description>
+    <executable>CellModelCompare</executable>
+    <parameters>-I CellModelProjection=Nodal TenTusscher06_Tri.xml</parameters>
+    <files>
+        <file description="Session File">TenTusscher06_Tri.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Nodal difference :\s*(\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-12">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -270,17 +270,26 @@ namespace Nektar
         }
         else
         {
+            // The exchange of the trace between processes is completed by
+            // the advection operator once it has evaluated the volume terms.
             for(i = 0; i < nvariables; ++i)
             {
                 Fwd[i]     = Array<OneD, NekDouble>(nTracePts, 0.0);
                 Bwd[i]     = Array<OneD, NekDouble>(nTracePts, 0.0);
-                m_fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                m_fields[i]->BeginFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
             }
         }
 
         // Calculate advection
         DoAdvection(inarray, outarray, time, Fwd, Bwd);
 
+        // Ensure the trace exchange is complete for advection operators
+        // which do not use the given trace
+        for (i = 0; i < nvariables; ++i)
+        {
+            m_fields[i]->EndFwdBwdTracePhys();
+        }
+
         // Negate results
         for (i = 0; i < nvariables; ++i)
         {
@@ -48,6 +48,7 @@ namespace Nektar
     AverageSolver::AverageSolver() : CompressibleSolver()
     {
         m_pointSolve = false;
+        m_arrayOnly  = true;
     }
 
     /**
@@ -70,13 +71,14 @@ namespace Nektar
      * @param Ef        Computed Riemann flux for energy.
      */
     void AverageSolver::v_ArraySolve(
+        const int                                         nDim,
         const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
         static NekDouble gamma = m_params["gamma"]();
         
-        int expDim = Fwd.num_elements()-2;
+        int expDim = nDim;
         int i, j;
         
         for (j = 0; j < Fwd[0].num_elements(); ++j)
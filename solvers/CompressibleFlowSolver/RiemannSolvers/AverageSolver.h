@@ -55,6 +55,7 @@ namespace Nektar
         AverageSolver();
         
         virtual void v_ArraySolve(
+            const int                                         nDim,
             const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
             const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
                   Array<OneD,       Array<OneD, NekDouble> > &flux);
@@ -34,11 +34,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
 
 namespace Nektar
 {
     CompressibleSolver::CompressibleSolver() : RiemannSolver(),
-                                               m_pointSolve(true)
+                                               m_pointSolve(true),
+                                               m_forcePointSolve(false),
+                                               m_arrayOnly(false)
     {
         m_requiresRotation = true;
     }
@@ -49,10 +52,14 @@ namespace Nektar
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
-        if (m_pointSolve)
+        int nvariables  = Fwd.num_elements();
+
+        // The blocked array implementations do not support the additional
+        // variable of the PDE-based shock capturing.
+        if (!m_arrayOnly &&
+            (m_pointSolve || m_forcePointSolve || nvariables != nDim + 2))
         {
             int expDim      = nDim;
-            int nvariables  = Fwd.num_elements();
             
             NekDouble rhouf, rhovf;
             
@@ -115,7 +122,65 @@ namespace Nektar
         }
         else
         {
-            v_ArraySolve(Fwd, Bwd, flux);
+            v_ArraySolve(nDim, Fwd, Bwd, flux);
+        }
+    }
+
+    /**
+     * @brief Copy the trace states of points [offset, offset + n) into a
+     * block, setting momentum components beyond @p nDim to zero.
+     */
+    void CompressibleSolver::GatherBlock(
+        const int                                         nDim,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+        const int                                         offset,
+        const int                                         n,
+              RiemannBlock                               &block)
+    {
+        NekDouble *fwd[5] = { block.rhoL, block.rhouL, block.rhovL,
+                              block.rhowL, block.EL };
+        NekDouble *bwd[5] = { block.rhoR, block.rhouR, block.rhovR,
+                              block.rhowR, block.ER };
+
+        // Density and momentum components.
+        for (int j = 0; j < nDim + 1; ++j)
+        {
+            Vmath::Vcopy(n, &Fwd[j][offset], 1, fwd[j], 1);
+            Vmath::Vcopy(n, &Bwd[j][offset], 1, bwd[j], 1);
         }
+
+        // Missing momentum components.
+        for (int j = nDim + 1; j < 4; ++j)
+        {
+            Vmath::Zero(n, fwd[j], 1);
+            Vmath::Zero(n, bwd[j], 1);
+        }
+
+        // Energy.
+        Vmath::Vcopy(n, &Fwd[nDim+1][offset], 1, block.EL, 1);
+        Vmath::Vcopy(n, &Bwd[nDim+1][offset], 1, block.ER, 1);
+    }
+
+    /**
+     * @brief Copy the fluxes held in a block back to points [offset, offset +
+     * n) of the trace, discarding momentum components beyond @p nDim.
+     */
+    void CompressibleSolver::ScatterBlock(
+        const int                                         nDim,
+        const RiemannBlock                               &block,
+        const int                                         offset,
+        const int                                         n,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const NekDouble *f[4] = { block.rhof, block.rhouf, block.rhovf,
+                                  block.rhowf };
+
+        for (int j = 0; j < nDim + 1; ++j)
+        {
+            Vmath::Vcopy(n, f[j], 1, &flux[j][offset], 1);
+        }
+
+        Vmath::Vcopy(n, block.Ef, 1, &flux[nDim+1][offset], 1);
     }
 }
@@ -42,12 +42,57 @@ using namespace Nektar::SolverUtils;
 
 namespace Nektar
 {
+    /**
+     * @brief Structure-of-arrays storage for a block of trace points, used by
+     * the array implementations of the compressible Riemann solvers.
+     *
+     * Missing momentum components in one and two dimensions are stored as
+     * zero so that the same kernel can be used in all dimensions.
+     */
+    struct RiemannBlock
+    {
+        static const int size = 32;
+
+        NekDouble rhoL[size], rhouL[size], rhovL[size], rhowL[size], EL[size];
+        NekDouble rhoR[size], rhouR[size], rhovR[size], rhowR[size], ER[size];
+        NekDouble rhof[size], rhouf[size], rhovf[size], rhowf[size], Ef[size];
+    };
+
     class CompressibleSolver : public RiemannSolver
     {
+    public:
+        /// Force the use of the pointwise solver even when an array
+        /// implementation is available, e.g. for benchmarking.
+        void ForcePointSolve(bool force)
+        {
+            m_forcePointSolve = force;
+        }
+
     protected:
+        /// True if the solver only provides a pointwise implementation.
         bool m_pointSolve;
+        /// True if the pointwise implementation should always be used.
+        bool m_forcePointSolve;
+        /// True if the solver only provides an array implementation, which
+        /// is then used in all cases.
+        bool m_arrayOnly;
         
         CompressibleSolver();
+
+        void GatherBlock(
+            const int                                         nDim,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+            const int                                         offset,
+            const int                                         n,
+                  RiemannBlock                               &block);
+
+        void ScatterBlock(
+            const int                                         nDim,
+            const RiemannBlock                               &block,
+            const int                                         offset,
+            const int                                         n,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
         
         virtual void v_Solve(
             const int                                         nDim,
@@ -56,6 +101,7 @@ namespace Nektar
                   Array<OneD,       Array<OneD, NekDouble> > &flux);
 
         virtual void v_ArraySolve(
+            const int                                         nDim,
             const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
             const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
                   Array<OneD,       Array<OneD, NekDouble> > &flux)
@@ -79,6 +125,8 @@ namespace Nektar
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
     };
+
+    typedef boost::shared_ptr<CompressibleSolver> CompressibleSolverSharedPtr;
 }
 
 #endif
@@ -43,7 +43,7 @@ namespace Nektar
     
     HLLCSolver::HLLCSolver() : CompressibleSolver()
     {
-        
+        m_pointSolve = false;
     }
     
     /**
@@ -266,4 +266,131 @@ namespace Nektar
             }
         }
     }
+
+    /**
+     * @brief Array implementation of the HLLC Riemann solver.
+     *
+     * The trace is processed in blocks of RiemannBlock::size points which
+     * are passed to the non-virtual kernel #BlockSolve, so that the inner
+     * loop can be vectorised by the compiler.
+     */
+    void HLLCSolver::v_ArraySolve(
+        const int                                         nDim,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        const int       nPts  = Fwd[0].num_elements();
+        const int       bSize = RiemannBlock::size;
+
+        RiemannBlock block;
+
+        for (int i = 0; i < nPts; i += bSize)
+        {
+            const int n = std::min(bSize, nPts - i);
+            GatherBlock (nDim, Fwd, Bwd, i, n, block);
+            BlockSolve  (gamma, n, block);
+            ScatterBlock(nDim, block, i, n, flux);
+        }
+    }
+
+    /**
+     * @brief HLLC kernel for a block of trace points.
+     *
+     * Equivalent to #v_PointSolve, with the choice between the upwind
+     * states and the star states written as selections so that the loop
+     * contains no branches. Bitwise operators are used on the conditions to
+     * avoid short-circuit evaluation.
+     */
+    void HLLCSolver::BlockSolve(
+        const NekDouble gamma, const int n, RiemannBlock &b)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const NekDouble rhoL = b.rhoL[i], rhouL = b.rhouL[i];
+            const NekDouble rhovL = b.rhovL[i], rhowL = b.rhowL[i];
+            const NekDouble EL = b.EL[i];
+            const NekDouble rhoR = b.rhoR[i], rhouR = b.rhouR[i];
+            const NekDouble rhovR = b.rhovR[i], rhowR = b.rhowR[i];
+            const NekDouble ER = b.ER[i];
+
+            // Left and Right velocities
+            NekDouble uL = rhouL / rhoL;
+            NekDouble vL = rhovL / rhoL;
+            NekDouble wL = rhowL / rhoL;
+            NekDouble uR = rhouR / rhoR;
+            NekDouble vR = rhovR / rhoR;
+            NekDouble wR = rhowR / rhoR;
+
+            // Left and right pressure, sound speed and enthalpy.
+            NekDouble pL = (gamma - 1.0) *
+                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR));
+            NekDouble cL = sqrt(gamma * pL / rhoL);
+            NekDouble cR = sqrt(gamma * pR / rhoR);
+            NekDouble hL = (EL + pL) / rhoL;
+            NekDouble hR = (ER + pR) / rhoR;
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL);
+            NekDouble srR  = sqrt(rhoR);
+            NekDouble srLR = srL + srR;
+
+            // Velocity Roe averages
+            NekDouble uRoe = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe = (srL * hL + srR * hR) / srLR;
+            NekDouble cRoe = sqrt((gamma - 1.0)*(hRoe - 0.5 *
+                                  (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe)));
+
+            // Maximum wave speeds and contact wave speed
+            NekDouble SL = std::min(uL-cL, uRoe-cRoe);
+            NekDouble SR = std::max(uR+cR, uRoe+cRoe);
+            NekDouble SM = (pR - pL + rhouL * (SL - uL) - rhouR * (SR - uR)) /
+                (rhoL * (SL - uL) - rhoR * (SR - uR));
+
+            // Select the upwind side and whether a star state is used.
+            const bool left = (SL >= 0.0) | ((SR > 0.0) & (SM >= 0.0));
+            const bool star = (SL <  0.0) &  (SR > 0.0);
+
+            NekDouble rho  = left ? rhoL  : rhoR;
+            NekDouble rhou = left ? rhouL : rhouR;
+            NekDouble rhov = left ? rhovL : rhovR;
+            NekDouble rhow = left ? rhowL : rhowR;
+            NekDouble E    = left ? EL    : ER;
+            NekDouble u    = left ? uL    : uR;
+            NekDouble v    = left ? vL    : vR;
+            NekDouble w    = left ? wL    : wR;
+            NekDouble p    = left ? pL    : pR;
+            NekDouble S    = left ? SL    : SR;
+
+            // Upwind flux.
+            NekDouble rhof  = rhou;
+            NekDouble rhouf = rhou * u + p;
+            NekDouble rhovf = rhou * v;
+            NekDouble rhowf = rhou * w;
+            NekDouble Ef    = u * (E + p);
+
+            // Star state on the upwind side of the contact. The wave speed is
+            // set to zero if the upwind state is used, so that the star
+            // state can be evaluated unconditionally.
+            NekDouble SS    = star ? S      : 0.0;
+            NekDouble den   = star ? S - SM : 1.0;
+            NekDouble rhoM  = rho * (S - u) / den;
+            NekDouble rhouM = rhoM * SM;
+            NekDouble rhovM = rhoM * v;
+            NekDouble rhowM = rhoM * w;
+            NekDouble EM    = rhoM * (E / rho +
+                                      (SM - u) * (SM + p / (rho * (S - u))));
+
+            b.rhof [i] = rhof  + SS * (rhoM  - rho);
+            b.rhouf[i] = rhouf + SS * (rhouM - rhou);
+            b.rhovf[i] = rhovf + SS * (rhovM - rhov);
+            b.rhowf[i] = rhowf + SS * (rhowM - rhow);
+            b.Ef   [i] = Ef    + SS * (EM    - E);
+        }
+    }
 }
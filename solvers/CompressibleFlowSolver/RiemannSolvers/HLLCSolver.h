@@ -62,6 +62,16 @@ namespace Nektar
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL, NekDouble  EpsL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER, NekDouble  EpsR,
             NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf, NekDouble &Ef, NekDouble &Epsf);
+
+        virtual void v_ArraySolve(
+            const int                                         nDim,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
+
+    private:
+        static void BlockSolve(
+            const NekDouble gamma, const int n, RiemannBlock &block);
     };
 }
 
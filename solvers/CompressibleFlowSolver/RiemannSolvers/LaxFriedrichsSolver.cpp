@@ -45,7 +45,7 @@ namespace Nektar
 
     LaxFriedrichsSolver::LaxFriedrichsSolver() : CompressibleSolver()
     {
-        
+        m_pointSolve = false;
     }
     
     /**
@@ -115,4 +115,93 @@ namespace Nektar
         rhowf = 0.5*(rhouL*wL + rhouR*wR - URoe*(rhowR - rhowL));
         Ef    = 0.5*(uL*(EL + pL) + uR*(ER + pR) - URoe*(ER - EL));
     }
+
+    /**
+     * @brief Array implementation of the Lax-Friedrichs Riemann solver.
+     *
+     * The trace is processed in blocks of RiemannBlock::size points which
+     * are passed to the non-virtual kernel #BlockSolve, so that the inner
+     * loop can be vectorised by the compiler.
+     */
+    void LaxFriedrichsSolver::v_ArraySolve(
+        const int                                         nDim,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        const int       nPts  = Fwd[0].num_elements();
+        const int       bSize = RiemannBlock::size;
+
+        RiemannBlock block;
+
+        for (int i = 0; i < nPts; i += bSize)
+        {
+            const int n = std::min(bSize, nPts - i);
+            GatherBlock (nDim, Fwd, Bwd, i, n, block);
+            BlockSolve  (gamma, n, block);
+            ScatterBlock(nDim, block, i, n, flux);
+        }
+    }
+
+    /**
+     * @brief Lax-Friedrichs kernel for a block of trace points, equivalent
+     * to #v_PointSolve.
+     */
+    void LaxFriedrichsSolver::BlockSolve(
+        const NekDouble gamma, const int n, RiemannBlock &b)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const NekDouble rhoL = b.rhoL[i], rhouL = b.rhouL[i];
+            const NekDouble rhovL = b.rhovL[i], rhowL = b.rhowL[i];
+            const NekDouble EL = b.EL[i];
+            const NekDouble rhoR = b.rhoR[i], rhouR = b.rhouR[i];
+            const NekDouble rhovR = b.rhovR[i], rhowR = b.rhowR[i];
+            const NekDouble ER = b.ER[i];
+
+            // Left and right velocities
+            NekDouble uL = rhouL / rhoL;
+            NekDouble vL = rhovL / rhoL;
+            NekDouble wL = rhowL / rhoL;
+            NekDouble uR = rhouR / rhoR;
+            NekDouble vR = rhovR / rhoR;
+            NekDouble wR = rhowR / rhoR;
+
+            // Left and right pressures
+            NekDouble pL = (gamma - 1.0) *
+                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR));
+
+            // Left and right enthalpy
+            NekDouble hL = (EL + pL) / rhoL;
+            NekDouble hR = (ER + pR) / rhoR;
+
+            // Square root of rhoL and rhoR
+            NekDouble srL  = sqrt(rhoL);
+            NekDouble srR  = sqrt(rhoR);
+            NekDouble srLR = srL + srR;
+
+            // Roe average state
+            NekDouble uRoe = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe = (srL * hL + srR * hR) / srLR;
+            NekDouble URoe = (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe);
+            NekDouble cRoe = sqrt((gamma - 1.0)*(hRoe - 0.5 * URoe));
+
+            // Maximum eigenvalue
+            NekDouble lambda = fabs(uRoe) + cRoe;
+
+            // Lax-Friedrichs flux formula
+            b.rhof [i] = 0.5*(rhouL + rhouR - lambda*(rhoR - rhoL));
+            b.rhouf[i] = 0.5*(pL + rhouL*uL + pR + rhouR*uR -
+                              lambda*(rhouR - rhouL));
+            b.rhovf[i] = 0.5*(rhouL*vL + rhouR*vR - lambda*(rhovR - rhovL));
+            b.rhowf[i] = 0.5*(rhouL*wL + rhouR*wR - lambda*(rhowR - rhowL));
+            b.Ef   [i] = 0.5*(uL*(EL + pL) + uR*(ER + pR) -
+                              lambda*(ER - EL));
+        }
+    }
 }
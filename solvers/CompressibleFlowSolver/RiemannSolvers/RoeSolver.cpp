@@ -45,7 +45,7 @@ namespace Nektar
 
     RoeSolver::RoeSolver() : CompressibleSolver()
     {
-
+        m_pointSolve = false;
     }
 
     /**
@@ -172,4 +172,124 @@ namespace Nektar
             Ef    -= uRoeAbs*k[i][4];
         }
     }
+
+    /**
+     * @brief Array implementation of the Roe Riemann solver.
+     *
+     * The trace is processed in blocks of RiemannBlock::size points which
+     * are passed to the non-virtual kernel #BlockSolve, so that the inner
+     * loop can be vectorised by the compiler.
+     */
+    void RoeSolver::v_ArraySolve(
+        const int                                         nDim,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        const NekDouble gamma = m_params["gamma"]();
+        const int       nPts  = Fwd[0].num_elements();
+        const int       bSize = RiemannBlock::size;
+
+        RiemannBlock block;
+
+        for (int i = 0; i < nPts; i += bSize)
+        {
+            const int n = std::min(bSize, nPts - i);
+            GatherBlock (nDim, Fwd, Bwd, i, n, block);
+            BlockSolve  (gamma, n, block);
+            ScatterBlock(nDim, block, i, n, flux);
+        }
+    }
+
+    /**
+     * @brief Roe kernel for a block of trace points.
+     *
+     * Equivalent to #v_PointSolve, with the summation over the
+     * eigenvectors (equation 11.29) written out explicitly.
+     */
+    void RoeSolver::BlockSolve(
+        const NekDouble gamma, const int n, RiemannBlock &b)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            const NekDouble rhoL = b.rhoL[i], rhouL = b.rhouL[i];
+            const NekDouble rhovL = b.rhovL[i], rhowL = b.rhowL[i];
+            const NekDouble EL = b.EL[i];
+            const NekDouble rhoR = b.rhoR[i], rhouR = b.rhouR[i];
+            const NekDouble rhovR = b.rhovR[i], rhowR = b.rhowR[i];
+            const NekDouble ER = b.ER[i];
+
+            // Left and right velocities
+            NekDouble uL = rhouL / rhoL;
+            NekDouble vL = rhovL / rhoL;
+            NekDouble wL = rhowL / rhoL;
+            NekDouble uR = rhouR / rhoR;
+            NekDouble vR = rhovR / rhoR;
+            NekDouble wR = rhowR / rhoR;
+
+            // Left and right pressures
+            NekDouble pL = (gamma - 1.0) *
+                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR));
+
+            // Left and right enthalpy
+            NekDouble hL = (EL + pL) / rhoL;
+            NekDouble hR = (ER + pR) / rhoR;
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL);
+            NekDouble srR  = sqrt(rhoR);
+            NekDouble srLR = srL + srR;
+
+            // Velocity, enthalpy and sound speed Roe averages (equation
+            // 11.60).
+            NekDouble uRoe = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe = (srL * hL + srR * hR) / srLR;
+            NekDouble URoe = (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe);
+            NekDouble cRoe = sqrt((gamma - 1.0)*(hRoe - 0.5 * URoe));
+
+            // Calculate jumps \Delta u_i (defined preceding equation 11.67).
+            NekDouble jump0 = rhoR  - rhoL;
+            NekDouble jump1 = rhouR - rhouL;
+            NekDouble jump2 = rhovR - rhovL;
+            NekDouble jump3 = rhowR - rhowL;
+            NekDouble jump4 = ER    - EL;
+
+            // Define \Delta u_5 (equation 11.70).
+            NekDouble jumpbar = jump4 - (jump2-vRoe*jump0)*vRoe -
+                (jump3-wRoe*jump0)*wRoe;
+
+            // Compute wave amplitudes (equations 11.68, 11.69).
+            NekDouble alpha1 = (gamma-1.0)*(jump0*(hRoe - uRoe*uRoe) +
+                                            uRoe*jump1 - jumpbar)/(cRoe*cRoe);
+            NekDouble alpha0 = (jump0*(uRoe + cRoe) - jump1 - cRoe*alpha1)/
+                (2.0*cRoe);
+            NekDouble alpha4 = jump0 - (alpha0 + alpha1);
+            NekDouble alpha2 = jump2 - vRoe * jump0;
+            NekDouble alpha3 = jump3 - wRoe * jump0;
+
+            // Scale amplitudes by eigenvalues \lambda_i (equation 11.58).
+            NekDouble uRoeAbs = fabs(uRoe);
+            NekDouble a0 = 0.5*alpha0*fabs(uRoe - cRoe);
+            NekDouble a1 = 0.5*alpha1*uRoeAbs;
+            NekDouble a2 = 0.5*alpha2*uRoeAbs;
+            NekDouble a3 = 0.5*alpha3*uRoeAbs;
+            NekDouble a4 = 0.5*alpha4*fabs(uRoe + cRoe);
+            NekDouble a  = a0 + a1 + a4;
+
+            // Average of left and right fluxes minus the summation over the
+            // eigenvectors of equation 11.59 (equation 11.29).
+            b.rhof [i] = 0.5*(rhoL*uL + rhoR*uR) - a;
+            b.rhouf[i] = 0.5*(pL + rhoL*uL*uL + pR + rhoR*uR*uR) -
+                (a0*(uRoe - cRoe) + a1*uRoe + a4*(uRoe + cRoe));
+            b.rhovf[i] = 0.5*(rhoL*uL*vL + rhoR*uR*vR) - (a*vRoe + a2);
+            b.rhowf[i] = 0.5*(rhoL*uL*wL + rhoR*uR*wR) - (a*wRoe + a3);
+            b.Ef   [i] = 0.5*(uL*(EL + pL) + uR*(ER + pR)) -
+                (a0*(hRoe - uRoe*cRoe) + a1*0.5*URoe + a2*vRoe + a3*wRoe +
+                 a4*(hRoe + uRoe*cRoe));
+        }
+    }
 }
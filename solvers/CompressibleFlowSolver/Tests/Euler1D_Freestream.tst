@@ -0,0 +1,21 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler 1D P=3, WeakDG, MODIFIED, freestream with the default Average Riemann solver</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>Euler1D_Freestream.xml</parameters>
+    <files>
+        <file description="Session File">Euler1D_Freestream.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-10">0</value>
+            <value variable="rhou" tolerance="1e-10">0</value>
+            <value variable="E" tolerance="1e-6">0</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-10">0</value>
+            <value variable="rhou" tolerance="1e-10">0</value>
+            <value variable="E" tolerance="1e-6">0</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,16 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>HLLC Riemann solver, array path against pointwise path in 3D</description>
+    <executable>RiemannSolverBenchmark</executable>
+    <parameters>HLLC 3 1000 1</parameters>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Max difference :\s*(\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-12">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,16 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Roe Riemann solver, array path against pointwise path in 2D</description>
+    <executable>RiemannSolverBenchmark</executable>
+    <parameters>Roe 2 1000 1</parameters>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Max difference :\s*(\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-12">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
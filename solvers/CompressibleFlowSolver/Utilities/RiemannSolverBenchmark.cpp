@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File RiemannSolverBenchmark.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compare the pointwise and array implementations of the
+// compressible Riemann solvers on random trace states.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <iostream>
+#include <iomanip>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
+
+using namespace std;
+using namespace Nektar;
+
+/**
+ * @brief Holds the quantities required by the Riemann solvers for a trace
+ * whose normals are aligned with the x-axis.
+ */
+struct BenchmarkTrace
+{
+    BenchmarkTrace(const int nDim, const int nPts) :
+        m_gamma  (1.4),
+        m_normals(nDim),
+        m_vecLocs(1)
+    {
+        for (int i = 0; i < nDim; ++i)
+        {
+            m_normals[i] = Array<OneD, NekDouble>(nPts, i == 0 ? 1.0 : 0.0);
+        }
+
+        m_vecLocs[0] = Array<OneD, NekDouble>(nDim);
+        for (int i = 0; i < nDim; ++i)
+        {
+            m_vecLocs[0][i] = 1 + i;
+        }
+    }
+
+    NekDouble GetGamma()
+    {
+        return m_gamma;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetNormals()
+    {
+        return m_normals;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetVecLocs()
+    {
+        return m_vecLocs;
+    }
+
+    NekDouble                            m_gamma;
+    Array<OneD, Array<OneD, NekDouble> > m_normals;
+    Array<OneD, Array<OneD, NekDouble> > m_vecLocs;
+};
+
+/// Fill @p u with random conservative states with density and pressure in
+/// [0.5, 1.5] and velocity components in [-1, 1].
+void RandomStates(
+    const int                             nDim,
+    const NekDouble                       gamma,
+    Array<OneD, Array<OneD, NekDouble> > &u)
+{
+    int nPts = u[0].num_elements();
+
+    for (int i = 0; i < nPts; ++i)
+    {
+        NekDouble rho  = 0.5 + rand() / (NekDouble)RAND_MAX;
+        NekDouble p    = 0.5 + rand() / (NekDouble)RAND_MAX;
+        NekDouble kin  = 0.0;
+
+        u[0][i] = rho;
+        for (int j = 0; j < nDim; ++j)
+        {
+            NekDouble vel = 2.0 * rand() / (NekDouble)RAND_MAX - 1.0;
+            u[j+1][i] = rho * vel;
+            kin      += 0.5 * rho * vel * vel;
+        }
+        u[nDim+1][i] = p / (gamma - 1.0) + kin;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: RiemannSolverBenchmark solver [nDim] [nPts] "
+                        "[nIter]\n");
+        exit(1);
+    }
+
+    string solverName = argv[1];
+    int    nDim       = argc > 2 ? atoi(argv[2]) : 3;
+    int    nPts       = argc > 3 ? atoi(argv[3]) : 10000;
+    int    nIter      = argc > 4 ? atoi(argv[4]) : 1000;
+    int    nVar       = nDim + 2;
+
+    ASSERTL0(nDim >= 1 && nDim <= 3, "nDim must be 1, 2 or 3.");
+
+    BenchmarkTrace trace(nDim, nPts);
+
+    CompressibleSolverSharedPtr solver =
+        boost::dynamic_pointer_cast<CompressibleSolver>(
+            SolverUtils::GetRiemannSolverFactory().CreateInstance(
+                solverName));
+    ASSERTL0(solver, "Not a compressible Riemann solver: " + solverName);
+
+    solver->SetParam (
+        "gamma",   &BenchmarkTrace::GetGamma,   &trace);
+    solver->SetAuxVec(
+        "vecLocs", &BenchmarkTrace::GetVecLocs, &trace);
+    solver->SetVector(
+        "N",       &BenchmarkTrace::GetNormals, &trace);
+
+    Array<OneD, Array<OneD, NekDouble> > Fwd(nVar), Bwd(nVar);
+    Array<OneD, Array<OneD, NekDouble> > pointFlux(nVar), arrayFlux(nVar);
+    for (int i = 0; i < nVar; ++i)
+    {
+        Fwd      [i] = Array<OneD, NekDouble>(nPts);
+        Bwd      [i] = Array<OneD, NekDouble>(nPts);
+        pointFlux[i] = Array<OneD, NekDouble>(nPts);
+        arrayFlux[i] = Array<OneD, NekDouble>(nPts);
+    }
+
+    srand(0);
+    RandomStates(nDim, trace.m_gamma, Fwd);
+    RandomStates(nDim, trace.m_gamma, Bwd);
+
+    Timer     timer;
+    NekDouble timePoint, timeArray;
+
+    solver->ForcePointSolve(true);
+    solver->Solve(nDim, Fwd, Bwd, pointFlux);
+    timer.Start();
+    for (int n = 0; n < nIter; ++n)
+    {
+        solver->Solve(nDim, Fwd, Bwd, pointFlux);
+    }
+    timer.Stop();
+    timePoint = timer.TimePerTest(nIter);
+
+    solver->ForcePointSolve(false);
+    solver->Solve(nDim, Fwd, Bwd, arrayFlux);
+    timer.Start();
+    for (int n = 0; n < nIter; ++n)
+    {
+        solver->Solve(nDim, Fwd, Bwd, arrayFlux);
+    }
+    timer.Stop();
+    timeArray = timer.TimePerTest(nIter);
+
+    NekDouble maxDiff = 0.0;
+    for (int i = 0; i < nVar; ++i)
+    {
+        for (int j = 0; j < nPts; ++j)
+        {
+            maxDiff = max(maxDiff, fabs(pointFlux[i][j] - arrayFlux[i][j]));
+        }
+    }
+
+    cout << "Riemann solver : " << solverName << endl;
+    cout << "Dimension      : " << nDim << endl;
+    cout << "Trace points   : " << nPts << endl;
+    cout << "Point solve    : " << setw(12) << timePoint << " s" << endl;
+    cout << "Array solve    : " << setw(12) << timeArray << " s" << endl;
+    cout << "Speed-up       : " << setw(12) << timePoint / timeArray << endl;
+    cout << "Max difference : " << setw(12) << maxDiff << endl;
+
+    return 0;
+}
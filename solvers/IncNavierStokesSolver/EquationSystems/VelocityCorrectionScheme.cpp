@@ -35,6 +35,7 @@
 
 #include <IncNavierStokesSolver/EquationSystems/VelocityCorrectionScheme.h>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <SolverUtils/Core/Misc.h>
 
 #include <boost/algorithm/string.hpp>
@@ -353,17 +354,25 @@ namespace Nektar
         // Substep the pressure boundary condition if using substepping
         m_extrapolation->SubStepSetPressureBCs(inarray,aii_Dt,m_kinvis);
 
-        // Set up forcing term for pressure Poisson equation
-        SetUpPressureForcing(inarray, m_F, aii_Dt);
+        {
+            LibUtilities::ProfileRegion region("PressureSolve");
+
+            // Set up forcing term for pressure Poisson equation
+            SetUpPressureForcing(inarray, m_F, aii_Dt);
+
+            // Solve Pressure System
+            SolvePressure (m_F[0]);
+        }
 
-        // Solve Pressure System
-        SolvePressure (m_F[0]);
+        {
+            LibUtilities::ProfileRegion region("ViscousSolve");
 
-        // Set up forcing term for Helmholtz problems
-        SetUpViscousForcing(inarray, m_F, aii_Dt);
+            // Set up forcing term for Helmholtz problems
+            SetUpViscousForcing(inarray, m_F, aii_Dt);
 
-        // Solve velocity system
-        SolveViscous( m_F, outarray, aii_Dt);
+            // Solve velocity system
+            SolveViscous( m_F, outarray, aii_Dt);
+        }
     }
         
     /**
@@ -402,17 +411,39 @@ namespace Nektar
         int phystot = m_fields[0]->GetTotPoints();
 
         // Grad p
-        m_pressure->BwdTrans(m_pressure->GetCoeffs(),m_pressure->UpdatePhys());
-
         int nvel = m_velocity.num_elements();
-        if(nvel == 2)
+        if(m_HomogeneousType == eNotHomogeneous)
         {
-            m_pressure->PhysDeriv(m_pressure->GetPhys(), Forcing[0], Forcing[1]);
+            // Evaluate p and its gradient in a single pass over the
+            // pressure coefficients of each element.
+            if(nvel == 2)
+            {
+                m_pressure->BwdTransPhysDeriv_IterPerExp(
+                    m_pressure->GetCoeffs(), m_pressure->UpdatePhys(),
+                    Forcing[0], Forcing[1]);
+            }
+            else
+            {
+                m_pressure->BwdTransPhysDeriv_IterPerExp(
+                    m_pressure->GetCoeffs(), m_pressure->UpdatePhys(),
+                    Forcing[0], Forcing[1], Forcing[2]);
+            }
         }
         else
         {
-            m_pressure->PhysDeriv(m_pressure->GetPhys(), Forcing[0], 
-                                  Forcing[1], Forcing[2]);
+            m_pressure->BwdTrans(m_pressure->GetCoeffs(),
+                                 m_pressure->UpdatePhys());
+
+            if(nvel == 2)
+            {
+                m_pressure->PhysDeriv(m_pressure->GetPhys(), Forcing[0],
+                                      Forcing[1]);
+            }
+            else
+            {
+                m_pressure->PhysDeriv(m_pressure->GetPhys(), Forcing[0],
+                                      Forcing[1], Forcing[2]);
+            }
         }
 
         // Subtract inarray/(aii_dt) and divide by kinvis. Kinvis will
@@ -459,6 +490,38 @@ namespace Nektar
             factors[StdRegions::eFactorSVVDiffCoeff]   = m_sVVDiffCoeff/m_kinvis;
         }
 
+        // When all velocity components have the same diffusion
+        // coefficient their Helmholtz systems share the same matrix and
+        // may be solved together.
+        bool sameDiffCoeff = true;
+        for(int i = 1; i < m_nConvectiveFields; ++i)
+        {
+            sameDiffCoeff = sameDiffCoeff &&
+                (m_diffCoeff[i] == m_diffCoeff[0]);
+        }
+
+        if(sameDiffCoeff && m_nConvectiveFields > 1)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr> fields(
+                m_nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > coeffs(m_nConvectiveFields);
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                fields[i] = m_fields[i];
+                coeffs[i] = m_fields[i]->UpdateCoeffs();
+            }
+
+            factors[StdRegions::eFactorLambda] = 1.0/aii_Dt/m_diffCoeff[0];
+            m_fields[0]->HelmSolveMultiple(fields, Forcing, coeffs,
+                                           NullFlagList, factors);
+
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(),outarray[i]);
+            }
+            return;
+        }
+
         // Solve Helmholtz system and put in Physical space
         for(int i = 0; i < m_nConvectiveFields; ++i)
         {
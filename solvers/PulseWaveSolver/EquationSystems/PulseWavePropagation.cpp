@@ -34,7 +34,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <vector>
 
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <PulseWaveSolver/EquationSystems/PulseWavePropagation.h>
 
 using namespace std;
@@ -55,10 +57,42 @@ namespace Nektar
 	 *    \cdot \{ \mathbf{F}^u - \mathbf{F}(\mathbf{U}^{\delta}) \} \right]_{x_e^l}^{x_eû} \right] = 0 \f$
      */ 
     PulseWavePropagation::PulseWavePropagation(const LibUtilities::SessionReaderSharedPtr& pSession)
-	: PulseWaveSystem(pSession)
+	: PulseWaveSystem(pSession),
+          m_vesselRhsSetUp(false)
     {
     }
 
+    /**
+     * @brief Job evaluating the right hand side of a single vessel.
+     */
+    class PulseWavePropagation::VesselJob : public Thread::ThreadJob
+    {
+    public:
+        VesselJob(PulseWavePropagation                       *system,
+                  const int                                   omega,
+                  const Array<OneD, Array<OneD, NekDouble> > &physarray,
+                  const Array<OneD, Array<OneD, NekDouble> > &outarray)
+            : m_system(system), m_omega(omega), m_physarray(physarray),
+              m_outarray(outarray)
+        {
+        }
+
+        virtual ~VesselJob()
+        {
+        }
+
+        virtual void Run()
+        {
+            m_system->VesselRhs(m_omega, m_physarray, m_outarray);
+        }
+
+    private:
+        PulseWavePropagation                *m_system;
+        int                                  m_omega;
+        Array<OneD, Array<OneD, NekDouble> > m_physarray;
+        Array<OneD, Array<OneD, NekDouble> > m_outarray;
+    };
+
     void PulseWavePropagation::v_InitObject()
     {
         PulseWaveSystem::v_InitObject();
@@ -85,23 +119,19 @@ namespace Nektar
     /**
      *  Computes the right hand side of (1). The RHS is everything
      *  except the term that contains the time derivative
-     *  \f$\frac{\partial \mathbf{U}}{\partial t}\f$. In case of a
-     *  Discontinuous Galerkin projection, the routine WeakDGAdvection
-     *  will be called which then calls v_GetFluxVector and
-     *  v_NumericalFlux implemented in the PulseWavePropagation class.
-     *
+     *  \f$\frac{\partial \mathbf{U}}{\partial t}\f$. The inflow,
+     *  outflow and interface conditions, which couple the vessels, are
+     *  first set up in turn. The weak DG advection of each vessel,
+     *  evaluated by VesselRhs, then only depends on that vessel, and
+     *  the vessels are run as jobs by Thread::RunSessionJobs. The
+     *  first evaluation is always serial so that the matrices of each
+     *  vessel are created by a single thread.
      */
     void PulseWavePropagation::DoOdeRhs(const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                                         Array<OneD,        Array<OneD, NekDouble> >&outarray,
                                        const NekDouble time)
     {
         int i;
-            
-        Array<OneD, Array<OneD, NekDouble> > physarray(m_nVariables);
-        Array<OneD, Array<OneD, NekDouble> > modarray (m_nVariables);
-	
-	Array<OneD, NekDouble> tmpArray;
-
         int cnt = 0;
 
         // Set up Inflow and Outflow boundary conditions. 
@@ -109,38 +139,78 @@ namespace Nektar
     
         // Set up any interface conditions and write into boundary condition
         EnforceInterfaceConditions(inarray);
-        
-        // do advection evauation in all domains
+
+        // do advection evauation in all domains. The views of each
+        // vessel are created here in the calling thread.
+        vector<Thread::ThreadJob*> jobs;
         for(int omega=0; omega < m_nDomains; ++omega)
         {
-            m_currentDomain = omega;
-            int nq = m_vessels[omega*m_nVariables]->GetTotPoints();
-            int ncoeffs = m_vessels[omega*m_nVariables]->GetNcoeffs();
-            
+            Array<OneD, Array<OneD, NekDouble> > physarray(m_nVariables);
+            Array<OneD, Array<OneD, NekDouble> > outvessel(m_nVariables);
+
             for (i = 0; i < m_nVariables; ++i)
             {
-                physarray[i] = inarray[i]+cnt;
-                modarray[i]  = Array<OneD, NekDouble>(ncoeffs);
+                physarray[i] = inarray[i]  + cnt;
+                outvessel[i] = outarray[i] + cnt;
             }
 
-            for(i = 0; i < m_nVariables; ++i)
-            {
-                m_fields[i] = m_vessels[omega*m_nVariables+ i];
-            }
-            
-            WeakDGAdvection(physarray, modarray, true, true);
-            
-            for(i = 0; i < m_nVariables; ++i)
-            {
-                Vmath::Neg(ncoeffs,modarray[i],1);
-            }	  
-            
-            for(i = 0; i < m_nVariables; ++i)
-            {
-                m_vessels[omega*m_nVariables+i]->MultiplyByElmtInvMass(modarray[i],modarray[i]);
-                m_vessels[omega*m_nVariables+i]->BwdTrans(modarray[i],tmpArray = outarray[i]+cnt);
-            }
-            cnt += nq;
+            jobs.push_back(new VesselJob(this, omega, physarray, outvessel));
+
+            cnt += m_vessels[omega*m_nVariables]->GetTotPoints();
+        }
+
+        Thread::RunSessionJobs(jobs, m_vesselRhsSetUp);
+
+        m_vesselRhsSetUp = true;
+    }
+
+    /**
+     *  Evaluates the weak DG advection of the vessel @p omega as in
+     *  WeakDGAdvection, but only using the expansions of that vessel
+     *  so that vessels may be processed concurrently. The result is
+     *  transformed back to physical space in @p outarray.
+     */
+    void PulseWavePropagation::VesselRhs(
+        const int omega,
+        Array<OneD, Array<OneD, NekDouble> > &physarray,
+        Array<OneD, Array<OneD, NekDouble> > &outarray)
+    {
+        int i;
+        MultiRegions::ExpListSharedPtr vessel = m_vessels[omega*m_nVariables];
+        int nq        = vessel->GetTotPoints();
+        int ncoeffs   = vessel->GetNcoeffs();
+        int nTracePts = vessel->GetTrace()->GetNpoints();
+
+        Array<OneD, Array<OneD, NekDouble> > flux    (1);
+        Array<OneD, Array<OneD, NekDouble> > modarray(m_nVariables);
+        Array<OneD, Array<OneD, NekDouble> > numflux (m_nVariables);
+
+        flux[0] = Array<OneD, NekDouble>(nq);
+
+        // Get the advection part (without numerical flux)
+        for (i = 0; i < m_nVariables; ++i)
+        {
+            modarray[i] = Array<OneD, NekDouble>(ncoeffs);
+            numflux[i]  = Array<OneD, NekDouble>(nTracePts);
+
+            GetVesselFluxVector(omega, i, physarray, flux);
+            vessel->IProductWRTDerivBase(0, flux[0], modarray[i]);
+        }
+
+        GetVesselNumericalFlux(omega, physarray, numflux);
+
+        for (i = 0; i < m_nVariables; ++i)
+        {
+            MultiRegions::ExpListSharedPtr field =
+                m_vessels[omega*m_nVariables+i];
+
+            Vmath::Neg(ncoeffs,modarray[i],1);
+            field->AddTraceIntegral(numflux[i],modarray[i]);
+            field->SetPhysState(false);
+            Vmath::Neg(ncoeffs,modarray[i],1);
+
+            field->MultiplyByElmtInvMass(modarray[i],modarray[i]);
+            field->BwdTrans(modarray[i],outarray[i]);
         }
     }
 
@@ -234,7 +304,14 @@ namespace Nektar
     void PulseWavePropagation::v_GetFluxVector(const int i, Array<OneD, Array<OneD, NekDouble> > &physfield,
                                                Array<OneD, Array<OneD, NekDouble> > &flux)
     {
-        int nq = m_vessels[m_currentDomain*m_nVariables]->GetTotPoints();
+        GetVesselFluxVector(m_currentDomain, i, physfield, flux);
+    }
+
+    void PulseWavePropagation::GetVesselFluxVector(const int omega, const int i,
+                                                   Array<OneD, Array<OneD, NekDouble> > &physfield,
+                                                   Array<OneD, Array<OneD, NekDouble> > &flux)
+    {
+        int nq = m_vessels[omega*m_nVariables]->GetTotPoints();
         NekDouble p = 0.0;
         NekDouble p_t = 0.0;
 	
@@ -254,8 +331,8 @@ namespace Nektar
                 {
                     ASSERTL0(physfield[0][j]>=0,"Negative A not allowed.");
 
-                    p = m_pext + m_beta[m_currentDomain][j]*
-                        (sqrt(physfield[0][j]) - sqrt(m_A_0[m_currentDomain][j]));
+                    p = m_pext + m_beta[omega][j]*
+                        (sqrt(physfield[0][j]) - sqrt(m_A_0[omega][j]));
 
                     p_t = (physfield[1][j]*physfield[1][j])/2 + p/m_rho;
                     flux[0][j] =  p_t;
@@ -277,9 +354,16 @@ namespace Nektar
      */
     void PulseWavePropagation::v_NumericalFlux(Array<OneD, Array<OneD, NekDouble> > &physfield, 
                                                Array<OneD, Array<OneD, NekDouble> > &numflux)
-    {		
+    {
+        GetVesselNumericalFlux(m_currentDomain, physfield, numflux);
+    }
+
+    void PulseWavePropagation::GetVesselNumericalFlux(const int omega,
+                                                      Array<OneD, Array<OneD, NekDouble> > &physfield,
+                                                      Array<OneD, Array<OneD, NekDouble> > &numflux)
+    {
         int i;
-        int nTracePts = GetTraceTotPoints();
+        int nTracePts = m_vessels[omega*m_nVariables]->GetTrace()->GetNpoints();
         
         Array<OneD, Array<OneD, NekDouble> > Fwd(m_nVariables);
         Array<OneD, Array<OneD, NekDouble> > Bwd(m_nVariables);
@@ -293,7 +377,7 @@ namespace Nektar
         // Get the physical values at the trace
         for (i = 0; i < m_nVariables; ++i)
         {
-            m_vessels[m_currentDomain*m_nVariables+ i]->
+            m_vessels[omega*m_nVariables+ i]->
                 GetFwdBwdTracePhys(physfield[i],Fwd[i],Bwd[i]);
         }
         
@@ -308,9 +392,9 @@ namespace Nektar
             case eUpwindPulse:
                 {
                     RiemannSolverUpwind(Fwd[0][i],Fwd[1][i],Bwd[0][i],Bwd[1][i],
-                                        Aflux, uflux, m_A_0_trace[m_currentDomain][i],
-                                        m_beta_trace[m_currentDomain][i],
-                                        m_trace_fwd_normal[m_currentDomain][i]);
+                                        Aflux, uflux, m_A_0_trace[omega][i],
+                                        m_beta_trace[omega][i],
+                                        m_trace_fwd_normal[omega][i]);
                 }
                 break;
             default:
@@ -87,6 +87,21 @@ namespace Nektar
         virtual void v_NumericalFlux(Array<OneD, Array<OneD, NekDouble> > &physfield, 
                                      Array<OneD, Array<OneD, NekDouble> > &numflux);
         
+        /// Flux vector of variable @p i on the vessel @p omega
+        void GetVesselFluxVector(const int omega, const int i,
+                                 Array<OneD, Array<OneD, NekDouble> > &physfield,
+                                 Array<OneD, Array<OneD, NekDouble> > &flux);
+
+        /// Numerical flux at the trace of the vessel @p omega
+        void GetVesselNumericalFlux(const int omega,
+                                    Array<OneD, Array<OneD, NekDouble> > &physfield,
+                                    Array<OneD, Array<OneD, NekDouble> > &numflux);
+
+        /// Right hand side of the vessel @p omega
+        void VesselRhs(const int omega,
+                       Array<OneD, Array<OneD, NekDouble> > &physarray,
+                       Array<OneD, Array<OneD, NekDouble> > &outarray);
+
         /// Upwinding Riemann solver for interelemental boundaries
         void RiemannSolverUpwind(NekDouble AL,NekDouble uL,NekDouble AR,NekDouble uR, NekDouble &Aflux, 
                                  NekDouble &uflux, NekDouble A_0, NekDouble beta,
@@ -96,6 +111,12 @@ namespace Nektar
 
         PulseWavePressureAreaSharedPtr m_pressureArea;
         virtual void v_GenerateSummary(SolverUtils::SummaryList& s);
+
+    private:
+        class VesselJob;
+
+        /// True once the right hand side has been evaluated serially
+        bool m_vesselRhsSetUp;
     };
 }
 